@@ -0,0 +1,113 @@
+// AsyncHttpClient.h
+#ifndef ASYNC_HTTP_CLIENT_H
+#define ASYNC_HTTP_CLIENT_H
+
+#include <Arduino.h>
+#include "MonoTime.h"
+#include "HttpConnectionPool.h"
+#include "HttpBufferPool.h"
+
+// Non-blocking HTTP/1.1 client for the HomeWizard devices on the LAN.
+// A request walks through connect -> send -> receive -> done, and every call
+// to poll() only does as much socket work as is possible without waiting.
+// Each phase has its own timeout, so an unreachable device costs a few
+// microseconds per loop pass instead of a 5 s blocking HTTPClient call.
+// Connections are kept alive in httpPool; a kept connection the device has
+// closed in the meantime is replaced by a new one without failing the request.
+// The request and response text live in a buffer from httpBuffers that the
+// client holds from start() to reset(), so polling never touches the heap.
+class AsyncHttpClient
+{
+public:
+    enum State
+    {
+        IDLE,
+        CONNECTING,
+        SENDING,
+        RECEIVING,
+        DONE,  // Response complete, see getStatusCode()/getBody()
+        FAILED // See getError()
+    };
+
+    enum Error
+    {
+        ERR_NONE,
+        ERR_SOCKET,
+        ERR_CONNECT,
+        ERR_CONNECT_TIMEOUT,
+        ERR_SEND,
+        ERR_SEND_TIMEOUT,
+        ERR_RECEIVE,
+        ERR_RECEIVE_TIMEOUT,
+        ERR_OVERFLOW,
+        ERR_BAD_RESPONSE
+    };
+
+private:
+    static const MonoTime CONNECT_TIMEOUT = 1 * MONO_SECOND; // Per phase
+    static const MonoTime SEND_TIMEOUT = 1 * MONO_SECOND;
+    static const MonoTime RECEIVE_TIMEOUT = 2 * MONO_SECOND;
+    static const size_t REQUEST_SIZE = HttpBufferPool::REQUEST_SIZE;
+
+    char host[24]; // As given, also sent as the Host header
+    uint32_t address; // IPv4, network byte order
+    uint16_t port;
+
+    int sock;
+    int poolHost;         // Id in httpPool, -1 = not pooled
+    bool reusedConnection; // sock came from the pool
+    bool serverCloses;     // Response said Connection: close
+    State state;
+    Error error;
+    MonoTime requestStart;
+    MonoTime phaseStart;
+
+    HttpBufferPool::Buffer *buffer; // Held while a request is in flight or its response is read
+    size_t bufferSize;              // Response size the device needs
+    char *response;                 // buffer->response, or an empty string without a buffer
+    size_t responseSize;
+    size_t requestLength;
+    size_t requestSent;
+
+    size_t responseLength;
+    size_t headerLength;   // Bytes up to and including the blank line, 0 = not seen yet
+    long contentLength;    // -1 = not given, read until the server closes
+    bool chunked;
+    int statusCode;
+
+    void enterPhase(State next);
+    void fail(Error reason);
+    void closeSocket();
+    void openConnection();
+    bool retryOnNewConnection();
+    void stepConnect();
+    void stepSend();
+    void stepReceive();
+    bool parseHeaders();
+    bool responseComplete() const;
+    void finish();
+
+public:
+    AsyncHttpClient(const char *ip, uint16_t port = 80, size_t bufferSize = 1024);
+    ~AsyncHttpClient();
+    AsyncHttpClient(const AsyncHttpClient &) = delete;
+    AsyncHttpClient &operator=(const AsyncHttpClient &) = delete;
+
+    // Starts a request, returns false while another one is still in flight
+    // or no buffer is free: try again on the next pass
+    bool start(const char *method, const char *path, const char *body = nullptr);
+    State poll();  // Advances the request, never blocks
+    void reset();  // Back to IDLE, drops any request in flight and frees the buffer
+
+    State getState() const { return state; }
+    bool isBusy() const { return state == CONNECTING || state == SENDING || state == RECEIVING; }
+    Error getError() const { return error; }
+    const char *getErrorString() const;
+    int getStatusCode() const { return statusCode; }
+    char *getBody() { return response + headerLength; } // Null-terminated
+    size_t getBodyLength() const { return responseLength - headerLength; }
+    unsigned long getElapsed() const { return monoElapsedMs(requestStart); } // ms
+    const char *getHost() const { return host; }
+};
+
+#endif
@@ -0,0 +1,132 @@
+// DeviceLink.h
+#ifndef DEVICE_LINK_H
+#define DEVICE_LINK_H
+
+#include <Arduino.h>
+#include "MonoTime.h"
+#include "HomeP1Device.h"
+#include "HomeSocketDevice.h"
+#include "SocketRegistry.h"
+#include "SpscQueue.h"
+#include <atomic>
+
+// Runs all device HTTP polling in its own FreeRTOS task on core 0, so a slow
+// or offline device never stalls the control loop, display or web server on
+// core 1. Measurements and commands cross between the cores through SPSC
+// queues; the control side only ever reads its own DeviceSnapshot copy.
+//
+// Socket commands are coalesced on both sides: asking for the state a
+// socket already has (or is already being switched to) queues nothing,
+// and HomeSocketDevice only writes what differs from the confirmed state.
+// Until a command is confirmed the snapshot keeps the requested state, so
+// a read that was already under way does not flip it back.
+class DeviceLink
+{
+public:
+    static const int MAX_SOCKETS = SocketRegistry::MAX_SOCKETS;
+
+    struct Measurement
+    {
+        enum Source : uint8_t
+        {
+            P1,
+            SOCKET
+        };
+        uint8_t source;
+        uint8_t index; // Socket index (0-based), unused for P1
+        bool ok;
+        bool state;    // Socket on/off, the confirmed one
+        bool pending;  // A command is not confirmed yet
+        uint16_t accepted; // Commands taken from the queue for this socket
+        float importPower;
+        float exportPower;
+        HomeP1Device::Extras p1Extras; // Empty unless P1_* fields are enabled
+        MonoTime timestamp;
+    };
+
+    struct Command
+    {
+        uint8_t socketIndex;
+        bool state;
+    };
+
+    // Socket flags are bitmasks, bit i for socket index i
+    struct Snapshot
+    {
+        float importPower = 0;
+        float exportPower = 0;
+        bool p1Connected = false;
+        MonoTime p1UpdateTime = 0;
+        HomeP1Device::Extras p1Extras;
+        uint8_t socketCount = 0;
+        uint32_t socketPresent = 0;
+        uint32_t socketOn = 0;
+        uint32_t socketConnected = 0;
+        uint32_t socketKnown = 0;   // Read at least once or commanded
+        uint32_t socketPending = 0; // Command not confirmed, socketOn is the requested state
+
+        bool isOn(int index) const { return (socketOn >> index) & 1; }
+        bool isConnected(int index) const { return (socketConnected >> index) & 1; }
+        bool isPending(int index) const { return (socketPending >> index) & 1; }
+    };
+
+    // What process() picked up
+    struct Updates
+    {
+        bool p1 = false;
+        uint32_t sockets = 0; // Bit per socket that reported
+        // Against the snapshot as the previous process() left it, so a
+        // command's optimistic state counts as a change too
+        bool powerChanged = false;   // Import, export or P1 connection
+        uint32_t socketsChanged = 0; // On/off or connection
+    };
+
+    // The queues between the cores, public so tools/spsc tests these types
+    typedef SpscQueue<Measurement, 64> MeasurementQueue; // Core 0 -> core 1, room for every socket at once
+    typedef SpscQueue<Command, 32> CommandQueue;         // Core 1 -> core 0
+
+private:
+    static const unsigned long IDLE_DELAY = 5; // ms between polling passes
+    static const uint32_t TASK_STACK_SIZE = 8192;
+    static const int TASK_CORE = 0;
+
+    HomeP1Device *p1 = nullptr;
+    HomeSocketDevice *sockets[MAX_SOCKETS] = {};
+    uint8_t socketCount = 0;
+
+    MeasurementQueue measurements;
+    CommandQueue commands;
+    Snapshot snapshot;                       // Only touched on core 1
+    Snapshot processed;                      // Core 1, snapshot at the end of the last process()
+    MonoTime lastCommand[MAX_SOCKETS] = {};  // Core 1, when a command was queued
+    uint16_t sentCommands[MAX_SOCKETS] = {};      // Core 1, commands queued
+    uint32_t coalescedCommands[MAX_SOCKETS] = {}; // Core 1, not queued: already the state
+    uint16_t acceptedCommands[MAX_SOCKETS] = {};  // Core 0, commands popped
+    bool started = false;
+
+    // Poll intervals in ms, written on core 1, applied on core 0
+    std::atomic<uint32_t> p1IntervalMs{1000};
+    std::atomic<uint32_t> socketIntervalMs[MAX_SOCKETS];
+
+    static void pollTaskEntry(void *arg);
+    void pollLoop();
+    void pollOnce();
+    void publishSocket(int index, bool ok);
+
+public:
+    // devices[i] is socket index i, nullptr entries are skipped
+    void begin(HomeP1Device *p1Meter, HomeSocketDevice *const *devices, uint8_t count);
+
+    // Control side (core 1)
+    Updates process(); // Drains measurements, returns which devices reported and what changed
+    bool requestSocketState(int index, bool state);
+    const Snapshot &getSnapshot() const { return snapshot; }
+    bool hasSocket(int index) const { return index >= 0 && index < MAX_SOCKETS && ((snapshot.socketPresent >> index) & 1); }
+    MonoTime getLastCommand(int index) const { return lastCommand[index]; }
+    uint32_t getCoalescedCommands(int index) const { return coalescedCommands[index]; }
+    void setPollIntervals(uint32_t p1Ms, const uint32_t *socketMs);
+    unsigned long getDroppedMeasurements() const { return measurements.getDropped(); }
+    unsigned long getDroppedCommands() const { return commands.getDropped(); }
+};
+
+#endif
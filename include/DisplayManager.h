@@ -5,6 +5,7 @@
 #include <Wire.h>
 #include <Adafruit_GFX.h>
 #include <Adafruit_SSD1306.h>
+#include "MonoTime.h"
 
 #define SCREEN_WIDTH 128
 #define SCREEN_HEIGHT 64
@@ -13,25 +14,33 @@
 
 class DisplayManager
 {
+public:
+    struct SwitchStatus
+    {
+        const char *name;
+        bool on;
+        unsigned long seconds; // In the current state
+    };
+
 private:
+    static const uint8_t SWITCHES_PER_PAGE = 6; // Below the title and a blank line
+
     Adafruit_SSD1306 display;
     bool displayFound = false;
     int currentPage = 0;
-    unsigned long lastPageChange = 0;
-    const unsigned long PAGE_DURATION = 3000;
+    MonoTime lastPageChange = 0;
+    const MonoTime PAGE_DURATION = 3 * MONO_SECOND;
 
-    void showPowerPage(float importPower, float exportPower);
+    void showPowerPage(float importPower, float exportPower, float averagePower);
     void showEnvironmentPage(float temp, float humidity, float light);
-    void showSwitchesPage(bool switch1, bool switch2, bool switch3,
-                          const String &sw1Time, const String &sw2Time, const String &sw3Time);
+    void showSwitchesPage(const SwitchStatus *switches, uint8_t count, uint8_t page, uint8_t pages);
 
 public:
     DisplayManager();
     bool begin();
-    void updateDisplay(float importPower, float exportPower,
+    void updateDisplay(float importPower, float exportPower, float averagePower,
                        float temp, float humidity, float light,
-                       bool sw1, bool sw2, bool sw3,
-                       const String &sw1Time, const String &sw2Time, const String &sw3Time);
+                       const SwitchStatus *switches, uint8_t switchCount);
 };
 
 #endif
\ No newline at end of file
@@ -0,0 +1,51 @@
+// EventStream.h
+#ifndef EVENT_STREAM_H
+#define EVENT_STREAM_H
+
+#include <Arduino.h>
+#include <WiFi.h>
+#include "MonoTime.h"
+
+// Server-sent events for the dashboard (GET /events). Each connection is
+// kept open after its request; broadcast() writes one already serialised
+// event to all of them, and a short "ping" event every PING_INTERVAL lets
+// the page see the stream is alive and finds clients that went away.
+//
+// Writes never block the loop. WiFiClient::write() waits up to about 10 s
+// for a peer that stopped reading without closing (a tablet gone to sleep),
+// so events go out with non-blocking send() instead. A client whose send
+// buffer cannot take a whole event has fallen behind and is dropped; its
+// browser reconnects and starts again from a "full" event.
+class EventStream
+{
+public:
+    static const uint8_t MAX_CLIENTS = 4; // Wall tablets and a phone or two
+    static const MonoTime PING_INTERVAL = 4 * MONO_SECOND;
+
+private:
+    WiFiClient clients[MAX_CLIENTS];
+    uint32_t nextId = 1;
+    MonoTime lastPing = 0;
+    uint32_t sent = 0;        // Events written, all clients counted
+    uint32_t slowDropped = 0; // Clients dropped for falling behind
+
+    static bool sendAll(WiFiClient &client, const void *data, size_t length);
+    void drop(uint8_t slot);
+    bool writeEvent(WiFiClient &client, uint32_t id, const char *event, const char *data, size_t length);
+
+public:
+    // Sends the event-stream headers and keeps the connection. Returns its
+    // slot, -1 when every slot is taken. The caller stops the server's own
+    // copy afterwards.
+    int add(WiFiClient &client);
+    // Writes to one client, to bring a new one up to date
+    bool sendTo(uint8_t slot, const char *event, const char *data, size_t length);
+    void broadcast(const char *event, const char *data, size_t length);
+    void ping(); // Call often, sends only every PING_INTERVAL
+
+    uint8_t getClientCount();
+    uint32_t getEventsSent() const { return sent; }
+    uint32_t getSlowDropped() const { return slowDropped; }
+};
+
+#endif
@@ -0,0 +1,79 @@
+// FileCache.h
+#ifndef FILE_CACHE_H
+#define FILE_CACHE_H
+
+#include <Arduino.h>
+#include <FS.h>
+
+#define PRELOAD_FILE "/preload.txt" // On SPIFFS, optional
+
+// SPIFFS files the web server keeps in RAM, least recently used out first.
+// What it may hold is a byte budget that follows the free heap: at most
+// MAX_BYTES, never more than half of what is free above HEAP_RESERVE and
+// never more than the largest free block, so a page load cannot starve
+// the rest of the firmware. Paths are looked
+// up by hash; the name is kept too, to rule out a collision (SPIFFS names
+// are at most 32 bytes anyway).
+//
+// A manifest on SPIFFS (PRELOAD_FILE, one path per line, # for comments)
+// is read into the cache at start-up, so the first request is a hit too.
+//
+// Only used from the web server on core 1. Other tasks may read the
+// statistics, each field is a single aligned word.
+class FileCache
+{
+public:
+    static const uint8_t MAX_ENTRIES = 8;
+    static const size_t MAX_PATH = 32;
+    static const size_t MAX_BYTES = 48 * 1024;
+    static const size_t HEAP_RESERVE = 48 * 1024;
+
+    struct Entry
+    {
+        uint32_t hash; // Of the path, 0 when the slot is free
+        char path[MAX_PATH];
+        uint8_t *data;
+        size_t size;
+        uint32_t lastUsed; // Order of use, for eviction
+    };
+
+    struct Stats
+    {
+        uint32_t hits = 0;
+        uint32_t misses = 0;
+        uint32_t evictions = 0; // Made room for another file
+        uint32_t skipped = 0;   // Over the budget, no memory or a read failed: streamed from SPIFFS
+        uint32_t bytes = 0;
+        uint8_t entries = 0;
+    };
+
+private:
+    Entry entries[MAX_ENTRIES];
+    uint32_t useCounter = 0;
+    Stats stats;
+
+    static uint32_t hashPath(const char *path);
+    Entry *lookup(const char *path);
+    void evict(Entry &entry);
+
+public:
+    FileCache();
+    ~FileCache();
+
+    // The cached file, nullptr when it is not; counts a hit or a miss
+    const Entry *find(const char *path);
+    // Reads the whole file into the cache, evicting as needed; nullptr when
+    // it does not fit the budget (the file position is then undefined)
+    const Entry *add(const char *path, File &file);
+    // After the file was rewritten
+    void remove(const char *path);
+    // Loads the files listed in 'manifest', returns how many
+    uint8_t preload(const char *manifest);
+
+    size_t getBudget() const;
+    const Stats &getStats() const { return stats; }
+};
+
+extern FileCache fileCache;
+
+#endif
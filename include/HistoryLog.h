@@ -0,0 +1,75 @@
+// HistoryLog.h
+#ifndef HISTORY_LOG_H
+#define HISTORY_LOG_H
+
+#include <Arduino.h>
+#include <SPIFFS.h>
+#include "HistoryRecord.h"
+#include "MonoTime.h"
+
+// Append-only measurement log on SPIFFS, kept across reboots.
+//
+// Records are 16 bytes with their own CRC and go into SEGMENT_COUNT segment
+// files /log/<slot>.bin of SEGMENT_SIZE bytes each. The segment with the
+// highest header sequence is the head; when it is full the oldest slot is
+// deleted and reused, so the log never grows beyond SEGMENT_COUNT segments.
+// Records are collected in a one-page RAM buffer and written in page-sized
+// batches (or by flush()), which keeps flash writes and wear down - SPIFFS
+// spreads the pages over the partition itself.
+//
+// Recovery after a power loss only reads the segment headers and the last
+// record of the head: a torn or corrupt tail simply starts a new segment,
+// and readers skip records whose CRC does not match.
+class HistoryLog
+{
+public:
+    static const uint8_t SEGMENT_COUNT = 12;
+    static const uint32_t SEGMENT_SIZE = 64 * 1024;
+    static const size_t PAGE_SIZE = 256; // SPIFFS logical page
+    static const size_t RECORDS_PER_PAGE = PAGE_SIZE / sizeof(HistoryRecord);
+    static const uint32_t RECORDS_PER_SEGMENT = (SEGMENT_SIZE - sizeof(HistorySegmentHeader)) / sizeof(HistoryRecord);
+
+    struct Stats
+    {
+        uint32_t recordsLogged;
+        uint32_t recordsWritten; // Made it to flash
+        uint32_t bytesWritten;
+        uint32_t flushes;
+        uint32_t rotations;
+        uint32_t writeErrors;
+        uint32_t lastFlushTime; // ms spent in the last flush
+        uint32_t maxFlushTime;
+    };
+
+private:
+    HistoryRecord buffer[RECORDS_PER_PAGE];
+    size_t buffered = 0;
+
+    bool ready = false;
+    uint32_t segmentSequence = 0; // Of the head segment
+    uint32_t segmentRecords = 0;  // Records already in the head segment
+    uint16_t recordSequence = 0;
+    Stats stats = {};
+
+    static void slotPath(uint8_t slot, char *path, size_t size);
+    bool readHeader(uint8_t slot, HistorySegmentHeader &header);
+    bool startSegment(uint32_t sequence);
+    size_t writeRecords(const HistoryRecord *records, size_t count);
+    void append(uint8_t type, uint8_t index, int16_t v0, int16_t v1 = 0, int16_t v2 = 0);
+
+public:
+    bool begin(); // SPIFFS must already be mounted
+    void logP1(float avgW, float minW, float maxW);
+    void logSocket(int index, bool state);
+    void logSensors(float temperature, float humidity, float light);
+    void logBoot(int resetReason);
+    void flush(); // Writes whatever is buffered, even a partial page
+
+    bool isReady() const { return ready; }
+    size_t getBuffered() const { return buffered; }
+    uint32_t getSegmentSequence() const { return segmentSequence; }
+    uint32_t getSegmentRecords() const { return segmentRecords; }
+    const Stats &getStats() const { return stats; }
+};
+
+#endif
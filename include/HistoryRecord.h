@@ -0,0 +1,83 @@
+// HistoryRecord.h
+// On-flash format of the history log. Plain C++ with no Arduino
+// dependencies, so tools/history can include it on Linux as well.
+#ifndef HISTORY_RECORD_H
+#define HISTORY_RECORD_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+// Record types; the TIME_UPTIME flag marks records written before the clock
+// was synchronised, their time is seconds since boot instead of epoch
+enum HistoryRecordType : uint8_t
+{
+    HISTORY_P1 = 1,      // value = avg, min, max net power (W) over the log interval
+    HISTORY_SOCKET = 2,  // index = socket (0-based), value[0] = on/off
+    HISTORY_SENSORS = 3, // value = temperature (0.1 C), humidity (0.1 %), light (lux, unsigned)
+    HISTORY_BOOT = 4,    // Written once per start, value[0] = reset reason
+    HISTORY_TIME_UPTIME = 0x80
+};
+
+struct HistoryRecord
+{
+    uint32_t time;     // Epoch seconds (UTC), or uptime seconds with HISTORY_TIME_UPTIME
+    uint8_t type;
+    uint8_t index;
+    uint16_t sequence; // Low 16 bits of the running record number, shows gaps
+    int16_t value[3];
+    uint16_t crc;      // CRC-16 over the 14 bytes above
+};
+
+struct HistorySegmentHeader
+{
+    uint32_t magic;
+    uint32_t sequence; // Increases by one per segment, the highest is the head
+    uint16_t version;
+    uint16_t recordSize;
+    uint16_t reserved;
+    uint16_t crc; // CRC-16 over the 14 bytes above
+};
+
+static_assert(sizeof(HistoryRecord) == 16, "HistoryRecord must stay 16 bytes");
+static_assert(sizeof(HistorySegmentHeader) == 16, "HistorySegmentHeader must stay 16 bytes");
+
+static const uint32_t HISTORY_MAGIC = 0x474C4853; // "SHLG" little-endian
+static const uint16_t HISTORY_VERSION = 1;
+
+// CRC-16/CCITT-FALSE
+inline uint16_t historyCrc16(const void *data, size_t length)
+{
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+    uint16_t crc = 0xFFFF;
+    while (length--)
+    {
+        crc ^= (uint16_t)(*bytes++) << 8;
+        for (int bit = 0; bit < 8; bit++)
+            crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+inline void historySeal(HistoryRecord &record)
+{
+    record.crc = historyCrc16(&record, offsetof(HistoryRecord, crc));
+}
+
+inline bool historyValid(const HistoryRecord &record)
+{
+    return record.type != 0 && record.crc == historyCrc16(&record, offsetof(HistoryRecord, crc));
+}
+
+inline void historySeal(HistorySegmentHeader &header)
+{
+    header.crc = historyCrc16(&header, offsetof(HistorySegmentHeader, crc));
+}
+
+inline bool historyValid(const HistorySegmentHeader &header)
+{
+    return header.magic == HISTORY_MAGIC && header.version == HISTORY_VERSION &&
+           header.recordSize == sizeof(HistoryRecord) &&
+           header.crc == historyCrc16(&header, offsetof(HistorySegmentHeader, crc));
+}
+
+#endif
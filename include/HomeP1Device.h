@@ -3,32 +3,61 @@
 #define HOME_P1_DEVICE_H
 
 #include <Arduino.h>
-#include <HTTPClient.h>
 #include <ArduinoJson.h>
-#include <WiFiClient.h>
+#include "AsyncHttpClient.h"
+
+// Extra /api/v1/data fields, off by default. Enable them in build_flags,
+// e.g. -DP1_PHASE_POWER=1; every field left out is skipped by the parser.
+#ifndef P1_PHASE_POWER
+#define P1_PHASE_POWER 0 // active_power_l1_w .. l3_w
+#endif
+#ifndef P1_VOLTAGE
+#define P1_VOLTAGE 0 // active_voltage_l1_v .. l3_v
+#endif
+#ifndef P1_TOTALS
+#define P1_TOTALS 0 // total_power_import_kwh, total_power_export_kwh
+#endif
 
 class HomeP1Device
 {
+public:
+    struct Extras
+    {
+#if P1_PHASE_POWER
+        float phasePower[3] = {0, 0, 0}; // W, negative = export
+#endif
+#if P1_VOLTAGE
+        float voltage[3] = {0, 0, 0};
+#endif
+#if P1_TOTALS
+        double totalImportKwh = 0; // Meter readings need more than float precision
+        double totalExportKwh = 0;
+#endif
+    };
+
 private:
-    HTTPClient http;
-    WiFiClient client;
-    String baseUrl;
+    static const size_t FIELD_COUNT = 1 + 3 * P1_PHASE_POWER + 3 * P1_VOLTAGE + 2 * P1_TOTALS;
+
+    AsyncHttpClient http;
     float lastImportPower;
     float lastExportPower;
-    unsigned long lastReadTime;
-    const unsigned long READ_INTERVAL = 1000;
-    const unsigned long HTTP_TIMEOUT = 5000;
+    MonoTime lastReadTime;
+    MonoTime readInterval = 1 * MONO_SECOND; // Set by the poll controller
+    static const size_t RESPONSE_BUFFER_SIZE = 2048; // Headers + full /api/v1/data body
     bool lastReadSuccess;
+    Extras lastExtras;
     bool getPowerData(float &importPower, float &exportPower);
-    bool makeRequest(const String &endpoint, const String &method, const String &payload = "");
+    static const JsonDocument &fieldFilter();
 
 public:
     HomeP1Device(const char *ip);
-    void update();
+    bool update(); // Never blocks, true when a reading completed (or failed) on this call
+    void setReadInterval(MonoTime interval) { readInterval = interval; }
     float getCurrentImport() const;
     float getCurrentExport() const;
     float getNetPower() const;
     bool isConnected() const;
+    const Extras &getExtras() const { return lastExtras; }
 };
 
 #endif
\ No newline at end of file
@@ -2,34 +2,81 @@
 #define HOME_SOCKET_DEVICE_H
 
 #include <Arduino.h>
-#include <HTTPClient.h>
 #include <ArduinoJson.h>
-#include <WiFiClient.h>
+#include "AsyncHttpClient.h"
 
+// A HomeWizard energy socket. The state we want (desired) is kept apart
+// from the state the socket reported (confirmed): setState() only records
+// the wish, a PUT is sent when it differs from what the socket has or is
+// being told, and a GET straight after the PUT confirms it. Repeated
+// setState() calls before that cost nothing.
 class HomeSocketDevice
 {
+public:
+    struct CommandStats
+    {
+        uint32_t commands = 0;   // setState() calls
+        uint32_t coalesced = 0;  // Already the desired or confirmed state, no PUT
+        uint32_t writes = 0;     // PUTs sent
+        uint32_t mismatches = 0; // Verify read another state, written again
+        uint32_t abandoned = 0;  // Gave up after MAX_WRITE_ATTEMPTS
+        uint32_t confirmed = 0;  // Commands verified by a GET
+        uint32_t lastLatencyMs = 0; // setState() to confirming GET
+        uint32_t maxLatencyMs = 0;
+        uint32_t latencySumMs = 0;
+    };
+
 private:
-    HTTPClient http;
-    WiFiClient client;
-    String baseUrl;
-    bool lastKnownState;
-    unsigned long lastReadTime;
-    const unsigned long READ_INTERVAL = 1000;
+    static const uint8_t MAX_WRITE_ATTEMPTS = 3;
+
+    enum Request : uint8_t
+    {
+        REQUEST_NONE,
+        REQUEST_READ,   // Routine GET
+        REQUEST_WRITE,  // PUT of desiredState
+        REQUEST_VERIFY  // GET right after the PUT
+    };
+
+    AsyncHttpClient http;
+    uint8_t number; // From 1, as rules and traces count sockets
+    bool lastKnownState; // Confirmed by the last GET
+    bool stateKnown;
+    MonoTime lastReadTime;
+    MonoTime readInterval = 5 * MONO_SECOND; // Set by the poll controller
+    static const size_t RESPONSE_BUFFER_SIZE = 512;
     bool lastReadSuccess;
 
     int consecutiveFailures;
-    String deviceIP; // Store IP for better logging
-    bool makeHttpRequest(const String &endpoint, const String &method, const String &payload, String &response);
 
-    unsigned long lastLogTime; // For controlling log frequency
+    bool hasDesired;   // A command not confirmed yet
+    bool desiredState;
+    bool writeNeeded;  // desiredState still has to be PUT
+    bool verifyNeeded; // PUT done, confirming GET not sent yet
+    uint8_t writeAttempts;
+    MonoTime commandStart;
+    Request inFlight;
+    bool inFlightState; // What the PUT in flight asks for
+    CommandStats stats;
+
+    MonoTime lastLogTime; // For controlling log frequency
+    bool offlineLogged;   // Back online is only worth a line after Offline
+
+    bool handleResponse(bool httpOk);
+    bool parseState();
+    void checkConfirmation();
+    void abandonCommand(bool writeFailed); // Else the socket kept its state
+    void recordResult(bool success);
 
 public:
-    HomeSocketDevice(const char *ip);
-    void update();
-    bool setState(bool state);
-    bool getState();
+    HomeSocketDevice(uint8_t number, const char *ip);
+    bool update();             // Never blocks, true when a read completed or a request failed on this call
+    bool setState(bool state); // Recorded, sent by update() if it changes anything
+    void setReadInterval(MonoTime interval) { readInterval = interval; }
     bool isConnected() const { return consecutiveFailures == 0; }
+    int getConsecutiveFailures() const { return consecutiveFailures; }
     bool getCurrentState() const { return lastKnownState; }
+    bool isCommandPending() const { return hasDesired; }
+    const CommandStats &getCommandStats() const { return stats; }
 };
 
-#endif
\ No newline at end of file
+#endif
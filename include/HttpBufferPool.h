@@ -0,0 +1,62 @@
+// HttpBufferPool.h
+#ifndef HTTP_BUFFER_POOL_H
+#define HTTP_BUFFER_POOL_H
+
+#include <Arduino.h>
+
+// Request and response buffers for the device HTTP clients, allocated once
+// as part of the pool instead of per client. A client takes a buffer when
+// a request starts and gives it back on reset(), so only requests that are
+// actually in flight hold one: a few buffers serve every socket. When all
+// of them are taken the request simply starts on a later polling pass.
+//
+// Only used from the device polling task on core 0. Other tasks may read
+// the statistics, each field is a single aligned word.
+class HttpBufferPool
+{
+public:
+    static const size_t REQUEST_SIZE = 256;
+    static const size_t SMALL_SIZE = 512;  // Socket /api/v1/state, headers included
+    static const size_t LARGE_SIZE = 2048; // P1 /api/v1/data
+    static const uint8_t SMALL_COUNT = 8;
+    static const uint8_t LARGE_COUNT = 2;
+
+    struct Buffer
+    {
+        char request[REQUEST_SIZE];
+        char *response;
+        size_t responseSize;
+        bool inUse;
+    };
+
+    struct Stats
+    {
+        uint32_t acquired = 0;
+        uint32_t exhausted = 0; // No buffer free, request postponed
+        uint8_t inUse = 0;
+        uint8_t peakInUse = 0;
+    };
+
+private:
+    static const uint8_t COUNT = SMALL_COUNT + LARGE_COUNT;
+
+    char smallResponses[SMALL_COUNT][SMALL_SIZE];
+    char largeResponses[LARGE_COUNT][LARGE_SIZE];
+    Buffer buffers[COUNT]; // Small ones first
+    Stats stats;
+
+public:
+    HttpBufferPool();
+
+    // The smallest free buffer holding a responseSize response, nullptr when
+    // none is free (or responseSize is above LARGE_SIZE)
+    Buffer *acquire(size_t responseSize);
+    void release(Buffer *buffer);
+
+    const Stats &getStats() const { return stats; }
+    void printReport() const;
+};
+
+extern HttpBufferPool httpBuffers;
+
+#endif
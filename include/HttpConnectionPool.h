@@ -0,0 +1,102 @@
+// HttpConnectionPool.h
+#ifndef HTTP_CONNECTION_POOL_H
+#define HTTP_CONNECTION_POOL_H
+
+#include <Arduino.h>
+#include "MonoTime.h"
+#include "Metrics.h"
+
+// Keep-alive connections to the devices on the LAN, per host (address and
+// port). AsyncHttpClient takes an idle connection before it connects, and
+// hands it back when the response allowed keep-alive; connections idle for
+// longer than IDLE_TIMEOUT are closed. A device has one request out at a
+// time, so one idle connection per host is enough, and no more than
+// MAX_IDLE are kept in all: lwIP has about 16 sockets, which the web server
+// and its event streams need too. Also keeps per-host connect and latency
+// counters, totals and per-minute figures.
+//
+// Only used from the device polling task on core 0. Other tasks may read
+// the statistics, each field is a single aligned word.
+class HttpConnectionPool
+{
+public:
+    static const uint8_t MAX_HOSTS = 33; // P1 and SocketRegistry::MAX_SOCKETS
+    static const uint8_t MAX_IDLE = 6;   // Kept open over all hosts, the oldest closed first
+    static const MonoTime IDLE_TIMEOUT = 20 * MONO_SECOND;
+
+    struct Stats
+    {
+        uint32_t connects = 0;    // TCP handshakes
+        uint32_t requests = 0;    // Completed, any status code
+        uint32_t reused = 0;      // Requests on a kept connection
+        uint32_t failures = 0;
+        uint32_t reconnects = 0;  // Kept connection found closed, request retried
+        uint32_t latencySumMs = 0; // Wraps, only differences are used
+        uint32_t latencyMaxMs = 0;
+    };
+
+    // The last full minute
+    struct MinuteStats
+    {
+        uint32_t connects = 0;
+        uint32_t requests = 0;
+        uint32_t latencyAvgMs = 0;
+        uint32_t latencyMaxMs = 0;
+    };
+
+private:
+    struct Host
+    {
+        char name[24];
+        uint32_t address;
+        uint16_t port;
+        int idle; // -1 when none
+        MonoTime idleSince;
+        Stats total;
+        Stats minuteStart; // total at the start of the current minute
+        uint32_t minuteLatencyMaxMs;
+        MinuteStats lastMinute;
+        MetricsHistogram latency; // ms
+    };
+
+    Host hosts[MAX_HOSTS];
+    uint8_t hostCount = 0;
+    uint8_t idleCount = 0;
+    MonoTime minuteStart = 0;
+
+    static bool isAlive(int sock);
+    static void closeConnection(int sock);
+    void closeIdle(Host &entry);
+
+public:
+    HttpConnectionPool();
+
+    // Same host given twice gets the same id, -1 when the table is full
+    int addHost(const char *name, uint32_t address, uint16_t port);
+
+    // An idle connection that is still open, or -1: connect yourself
+    int acquire(int host);
+    // Keeps sock for the next request to this host; closes the one kept
+    // before, or the oldest idle one when MAX_IDLE are open
+    void release(int host, int sock);
+
+    void recordConnect(int host);
+    void recordRequest(int host, uint32_t latencyMs, bool reused);
+    void recordFailure(int host);
+    void recordReconnect(int host);
+
+    // Closes stale idle connections and rolls the minute figures
+    void maintain();
+
+    uint8_t getHostCount() const { return hostCount; }
+    const char *getName(int host) const { return hosts[host].name; }
+    const Stats &getStats(int host) const { return hosts[host].total; }
+    const MinuteStats &getLastMinute(int host) const { return hosts[host].lastMinute; }
+    const MetricsHistogram &getLatency(int host) const { return hosts[host].latency; }
+    uint8_t getIdleCount(int host) const { return hosts[host].idle >= 0 ? 1 : 0; }
+    void printReport() const;
+};
+
+extern HttpConnectionPool httpPool;
+
+#endif
@@ -0,0 +1,111 @@
+// Metrics.h
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <Arduino.h>
+#include "MonoTime.h"
+
+class WebServer;
+
+// The exposition is written through this: lines collect in a small buffer
+// on the stack and go out with WebServer::sendContent() at the start of
+// each metric family, or earlier when the buffer is full
+class MetricsOutput
+{
+public:
+    static const size_t BUFFER_SIZE = 1024;
+
+private:
+    WebServer &server;
+    char buffer[BUFFER_SIZE];
+    size_t length = 0;
+
+public:
+    explicit MetricsOutput(WebServer &server) : server(server) {}
+    ~MetricsOutput() { flush(); }
+
+    void appendf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+    void flush();
+};
+
+// Fixed-bucket histogram. record() is a few compares and increments, no
+// locks and no allocation, so it can sit on the hot paths it measures.
+// One task records, any task may read: the counters are single aligned
+// words, only the 64-bit sum can be read torn from the other core.
+class MetricsHistogram
+{
+public:
+    static const uint8_t MAX_BOUNDS = 12;
+
+private:
+    const uint32_t *bounds = nullptr; // Upper bounds, ascending, in the recorded unit
+    uint8_t boundCount = 0;
+    uint32_t counts[MAX_BOUNDS + 1] = {}; // Per bucket, the last one above every bound
+    uint32_t count = 0;
+    uint64_t sum = 0;
+
+public:
+    void init(const uint32_t *upperBounds, uint8_t countOfBounds)
+    {
+        bounds = upperBounds;
+        boundCount = countOfBounds < MAX_BOUNDS ? countOfBounds : MAX_BOUNDS;
+    }
+
+    void record(uint32_t value)
+    {
+        uint8_t bucket = 0;
+        while (bucket < boundCount && value > bounds[bucket])
+            bucket++;
+        counts[bucket]++;
+        count++;
+        sum += value;
+    }
+
+    // Appends name_bucket/_sum/_count lines; scale turns the recorded unit
+    // into the exposed one (1e-6 for us to seconds)
+    void write(MetricsOutput &out, const char *name, const char *labels, double scale) const;
+};
+
+// Counters behind GET /metrics (Prometheus text format). Loop passes and
+// web requests are recorded here; scheduler, heap, device and socket
+// figures are read from where they are already kept when /metrics is asked.
+class Metrics
+{
+public:
+    static const uint8_t MAX_ROUTES = 48;
+
+private:
+    struct Route
+    {
+        char label[24];
+        uint32_t requests;
+        uint64_t totalTime; // us
+    };
+
+    MetricsHistogram loopPass;   // us
+    MetricsHistogram webRequest; // us
+    Route routes[MAX_ROUTES];
+    uint8_t routeCount = 0;
+
+    void writeTasks(MetricsOutput &out) const;
+    void writeDevices(MetricsOutput &out) const;
+    void writeWeb(MetricsOutput &out) const;
+
+public:
+    Metrics();
+
+    void recordLoopPass(MonoTime elapsed) { loopPass.record((uint32_t)elapsed); }
+
+    // Web route id for recordWebRequest(), the same id for the same label,
+    // -1 when the table is full
+    int addRoute(const char *label);
+    void recordWebRequest(int route, MonoTime elapsed);
+
+    // The whole exposition, as the body of a response already started with
+    // CONTENT_LENGTH_UNKNOWN; the caller ends it with sendContent("")
+    void write(WebServer &server) const;
+};
+
+extern Metrics metrics;
+
+#endif
@@ -0,0 +1,33 @@
+// MonoTime.h
+#ifndef MONO_TIME_H
+#define MONO_TIME_H
+
+#include <stdint.h>
+#include <esp_timer.h>
+
+// The one clock for timing: microseconds since boot from the 64-bit
+// esp_timer. It does not wrap (2^63 us is some 292,000 years), so a
+// timestamp can be kept for months and subtracted from monoNow() without
+// the 49.7 day millis() wrap. Store MonoTime, convert to ms/s only for
+// display or where an interface wants them.
+typedef int64_t MonoTime;
+
+static const MonoTime MONO_MS = 1000;
+static const MonoTime MONO_SECOND = 1000 * MONO_MS;
+static const MonoTime MONO_MINUTE = 60 * MONO_SECOND;
+
+inline MonoTime monoNow() { return esp_timer_get_time(); }
+inline MonoTime monoMs(int64_t ms) { return ms * MONO_MS; }
+inline MonoTime monoSeconds(int64_t seconds) { return seconds * MONO_SECOND; }
+
+// Whole ms since a timestamp, for logs and the web pages
+inline uint32_t monoElapsedMs(MonoTime since)
+{
+    MonoTime elapsed = (monoNow() - since) / MONO_MS;
+    return elapsed > (MonoTime)UINT32_MAX ? UINT32_MAX : (uint32_t)elapsed;
+}
+
+// Seconds since boot, the time base of PowerHistory and the uptime records
+inline uint32_t monoUptimeSeconds() { return (uint32_t)(monoNow() / MONO_SECOND); }
+
+#endif
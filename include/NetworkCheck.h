@@ -5,14 +5,15 @@
 #include <Arduino.h>
 #include <WiFi.h>
 #include <ESP32Ping.h>
+#include "MonoTime.h"
 
 class NetworkCheck
 {
 private:
     String deviceIP;
     bool lastKnownState;
-    unsigned long lastCheckTime;
-    const unsigned long CHECK_INTERVAL = 60000; // Check every minute
+    MonoTime lastCheckTime;
+    const MonoTime CHECK_INTERVAL = MONO_MINUTE; // Check every minute
     int consecutiveFailures;
 
     bool pingDevice();
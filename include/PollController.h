@@ -0,0 +1,88 @@
+// PollController.h
+#ifndef POLL_CONTROLLER_H
+#define POLL_CONTROLLER_H
+
+#include <Arduino.h>
+#include "MonoTime.h"
+#include "SocketRegistry.h"
+
+// Picks how often the P1 meter and every socket are read, once a second on
+// core 1; DeviceLink passes the intervals to the polling task.
+//
+//   P1:      1 s near power_on/off_threshold or after a switch command,
+//            2 s normally, doubling to 8 s while the power stays steady,
+//            30 s when it is dark and nothing is exported or switched on.
+//   Sockets: 1 s for a while after a command (to confirm it), 5 s while on
+//            and switched by the built-in logic or a rule, 30 s otherwise.
+//
+// The total is held to a budget of requests per minute (config.json
+// "poll_budget_per_min"): when the plan is over it, every interval is
+// stretched by the same factor.
+class PollController
+{
+public:
+    enum Reason : uint8_t
+    {
+        REASON_NORMAL,
+        REASON_THRESHOLD, // Export close to a switching threshold
+        REASON_COMMAND,   // Just switched
+        REASON_STEADY,    // Power has not moved for a while
+        REASON_DARK,      // Night, no export
+        REASON_ACTIVE,    // Socket on and under automatic control
+        REASON_IDLE       // Socket nothing is switching
+    };
+
+    static const uint32_t FAST_MS = 1000;
+    static const uint32_t P1_NORMAL_MS = 2000;
+    static const uint32_t P1_STEADY_MAX_MS = 8000;
+    static const uint32_t SOCKET_ACTIVE_MS = 5000;
+    static const uint32_t IDLE_MS = 30000;
+    static const uint16_t DEFAULT_BUDGET = 120; // Requests per minute
+
+private:
+    static const MonoTime COMMAND_WINDOW = 30 * MONO_SECOND;
+    static const int THRESHOLD_BAND_W = 200; // "Near" a threshold
+    static const int STEADY_W = 50;          // Change that still counts as steady
+    static const uint8_t STEADY_SAMPLES = 10; // Per doubling of the interval
+    static const int DARK_LUX = 10;
+
+    uint16_t budget = DEFAULT_BUDGET;
+    uint32_t p1Interval = FAST_MS;
+    Reason p1Reason = REASON_NORMAL;
+    uint32_t socketInterval[SocketRegistry::MAX_SOCKETS];
+    Reason socketReason[SocketRegistry::MAX_SOCKETS];
+    uint16_t stretch = 100; // Percent, above 100 when over budget
+    uint32_t plannedPerMinute = 0;
+
+    // Steady detection on the P1 samples
+    MonoTime lastSampleTime = 0;
+    float steadyPower = 0;
+    uint16_t steadySamples = 0;
+
+    bool recentCommand(int index, MonoTime now) const;
+    void planP1(MonoTime now);
+    void planSocket(int index, MonoTime now);
+    void applyBudget(uint8_t socketCount);
+
+public:
+    PollController();
+    void setBudget(uint16_t requestsPerMinute)
+    {
+        if (requestsPerMinute > 0)
+            budget = requestsPerMinute;
+    }
+    void update(); // Once a second
+
+    uint16_t getBudget() const { return budget; }
+    uint32_t getPlannedPerMinute() const { return plannedPerMinute; }
+    uint16_t getStretch() const { return stretch; }
+    uint32_t getP1Interval() const { return p1Interval; }
+    Reason getP1Reason() const { return p1Reason; }
+    uint32_t getSocketInterval(int index) const { return socketInterval[index]; }
+    Reason getSocketReason(int index) const { return socketReason[index]; }
+    static const char *reasonName(Reason reason);
+};
+
+extern PollController pollController;
+
+#endif
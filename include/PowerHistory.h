@@ -0,0 +1,88 @@
+// PowerHistory.h
+#ifndef POWER_HISTORY_H
+#define POWER_HISTORY_H
+
+#include <Arduino.h>
+
+// Fixed-size P1 power history in three tiers, fed with every P1 sample:
+//   SECONDS   1 s values           for 10 minutes
+//   MINUTES   1 min min/avg/max    for 24 hours
+//   QUARTERS  15 min min/avg/max   for 30 days
+// Values are net power (import positive, export negative) in whole watts,
+// stored as int16 arrays per field. Each tier is a ring indexed by absolute
+// bucket number (time / resolution), so a gap in the samples simply leaves
+// NO_DATA slots behind. The whole store is about 27 KB and never allocates.
+class PowerHistory
+{
+public:
+    enum Tier : uint8_t
+    {
+        SECONDS,
+        MINUTES,
+        QUARTERS,
+        TIER_COUNT
+    };
+
+    static const int16_t NO_DATA = INT16_MIN;
+
+    struct Aggregate
+    {
+        float minW;
+        float avgW;
+        float maxW;
+        uint32_t buckets; // Buckets with data that went into the result, 0 = no data
+    };
+
+private:
+    static const uint16_t SECOND_SLOTS = 600;
+    static const uint16_t MINUTE_SLOTS = 1440;
+    static const uint16_t QUARTER_SLOTS = 2880;
+
+    struct TierState
+    {
+        uint32_t resolution; // Seconds per bucket
+        uint16_t slots;
+        int16_t *minW; // The SECONDS tier points all three at the same array
+        int16_t *avgW;
+        int16_t *maxW;
+        bool started;
+        uint32_t lastBucket; // Bucket the newest sample went into
+        int32_t sum;         // Open bucket
+        uint16_t count;
+        int16_t low;
+        int16_t high;
+    };
+
+    int16_t seconds[SECOND_SLOTS];
+    int16_t minuteMin[MINUTE_SLOTS];
+    int16_t minuteAvg[MINUTE_SLOTS];
+    int16_t minuteMax[MINUTE_SLOTS];
+    int16_t quarterMin[QUARTER_SLOTS];
+    int16_t quarterAvg[QUARTER_SLOTS];
+    int16_t quarterMax[QUARTER_SLOTS];
+    TierState tiers[TIER_COUNT];
+
+    void addToTier(TierState &tier, uint32_t now, int16_t watts);
+    bool inRange(const TierState &tier, uint32_t bucket) const;
+
+public:
+    PowerHistory();
+
+    // now: seconds on a monotonic clock, watts: net power
+    void add(uint32_t now, float watts);
+    void clear();
+
+    // Copies the newest count buckets up to and including now, oldest first.
+    // Any output may be nullptr; buckets without samples read NO_DATA.
+    size_t getSeries(Tier tier, uint32_t now, size_t count,
+                     int16_t *minOut, int16_t *avgOut, int16_t *maxOut) const;
+
+    // Min/avg/max over the last seconds, from the finest tier that covers it
+    Aggregate aggregate(uint32_t now, uint32_t seconds) const;
+
+    uint32_t getResolution(Tier tier) const { return tiers[tier].resolution; }
+    uint16_t getSlots(Tier tier) const { return tiers[tier].slots; }
+    static const char *getTierName(Tier tier);
+};
+
+#endif
@@ -0,0 +1,206 @@
+// RuleProgram.h
+#ifndef RULE_PROGRAM_H
+#define RULE_PROGRAM_H
+
+#include <Arduino.h>
+#include "RuleTimers.h"
+
+// Bytecode of a compiled rule file. Every rule is a postfix program over an
+// int16 stack that leaves one value: > 0 means the condition holds. Time
+// literals, weekday names and the like are resolved by the compiler, so the
+// VM only ever sees integers.
+//
+// AND/OR chains short-circuit: the compiler orders the terms cheapest first
+// and jumps to the end of the chain as soon as the outcome is known, so a
+// ping is only sent when the time window and the light level already agree.
+enum RuleOp : uint8_t
+{
+    RULE_OP_PUSH, // int16 operand (little-endian)
+    RULE_OP_CALL, // function id, argument count
+    RULE_OP_AND,  // Eager, both operands already on the stack
+    RULE_OP_OR,
+    RULE_OP_NOT,
+    RULE_OP_JUMP_IF_FALSE, // uint16 forward offset; top <= 0: top = 0 and jump, else pop
+    RULE_OP_JUMP_IF_TRUE,  // uint16 forward offset; top > 0: top = 1 and jump, else pop
+    RULE_OP_BOOL           // top = top > 0, ends a short-circuit chain
+};
+
+enum RuleFunction : uint8_t
+{
+    RULE_FN_AFTER,          // (minuteOfDay)
+    RULE_FN_BEFORE,         // (minuteOfDay)
+    RULE_FN_BETWEEN,        // (start, end), may cross midnight
+    RULE_FN_WEEKDAY,        // (dayMask), bit 0 = Sunday
+    RULE_FN_LIGHT_ABOVE,    // (lux)
+    RULE_FN_LIGHT_BELOW,    // (lux)
+    RULE_FN_EXPORT_ABOVE,   // (W)
+    RULE_FN_EXPORT_BELOW,   // (W)
+    RULE_FN_IMPORT_ABOVE,   // (W)
+    RULE_FN_IMPORT_BELOW,   // (W)
+    RULE_FN_AVG_EXPORT_ABOVE, // (W, minutes), from the power history
+    RULE_FN_PING_FOUND,     // ()
+    RULE_FN_PING_NOT_FOUND, // ()
+    RULE_FN_IS_ON,          // (socket)
+    RULE_FN_IS_OFF,         // (socket)
+    RULE_FN_ON_FOR,         // (socket, minutes)
+    RULE_FN_OFF_FOR,        // (socket, minutes)
+    RULE_FN_TURN_UNTIL,     // (slot, onCondition, offCondition), a latch timer
+    RULE_FN_DELAY,          // (slot, trigger), a 5 minute one-shot
+    RULE_FN_ONE_SHOT,       // (slot, trigger, seconds)
+    RULE_FN_RETRIGGER,      // (slot, input, seconds)
+    RULE_FN_MIN_ON,         // (slot, input, seconds)
+    RULE_FN_MIN_OFF,        // (slot, input, seconds)
+    RULE_FN_COUNT
+};
+
+struct RuleFunctionInfo
+{
+    const char *name; // Lower case
+    uint8_t function;
+    uint8_t args;
+};
+
+// Every name the compiler accepts, including the older spellings from the
+// C++ API and the README (turnOnInbetween, solarAbove, ...)
+extern const RuleFunctionInfo RULE_FUNCTIONS[];
+extern const size_t RULE_FUNCTION_COUNT;
+
+// Relative evaluation cost per RuleFunction, used to order chain terms.
+// RULE_COST_STATEFUL marks functions that update a memory slot: skipping
+// them would change what they remember, so they are never short-circuited.
+static const uint8_t RULE_COST_STATEFUL = 0x80;
+extern const uint8_t RULE_FUNCTION_COSTS[RULE_FN_COUNT];
+
+// Inputs a rule reads. The compiler records them per rule, and the engine
+// only runs a rule again when one of its inputs changed since the last pass.
+enum RuleInput : uint8_t
+{
+    RULE_INPUT_CLOCK = 0x01,    // Minute of the day, weekday
+    RULE_INPUT_LIGHT = 0x02,    // BH1750
+    RULE_INPUT_POWER = 0x04,    // P1 import/export and the power history
+    RULE_INPUT_PRESENCE = 0x08, // Phone ping
+    RULE_INPUT_SOCKETS = 0x10,  // Socket on/off
+    RULE_INPUT_TIMERS = 0x20,   // A rule timer ran out or a one-shot was read
+    RULE_INPUT_SECONDS = 0x40,  // Every pass: on/off durations
+    RULE_INPUT_ALL = 0x7F
+};
+extern const uint8_t RULE_FUNCTION_INPUTS[RULE_FN_COUNT];
+
+struct Rule
+{
+    uint8_t turnOn; // 1 = turnOn(socket) = ..., 0 = turnOff(socket) = ...
+    uint8_t socket; // 1-based, as written in the rule
+    uint8_t inputs; // RuleInput bits of every function in the rule
+    uint16_t start; // Offset into RuleProgram::code
+    uint16_t length;
+    uint16_t line;  // Source line, for messages
+};
+
+struct RuleProgram
+{
+    static const size_t MAX_CODE = 1024;
+    static const uint8_t MAX_RULES = 24;
+    static const uint8_t STACK_DEPTH = 16;
+
+    static const uint8_t MAX_TIMER_NAME = 12;
+
+    uint8_t code[MAX_CODE];
+    uint16_t codeLength = 0;
+    Rule rules[MAX_RULES];
+    uint8_t ruleCount = 0;
+    RuleTimerType timerTypes[RuleTimers::MAX_TIMERS]; // What each timer slot is used as
+    char timerNames[RuleTimers::MAX_TIMERS][MAX_TIMER_NAME]; // Lower case, "" for a numbered slot
+};
+
+// Recursive-descent compiler for the rule text, one rule per line:
+//
+//   turnOn(2)  = after(17:45) * lightBelow(75)       # '*' / '&' = and
+//   turnOff(2) = lightAbove(75) + after(23:30)        # '+' / '|' = or
+//   turnOn(3)  = between(06:30, 08:00) & isWeekday(WEEKDAYS) & !pingNotFound()
+//
+// Numbers are decimal, 0x.. or 0b..; HH:MM is a minute of the day; 90s, 5m
+// and 2h are durations in seconds; MON..SUN, WEEKDAYS, WEEKEND and EVERYDAY
+// are day masks. '#' and '//' start a comment.
+//
+// The first argument of a timer function (turnUntil, delay, oneShot, ...) is
+// a slot number 0-31 or a name; names get the free slots from 31 down. A
+// slot is one kind of timer for the whole file.
+// Works on a plain char buffer: no String, no sscanf, no allocation.
+class RuleCompiler
+{
+private:
+    enum Token : uint8_t
+    {
+        TOK_END,
+        TOK_NEWLINE,
+        TOK_NUMBER,
+        TOK_IDENT,
+        TOK_LPAREN,
+        TOK_RPAREN,
+        TOK_COMMA,
+        TOK_ASSIGN,
+        TOK_AND,
+        TOK_OR,
+        TOK_NOT,
+        TOK_ERROR
+    };
+
+    const char *end = nullptr;
+    const char *pos = nullptr;
+    uint16_t line = 1;
+    int parenDepth = 0;
+
+    Token token = TOK_END;
+    const char *tokenStart = nullptr;
+    size_t tokenLength = 0;
+    long tokenValue = 0;
+
+    RuleProgram *program = nullptr;
+    int depth = 0;    // Stack depth of the code emitted so far
+    uint8_t inputs = 0; // Of the rule being compiled
+    bool failed = false;
+    char error[80] = "";
+    uint16_t errorLine = 0;
+
+    void next();
+    bool lexNumber();
+    bool identIs(const char *name) const;
+    bool expect(Token expected, const char *what);
+    void fail(const char *message);
+
+    void emit(uint8_t byte);
+    void emitPush(long value);
+    void emitOp(uint8_t op, int pops, int pushes);
+
+    // What the compiler knows about an emitted sub-expression
+    struct Term
+    {
+        uint16_t start;
+        uint16_t length;
+        uint16_t cost;
+        bool stateful;
+    };
+    static const uint8_t MAX_TERMS = 12;  // Per AND/OR chain
+    static const uint8_t MAX_NESTING = 8; // Parentheses inside one rule
+
+    static bool runsBefore(const Term &a, const Term &b);
+    Term makeChain(uint8_t op, Term *terms, uint8_t count);
+    void insertCode(uint16_t at, const uint8_t *bytes, uint16_t count);
+
+    void parseRule();
+    Term parseOr();
+    Term parseAnd();
+    Term parseUnary();
+    Term parsePrimary();
+    Term parseCall(const RuleFunctionInfo &info);
+    bool parseTimerSlot(RuleTimerType type);
+    bool constantValue(long &value) const;
+
+public:
+    // Compiles text into program, false on the first error
+    bool compile(const char *source, size_t length, RuleProgram &output);
+    const char *getError() const { return error; }
+    uint16_t getErrorLine() const { return errorLine; }
+};
+
+#endif
@@ -0,0 +1,89 @@
+// RuleTimers.h
+#ifndef RULE_TIMERS_H
+#define RULE_TIMERS_H
+
+#include <Arduino.h>
+#include "MonoTime.h"
+
+enum RuleTimerType : uint8_t
+{
+    TIMER_UNUSED,
+    TIMER_LATCH,     // turnUntil/latch: set by one condition, cleared by another
+    TIMER_ONE_SHOT,  // delay/oneShot: a trigger starts it, true once when it runs out
+    TIMER_RETRIGGER, // retrigger: true until the period has passed since the input was last true
+    TIMER_MIN_ON,    // minOn: follows the input, but stays on for at least the period
+    TIMER_MIN_OFF    // minOff: follows the input, but stays off for at least the period
+};
+
+// Timer slots for the rule engine, kept in a hierarchical timing wheel with
+// one second ticks: three levels of 64 buckets cover 64 s, 68 min and 72 h.
+// A running timer sits in the bucket of its expiry tick (or the coarser
+// bucket it cascades down from), so advance() only touches the buckets of
+// the ticks that passed and the timers that actually run out. The rule
+// primitives just read their slot, so a pass costs the same for 3 timers
+// as for 32.
+class RuleTimers
+{
+public:
+    static const uint8_t MAX_TIMERS = 32;
+
+    struct Info
+    {
+        RuleTimerType type;
+        bool output;
+        bool running;
+        uint32_t period;    // Seconds
+        uint32_t remaining; // Seconds until it runs out, 0 when idle
+    };
+
+private:
+    static const uint8_t LEVELS = 3;
+    static const uint8_t BUCKET_BITS = 6;
+    static const uint8_t BUCKETS = 1 << BUCKET_BITS;
+    static const uint8_t NONE = 0xFF;
+    static const uint32_t MAX_TICKS = (1UL << (BUCKET_BITS * LEVELS)) - 1;
+
+    struct Timer
+    {
+        RuleTimerType type;
+        bool output;
+        bool running; // In the wheel
+        bool fired;   // One-shot ran out and was not read yet
+        uint32_t period;
+        uint32_t expiry; // Tick
+        uint8_t next;
+        uint8_t prev;
+        uint8_t bucket; // LEVEL * BUCKETS + index, NONE when not in the wheel
+    };
+
+    Timer timers[MAX_TIMERS];
+    uint8_t heads[LEVELS * BUCKETS];
+    uint32_t currentTick = 0;
+    bool started = false;
+    bool changed = false; // A timer ran out or a one-shot was read since advance()
+
+    void insert(uint8_t id);
+    void unlink(uint8_t id);
+    void start(uint8_t id, uint32_t seconds);
+    void cascade(uint8_t level);
+    void expire(uint8_t id);
+    Timer *use(int slot, RuleTimerType type, int seconds);
+
+public:
+    RuleTimers() { reset(); }
+
+    void reset();                                // All slots unused and idle
+    void configure(int slot, RuleTimerType type); // Keeps the slot only if the type is unchanged
+    bool advance(MonoTime now);                  // Once per pass, true when a timer output may have changed
+
+    int latch(int slot, int set, int clear);
+    int oneShot(int slot, int trigger, int seconds);
+    int retrigger(int slot, int input, int seconds);
+    int minOn(int slot, int input, int seconds);
+    int minOff(int slot, int input, int seconds);
+
+    bool getInfo(int slot, Info &info) const; // False for an unused slot
+    static const char *typeName(RuleTimerType type);
+};
+
+#endif
@@ -3,31 +3,47 @@
 #define SIMPLE_RULE_ENGINE_H
 
 #include "GlobalVars.h"
+#include "RuleProgram.h"
+
+#define RULES_FILE "/rules.txt" // On SPIFFS, also editable through /rules
 
 class SimpleRuleEngine
 {
     struct SocketState
     {
         bool currentState;             // Current on/off state
-        unsigned long lastStateChange; // When the current state started (millis)
+        MonoTime lastStateChange;      // When the current state started
         int lastChangeHour;            // Hour of last state change (for time persistence)
         int lastChangeMinute;          // Minute of last state change
-        bool stateChangeProcessed;     // Flag to prevent multiple triggers in same state
     };
 
 private:
     float current_lux;
-    static const int MEMORY_SLOTS = 32;  // used in TurnUntil
-    bool memory[MEMORY_SLOTS] = {false}; // used in TurnUntil
+    static const int DELAY_SECONDS = 5 * 60; // Delay() without a period
+    RuleTimers timers;                       // TurnUntil, Delay and the other timer functions
 
-    static const int MAX_SOCKETS = 3;
+    static const int MAX_SOCKETS = DeviceLink::MAX_SOCKETS;
     SocketState socketStates[MAX_SOCKETS];
-    HomeSocketDevice *sockets[MAX_SOCKETS]; // Array instead of individual pointers
 
-    // Helper function to get socket and validate
-    HomeSocketDevice *getSocket(int socket_number);
+    // Compiled rules from SPIFFS, run by evaluate()
+    RuleProgram program;
+    int16_t results[RuleProgram::MAX_RULES]; // Last result of every rule
+    uint8_t changedInputs = RULE_INPUT_ALL;  // RuleInput bits since the last pass
+    uint16_t lastMinuteOfDay = 0xFFFF;
+    uint8_t lastWeekday = 0xFF;
+    unsigned long rulesRun = 0;
+    unsigned long rulesSkipped = 0;          // Inputs unchanged, cached result used
+    char lastError[80] = "";
+    bool trace = false; // Print every primitive result (slow, for debugging rules)
+
+    // Helper function to validate a socket number (1-based)
+    bool hasSocket(int socket_number);
+    bool socketIsOn(int socket_number);
     void updateSocketDuration(int socket_number);
 
+    int run(const Rule &rule);
+    int callFunction(uint8_t function, const int16_t *args);
+
 public:
     // In the header:
 
@@ -49,24 +65,50 @@ public:
 public:
     SimpleRuleEngine()
     {
-        // Initialize socket pointers to nullptr
         for (int i = 0; i < MAX_SOCKETS; i++)
         {
-            sockets[i] = nullptr;
-            socketStates[i] = {false, 0, 0, 0, true};
+            socketStates[i] = {false, 0, 0, 0};
         }
     }
+    static const size_t MAX_RULES_SIZE = 4096; // Bytes of rule text
+
+    // Rule text: compiled once, then evaluate() runs the bytecode every tick
+    bool loadRules(const char *path);
+    bool compileRules(const char *text, size_t length);
+    void evaluate();
+    bool controlsSocket(int socket_number) const; // A rule targets this socket (1-based)
+    // Producers report new values here (RuleInput bits); the clock and the
+    // timers are checked by evaluate() itself
+    void inputChanged(uint8_t inputs) { changedInputs |= inputs; }
+    unsigned long getRulesRun() const { return rulesRun; }
+    unsigned long getRulesSkipped() const { return rulesSkipped; }
+    uint8_t getRuleCount() const { return program.ruleCount; }
+    uint16_t getCodeSize() const { return program.codeLength; }
+    const RuleTimers &getTimers() const { return timers; }
+    const char *getTimerName(int slot) const { return program.timerNames[slot]; }
+    const char *getLastError() const { return lastError; }
+    void setTrace(bool enabled) { trace = enabled; }
+    static int parseTime(const char *timeStr); // "HH:MM" to minute of day, -1 if invalid
+
     void updateLightLevel();
     int lightSensorAbove(int lux_value);
     int lightSensorBelow(int lux_value);
     int pingFound();
     int pingNotFound();
+    int exportAbove(int watts);
+    int exportBelow(int watts);
+    int importAbove(int watts);
+    int importBelow(int watts);
+    int avgExportAbove(int watts, int minutes);
     void turnOn(int socket_number, int condition);
     void turnOff(int socket_number, int condition);
 
     // Time functions
     int after(const char *timeStr);
     int before(const char *timeStr);
+    int after(int minuteOfDay);
+    int before(int minuteOfDay);
+    int between(int startMinute, int endMinute);
     int isOn(int socket_number);
     int isOff(int socket_number);
 
@@ -81,15 +123,26 @@ public:
     int hasBeenOnFor(int socket_number, int minutes);
     int hasBeenOffFor(int socket_number, int minutes);
 
-    int setMem(int slot, unsigned long value);
-    int readMem(int slot);
-    int Delay(int memSlot, int triggerFunction);
-
-    // Logical operators
+    // Timers, slot 0-31; see RuleTimers.h for what each kind does
+    int Delay(int memSlot, int triggerFunction); // One-shot of DELAY_SECONDS
+    int oneShot(int slot, int trigger, int seconds) { return timers.oneShot(slot, trigger, seconds); }
+    int retrigger(int slot, int input, int seconds) { return timers.retrigger(slot, input, seconds); }
+    int minOn(int slot, int input, int seconds) { return timers.minOn(slot, input, seconds); }
+    int minOff(int slot, int input, int seconds) { return timers.minOff(slot, input, seconds); }
+
+    // Logical operators. The int forms get both sides already evaluated;
+    // the lazy forms take callables and only run the right side when the
+    // left one does not decide the outcome, so put the cheap check first:
+    //   lazyAND([&] { return after(17 * 60); }, [&] { return pingFound(); })
     int OR(int func1, int func2);
     int AND(int func1, int func2);
     int NOT(int func);
 
+    template <typename Left, typename Right>
+    int lazyOR(Left left, Right right) { return (left() > 0 || right() > 0) ? 1 : 0; }
+    template <typename Left, typename Right>
+    int lazyAND(Left left, Right right) { return (left() > 0 && right() > 0) ? 1 : 0; }
+
     int TurnUntil(int memoryIndex, int turnOnCondition, int turnOffCondition);
 };
 
@@ -0,0 +1,88 @@
+// SocketRegistry.h
+#ifndef SOCKET_REGISTRY_H
+#define SOCKET_REGISTRY_H
+
+#include <Arduino.h>
+#include <ArduinoJson.h>
+#include "MonoTime.h"
+#include "HomeSocketDevice.h"
+
+// Every socket from config.json, up to MAX_SOCKETS. A socket is known by its
+// index everywhere (DeviceLink, rules as index + 1, web, display, history).
+// Per-socket state is kept as one array per field, so the timing checks are
+// plain loops over a few hundred bytes; on/off and "forced off" are bitmasks.
+//
+//   "sockets": [
+//       { "name": "Boiler", "ip": "192.168.178.172", "logic": "surplus" },
+//       { "name": "Garden", "ip": "192.168.178.175", "logic": "evening", "after": "17:45", "lux": 75 }
+//   ]
+//
+// The old "socket_1".."socket_3" keys still load, with the logic the three
+// switches had before: surplus, evening 17:45 / 75 lux, evening 17:30 / 50 lux.
+class SocketRegistry
+{
+public:
+    static const uint8_t MAX_SOCKETS = 32; // Bit per socket in a uint32_t
+    static const uint8_t MAX_NAME = 16;
+    // ArduinoJson space for one "sockets" entry parsed from a stream: the
+    // object, and the copied strings (keys, a name that may be longer than
+    // MAX_NAME, "ip:port", logic and after)
+    static const size_t JSON_ENTRY_SIZE = JSON_OBJECT_SIZE(5) + 24 + 32 + 24 + 8 + 8;
+    // The whole "sockets" array
+    static const size_t JSON_SIZE = JSON_ARRAY_SIZE(MAX_SOCKETS) + MAX_SOCKETS * JSON_ENTRY_SIZE;
+
+    // Built-in switching, used when no rule targets the socket
+    enum Logic : uint8_t
+    {
+        LOGIC_NONE,    // Manual or rules only
+        LOGIC_SURPLUS, // On above power_on_threshold export, off below power_off_threshold
+        LOGIC_EVENING  // On after a time of day when it gets dark, off when light again
+    };
+
+private:
+    uint8_t count = 0;
+
+    // Configuration
+    String addresses[MAX_SOCKETS];
+    char names[MAX_SOCKETS][MAX_NAME];
+    Logic logic[MAX_SOCKETS];
+    uint16_t afterMinute[MAX_SOCKETS]; // LOGIC_EVENING: minute of day
+    uint16_t darkLux[MAX_SOCKETS];     // LOGIC_EVENING: on below, off at or above
+
+    // Control state
+    HomeSocketDevice *devices[MAX_SOCKETS] = {};
+    MonoTime lastChange[MAX_SOCKETS] = {};
+    uint32_t forcedOff = 0; // Switched off by the max on time, min_off_time applies
+
+    bool add(const char *address, const char *name, Logic type, uint16_t after, uint16_t lux);
+    static Logic parseLogic(const char *text);
+    static int parseTime(const char *text);
+
+public:
+    // Reads "sockets" (or the legacy keys) from the parsed config.json
+    void load(JsonObjectConst config);
+    // Creates the HomeSocketDevice objects, once WiFi is up
+    void createDevices();
+
+    uint8_t getCount() const { return count; }
+    HomeSocketDevice *const *getDevices() const { return devices; }
+    const char *getName(int index) const { return names[index]; }
+    const String &getAddress(int index) const { return addresses[index]; }
+    Logic getLogic(int index) const { return logic[index]; }
+    uint16_t getAfterMinute(int index) const { return afterMinute[index]; }
+    uint16_t getDarkLux(int index) const { return darkLux[index]; }
+    static const char *logicName(Logic type);
+
+    // Timing, all times monotonic
+    void resetTimes(MonoTime now);
+    MonoTime getLastChange(int index) const { return lastChange[index]; }
+    bool canChange(int index, bool newState, MonoTime now, MonoTime minOnTime, MonoTime minOffTime);
+    void markChanged(int index, MonoTime now) { lastChange[index] = now; }
+    // Of the sockets in onMask, those on for longer than maxOnTime. They are
+    // marked forced off and their change time restarts at now.
+    uint32_t expireMaxOnTime(uint32_t onMask, MonoTime now, MonoTime maxOnTime);
+};
+
+extern SocketRegistry socketRegistry;
+
+#endif
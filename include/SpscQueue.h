@@ -0,0 +1,59 @@
+// SpscQueue.h
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <stddef.h>
+
+// Fixed-size single-producer/single-consumer ring buffer.
+// Exactly one task may call push() and exactly one other task may call pop();
+// no locks and no allocation, so it is safe between the two ESP32 cores.
+// Only depends on <atomic>, so the same header builds on the host.
+template <typename T, size_t Capacity>
+class SpscQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0,
+                  "SpscQueue capacity must be a power of two");
+
+private:
+    T items[Capacity];
+    std::atomic<size_t> head{0}; // Next slot to write, owned by the producer
+    std::atomic<size_t> tail{0}; // Next slot to read, owned by the consumer
+    std::atomic<unsigned long> dropped{0};
+
+public:
+    bool push(const T &item)
+    {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) >= Capacity)
+        {
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false; // Full
+        }
+        items[h & (Capacity - 1)] = item;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    bool pop(T &item)
+    {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t == head.load(std::memory_order_acquire))
+        {
+            return false; // Empty
+        }
+        item = items[t & (Capacity - 1)];
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+
+    size_t size() const
+    {
+        return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+    }
+
+    bool empty() const { return size() == 0; }
+    unsigned long getDropped() const { return dropped.load(std::memory_order_relaxed); }
+};
+
+#endif
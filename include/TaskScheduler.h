@@ -0,0 +1,64 @@
+// TaskScheduler.h
+#ifndef TASK_SCHEDULER_H
+#define TASK_SCHEDULER_H
+
+#include <Arduino.h>
+#include "MonoTime.h"
+
+// Cooperative deadline scheduler: every task has a period, a priority and a
+// run-time budget. runNext() always picks the task whose next due time is the
+// earliest (min-heap), so a slow task can never hold the others back by more
+// than its own run time.
+class TaskScheduler
+{
+public:
+    typedef void (*TaskCallback)();
+
+    struct TaskStats
+    {
+        unsigned long runs;
+        unsigned long overruns;      // Runs that took longer than the budget
+        unsigned long lastLateness;  // ms between due time and actual start
+        unsigned long maxLateness;
+        uint64_t totalLateness;      // For the average
+        unsigned long lastRunTime;   // ms spent inside the callback
+        unsigned long maxRunTime;
+        uint64_t totalRunTime;       // us, for /metrics
+    };
+
+private:
+    struct Task
+    {
+        const char *name;
+        TaskCallback callback;
+        MonoTime period;        // Between runs
+        uint8_t priority;       // Lower value wins when two tasks are due together
+        MonoTime budget;        // Expected worst-case run time
+        MonoTime nextDue;
+        TaskStats stats;
+    };
+
+    static const int MAX_TASKS = 16;
+    Task tasks[MAX_TASKS];
+    uint8_t heap[MAX_TASKS]; // Task indices, ordered on nextDue then priority
+    int taskCount = 0;
+
+    bool runsBefore(uint8_t a, uint8_t b) const;
+    void siftUp(int pos);
+    void siftDown(int pos);
+
+public:
+    // Returns the task id, or -1 when the task table is full. Times in ms.
+    int addTask(const char *name, TaskCallback callback, unsigned long period,
+                uint8_t priority, unsigned long budget, unsigned long firstDelay = 0);
+
+    bool runNext();                     // Runs the most urgent task if due, false when idle
+    unsigned long timeUntilNext() const; // ms until the next task is due (0 = overdue)
+
+    int getTaskCount() const { return taskCount; }
+    const char *getTaskName(int id) const { return tasks[id].name; }
+    const TaskStats &getStats(int id) const { return tasks[id].stats; }
+    void printReport() const;
+};
+
+#endif
@@ -3,22 +3,87 @@
 #define TIME_SYNC_H
 
 #include <Arduino.h>
+#include <esp_timer.h>
+#include "TimeZone.h"
 #include <time.h>
 #include <WiFi.h>
 
+// Local time as seen by one scheduler pass. Captured once by
+// TimeSync::tick() so rules, switch logic and the display all agree on the
+// time and none of them converts it again.
+struct TimeContext
+{
+    time_t epoch;          // UTC seconds, 0 while the clock is not set
+    uint16_t minuteOfDay;  // 0-1439, 12:00 while the clock is not set
+    uint8_t hour;          // 0-23
+    uint8_t minute;        // 0-59
+    uint8_t second;        // 0-59
+    uint8_t weekday;       // 0 = Sunday, 1 = Monday, ..., 6 = Saturday
+    uint8_t weekdayBit;    // 1 << weekday, 0 while the clock is not set
+    uint8_t isoWeek;       // 1-53
+    uint8_t day;           // 1-31
+    uint8_t month;         // 1-12
+    uint16_t year;         // Full year (e.g., 2024)
+    bool dst;              // Summer time
+    bool valid;            // Clock synchronised
+};
+
+// Wall clock that never blocks. SNTP runs in the background (lwIP) and a
+// small state machine, driven by update(), watches for the first valid time
+// and restarts SNTP with backoff while no server answers. Once synced the
+// time is the 64-bit monotonic clock plus an epoch offset, re-anchored to
+// the system clock every ANCHOR_INTERVAL so SNTP corrections come through.
+// Local fields are derived from that with integer arithmetic and the
+// CET/CEST transition table in TimeZone.h.
 class TimeSync
 {
+public:
+    enum State : uint8_t
+    {
+        WAITING_FOR_WIFI,
+        SYNCING,
+        SYNCED
+    };
+
 private:
     const char *ntpServer = "nl.pool.ntp.org";    // Netherlands NTP pool
     const char *ntpServer2 = "0.nl.pool.ntp.org"; // Specific Dutch server
     const char *ntpServer3 = "1.nl.pool.ntp.org"; // Backup Dutch server
-    const long gmtOffset_sec = 3600;              // Netherlands is UTC+1
-    const int daylightOffset_sec = 3600;          // DST when applicable
+
+    static const time_t MIN_VALID_EPOCH = 1700000000;   // 2023-11-14; anything earlier is the unset clock
+    static const uint32_t FIRST_RETRY_MS = 15000;       // Wait for an answer before restarting SNTP
+    static const uint32_t MAX_RETRY_MS = 600000;        // Backoff limit while NTP is unreachable
+    static const uint32_t ANCHOR_INTERVAL = 3600;       // Seconds between re-reads of the system clock
+
+    State state = WAITING_FOR_WIFI;
     bool timeInitialized = false;
+    uint8_t attempts = 0;
+    int64_t stateSince = 0;            // Monotonic ms
+    uint32_t retryDelay = FIRST_RETRY_MS;
+    int64_t epochOffsetMs = 0;         // Unix ms minus monotonic ms
+    time_t nextAnchor = 0;
+    TimeContext current = {0, 12 * 60, 12, 0, 0, 0, 0, 1, 1, 1, 1970, false, false};
+
+    static int64_t monotonicMs() { return esp_timer_get_time() / 1000; }
+    void startSntp();
+    void anchor();
 
 public:
     TimeSync() {}
-    bool begin();
+    bool begin(); // Starts the sync, returns immediately
+
+    // State machine, call about once a second; never waits for the network
+    void update();
+    State getState() const { return state; }
+    time_t epoch() const; // UTC seconds, 0 while not synced
+
+    // Refreshes the time context; converts only when the second changed
+    void tick();
+    const TimeContext &now() const { return current; }
+    static uint8_t isoWeek(int year, int yearDay, int weekday);
+    static int32_t daysFromCivil(int year, unsigned month, unsigned day);
+    static void civilFromDays(int32_t days, int &year, unsigned &month, unsigned &day);
+
     void getCurrentHourMinute(int &hour, int &minute);
     String getCurrentTime();
     bool isTimeBetween(const char *startTime, const char *endTime);
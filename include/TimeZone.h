@@ -0,0 +1,41 @@
+// TimeZone.h
+// Local time for the Netherlands (CET/CEST) without libc: a table of the
+// UTC instants where the offset changes, generated on the host by
+// tools/timezone/tz_table.cpp, and a binary search over it. No Arduino
+// headers, so the host tools can include it as well.
+#ifndef TIME_ZONE_H
+#define TIME_ZONE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Same zone as a POSIX TZ string, for configTzTime() and the generator:
+// CET (UTC+1), CEST (UTC+2) from the last Sunday of March 02:00 until the
+// last Sunday of October 03:00 local time
+#define TIME_ZONE_POSIX "CET-1CEST,M3.5.0,M10.5.0/3"
+
+static const int32_t TIME_ZONE_STANDARD_OFFSET = 3600; // Seconds east of UTC
+static const int32_t TIME_ZONE_DST_OFFSET = 7200;
+
+#include "TimeZoneTable.h"
+
+// Offset of local time from UTC at the given instant. The table starts with
+// a switch to summer time and alternates, so an odd number of transitions
+// at or before utc means summer time. Outside the table it is winter time.
+inline int32_t timeZoneOffset(int64_t utc, bool &dst)
+{
+    size_t low = 0;
+    size_t high = TIME_ZONE_TRANSITION_COUNT;
+    while (low < high)
+    {
+        size_t middle = (low + high) / 2;
+        if ((int64_t)TIME_ZONE_TRANSITIONS[middle] <= utc)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    dst = (low & 1) != 0;
+    return dst ? TIME_ZONE_DST_OFFSET : TIME_ZONE_STANDARD_OFFSET;
+}
+
+#endif
@@ -0,0 +1,55 @@
+// TimeZoneTable.h
+// Generated by tools/timezone/tz_table.cpp from "CET-1CEST,M3.5.0,M10.5.0/3", do not edit.
+// UTC instants where the offset changes, 2024-2045, starting with summer time.
+#ifndef TIME_ZONE_TABLE_H
+#define TIME_ZONE_TABLE_H
+
+static const uint32_t TIME_ZONE_TRANSITIONS[] = {
+    1711846800, // 2024-03-31 01:00 UTC, CEST
+    1729990800, // 2024-10-27 01:00 UTC, CET
+    1743296400, // 2025-03-30 01:00 UTC, CEST
+    1761440400, // 2025-10-26 01:00 UTC, CET
+    1774746000, // 2026-03-29 01:00 UTC, CEST
+    1792890000, // 2026-10-25 01:00 UTC, CET
+    1806195600, // 2027-03-28 01:00 UTC, CEST
+    1824944400, // 2027-10-31 01:00 UTC, CET
+    1837645200, // 2028-03-26 01:00 UTC, CEST
+    1856394000, // 2028-10-29 01:00 UTC, CET
+    1869094800, // 2029-03-25 01:00 UTC, CEST
+    1887843600, // 2029-10-28 01:00 UTC, CET
+    1901149200, // 2030-03-31 01:00 UTC, CEST
+    1919293200, // 2030-10-27 01:00 UTC, CET
+    1932598800, // 2031-03-30 01:00 UTC, CEST
+    1950742800, // 2031-10-26 01:00 UTC, CET
+    1964048400, // 2032-03-28 01:00 UTC, CEST
+    1982797200, // 2032-10-31 01:00 UTC, CET
+    1995498000, // 2033-03-27 01:00 UTC, CEST
+    2014246800, // 2033-10-30 01:00 UTC, CET
+    2026947600, // 2034-03-26 01:00 UTC, CEST
+    2045696400, // 2034-10-29 01:00 UTC, CET
+    2058397200, // 2035-03-25 01:00 UTC, CEST
+    2077146000, // 2035-10-28 01:00 UTC, CET
+    2090451600, // 2036-03-30 01:00 UTC, CEST
+    2108595600, // 2036-10-26 01:00 UTC, CET
+    2121901200, // 2037-03-29 01:00 UTC, CEST
+    2140045200, // 2037-10-25 01:00 UTC, CET
+    2153350800, // 2038-03-28 01:00 UTC, CEST
+    2172099600, // 2038-10-31 01:00 UTC, CET
+    2184800400, // 2039-03-27 01:00 UTC, CEST
+    2203549200, // 2039-10-30 01:00 UTC, CET
+    2216250000, // 2040-03-25 01:00 UTC, CEST
+    2234998800, // 2040-10-28 01:00 UTC, CET
+    2248304400, // 2041-03-31 01:00 UTC, CEST
+    2266448400, // 2041-10-27 01:00 UTC, CET
+    2279754000, // 2042-03-30 01:00 UTC, CEST
+    2297898000, // 2042-10-26 01:00 UTC, CET
+    2311203600, // 2043-03-29 01:00 UTC, CEST
+    2329347600, // 2043-10-25 01:00 UTC, CET
+    2342653200, // 2044-03-27 01:00 UTC, CEST
+    2361402000, // 2044-10-30 01:00 UTC, CET
+    2374102800, // 2045-03-26 01:00 UTC, CEST
+    2392851600, // 2045-10-29 01:00 UTC, CET
+};
+static const size_t TIME_ZONE_TRANSITION_COUNT = 44;
+
+#endif
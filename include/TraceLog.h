@@ -0,0 +1,91 @@
+// TraceLog.h
+#ifndef TRACE_LOG_H
+#define TRACE_LOG_H
+
+#include <Arduino.h>
+#include <atomic>
+#include "MonoTime.h"
+#include "TraceRecord.h"
+
+// Build-time log level: events above it are compiled out, arguments and all.
+// Set with -DLOG_LEVEL=LOG_LEVEL_DEBUG in build_flags for the rule engine's
+// per-primitive trace (it also needs setTrace(true) at run time).
+#ifndef LOG_LEVEL
+#define LOG_LEVEL LOG_LEVEL_INFO
+#endif
+
+#define TRACE_EVENT_LEVEL(id, level, format) TRACE_LEVEL_##id = level,
+enum TraceEventLevel : uint8_t
+{
+    TRACE_EVENTS(TRACE_EVENT_LEVEL)
+};
+#undef TRACE_EVENT_LEVEL
+
+// TRACE(RULE_TURN_ON, socket) stores the event and its arguments in the
+// trace ring, a few hundred ns instead of a Serial.printf at 87 us per
+// character. The condition is a constant, so below LOG_LEVEL nothing is left.
+#define TRACE(event, ...)                                                        \
+    do                                                                           \
+    {                                                                            \
+        if (TRACE_LEVEL_##event <= LOG_LEVEL)                                    \
+            traceLog.add(TRACE_##event, TRACE_LEVEL_##event, ##__VA_ARGS__);     \
+    } while (0)
+
+// Ring of the last CAPACITY trace records. Any task on either core may add;
+// a slot is claimed with one atomic increment and its sequence is stored
+// last, so a reader can tell a finished record from one being written or
+// overwritten. The text is made later: drainToSerial() prints in idle time,
+// and /trace serves the raw records to tools/trace/trace_decode.
+class TraceLog
+{
+public:
+    static const uint16_t CAPACITY = 128; // Power of two, 4 KB
+
+private:
+    struct Slot
+    {
+        std::atomic<uint32_t> sequence{UINT32_MAX}; // Of the finished record in it
+        TraceRecord record;
+    };
+
+    Slot slots[CAPACITY];
+    std::atomic<uint32_t> head{0}; // Next sequence to hand out
+    uint32_t serialCursor = 0;     // Next sequence to print
+    uint32_t lost = 0;             // Overwritten before they were printed
+
+    void write(uint16_t event, uint8_t level, const uint32_t *args, uint8_t count);
+
+    static uint32_t arg(int value) { return (uint32_t)value; }
+    static uint32_t arg(unsigned value) { return value; }
+    static uint32_t arg(long value) { return (uint32_t)value; }
+    static uint32_t arg(unsigned long value) { return (uint32_t)value; }
+    static uint32_t arg(bool value) { return value ? 1 : 0; }
+    static uint32_t arg(double value)
+    {
+        float f = (float)value;
+        uint32_t bits;
+        memcpy(&bits, &f, sizeof(bits));
+        return bits;
+    }
+
+public:
+    template <typename... Args>
+    void add(uint16_t event, uint8_t level, Args... args)
+    {
+        static_assert(sizeof...(Args) <= TRACE_MAX_ARGS, "Too many trace arguments");
+        const uint32_t values[sizeof...(Args) + 1] = {arg(args)...};
+        write(event, level, values, sizeof...(Args));
+    }
+
+    // Copies a finished record, false when it is gone or not written yet
+    bool read(uint32_t sequence, TraceRecord &record) const;
+    uint32_t getHead() const { return head.load(std::memory_order_acquire); }
+    uint32_t getLost() const { return lost; }
+
+    // Prints up to maxRecords while the UART has room; call from an idle task
+    void drainToSerial(uint8_t maxRecords);
+};
+
+extern TraceLog traceLog;
+
+#endif
@@ -0,0 +1,199 @@
+// TraceRecord.h
+// Binary trace format: every log call stores an event id and its raw
+// arguments, the text is only made when a record is printed. Plain C++ with
+// no Arduino dependencies, so tools/trace can include it on Linux as well.
+#ifndef TRACE_RECORD_H
+#define TRACE_RECORD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <string.h>
+
+#define LOG_LEVEL_NONE 0
+#define LOG_LEVEL_ERROR 1
+#define LOG_LEVEL_WARN 2
+#define LOG_LEVEL_INFO 3
+#define LOG_LEVEL_DEBUG 4
+
+// Every event: id, level, printf format. Arguments are int or float (%d, %u,
+// %x, %c, %f and friends, 'l' allowed), at most TRACE_MAX_ARGS, no strings.
+// Only append to this list: the id is the position, and tools/trace decodes
+// dumps with the same table.
+#define TRACE_EVENTS(X)                                                                   \
+    X(RULE_LIGHT_LEVEL, LOG_LEVEL_DEBUG, "Rules > Light level %.1f lux")                   \
+    X(RULE_LIGHT_ABOVE, LOG_LEVEL_DEBUG, "Rules > Light > %d lux: %d")                     \
+    X(RULE_LIGHT_BELOW, LOG_LEVEL_DEBUG, "Rules > Light < %d lux: %d")                     \
+    X(RULE_AFTER, LOG_LEVEL_DEBUG, "Rules > After %02d:%02d: %d")                          \
+    X(RULE_BEFORE, LOG_LEVEL_DEBUG, "Rules > Before %02d:%02d: %d")                        \
+    X(RULE_BETWEEN, LOG_LEVEL_DEBUG, "Rules > Between %02d:%02d and %02d:%02d: %d")        \
+    X(RULE_WEEKDAY, LOG_LEVEL_DEBUG, "Rules > Weekday mask 0x%02X: %d")                    \
+    X(RULE_OR, LOG_LEVEL_DEBUG, "Rules > %d OR %d = %d")                                   \
+    X(RULE_AND, LOG_LEVEL_DEBUG, "Rules > %d AND %d = %d")                                 \
+    X(RULE_NOT, LOG_LEVEL_DEBUG, "Rules > NOT %d = %d")                                    \
+    X(RULE_SHORT_CIRCUIT, LOG_LEVEL_DEBUG, "Rules > Chain decided at %d, rest skipped")    \
+    X(RULE_DELAY_DONE, LOG_LEVEL_DEBUG, "Rules > Delay completed in slot %d")              \
+    X(RULE_PHONE_PRESENT, LOG_LEVEL_DEBUG, "Rules > Phone present: %d")                    \
+    X(RULE_PHONE_ABSENT, LOG_LEVEL_DEBUG, "Rules > Phone absent: %d")                      \
+    X(RULE_NO_PHONE_CHECK, LOG_LEVEL_DEBUG, "Rules > Phone check not configured")          \
+    X(RULE_SOCKET_CHANGED, LOG_LEVEL_INFO, "Rules > Socket %d is %d since %02d:%02d")      \
+    X(RULE_EVAL_ON, LOG_LEVEL_DEBUG, "Rules > ON rule for socket %d: %d")                  \
+    X(RULE_EVAL_OFF, LOG_LEVEL_DEBUG, "Rules > OFF rule for socket %d: %d")                \
+    X(RULE_ON_FOR, LOG_LEVEL_DEBUG, "Rules > Socket %d on for %ld min (target %d): %d")    \
+    X(RULE_OFF_FOR, LOG_LEVEL_DEBUG, "Rules > Socket %d off for %ld min (target %d): %d")  \
+    X(RULE_TURN_ON, LOG_LEVEL_INFO, "Rules > Turning ON socket %d")                        \
+    X(RULE_TURN_OFF, LOG_LEVEL_INFO, "Rules > Turning OFF socket %d")                      \
+    X(RULE_BAD_SOCKET, LOG_LEVEL_WARN, "Rules > Invalid socket number: %d")                \
+    X(RULE_BAD_OPCODE, LOG_LEVEL_ERROR, "Rules > Bad opcode in rule at line %u")           \
+    X(RULE_BAD_TIMER, LOG_LEVEL_WARN, "Rules > Timer slot %d out of range")                \
+    X(P1_POWER, LOG_LEVEL_DEBUG, "P1 > Power %.2f W")                                      \
+    X(WEB_IDLE, LOG_LEVEL_DEBUG, "Web > No active clients for %lu s")                      \
+    X(WEB_WATCHDOG, LOG_LEVEL_WARN, "Web > Watchdog: server inactive, restarted")          \
+    X(WEB_WIFI_LOST, LOG_LEVEL_WARN, "Web > WiFi connection lost, reconnecting")           \
+    X(WEB_CACHE_HIT, LOG_LEVEL_DEBUG, "Web > Served %u bytes from RAM cache")              \
+    X(WEB_ASSET, LOG_LEVEL_DEBUG, "Web > Served %u gzipped bytes from flash")              \
+    X(WEB_NOT_MODIFIED, LOG_LEVEL_DEBUG, "Web > Not modified, %u bytes saved")             \
+    X(WEB_FILE, LOG_LEVEL_DEBUG, "Web > Serving %u bytes from SPIFFS")                     \
+    X(WEB_DISCONNECTED, LOG_LEVEL_WARN, "Web > Client disconnected after %u/%u bytes")     \
+    X(WEB_READ_FAILED, LOG_LEVEL_ERROR, "Web > File read failed after %u/%u bytes")        \
+    X(WEB_PARTIAL_WRITE, LOG_LEVEL_WARN, "Web > Partial write %u/%u bytes")                \
+    X(WEB_PROGRESS, LOG_LEVEL_DEBUG, "Web > Progress %u/%u bytes")                         \
+    X(WEB_SERVED, LOG_LEVEL_DEBUG, "Web > Served %u bytes")                                \
+    X(WEB_SHORT, LOG_LEVEL_ERROR, "Web > Only sent %u/%u bytes")                           \
+    X(WEB_EVENTS_OPEN, LOG_LEVEL_INFO, "Web > Event stream %u opened, %u clients")         \
+    X(WEB_EVENTS_CLOSED, LOG_LEVEL_INFO, "Web > Event stream %u closed")                   \
+    X(WEB_EVENTS_FULL, LOG_LEVEL_WARN, "Web > Event stream refused, all slots taken")      \
+    X(WEB_EVENTS_SLOW, LOG_LEVEL_WARN, "Web > Event stream %u dropped, too slow")          \
+    X(SOCKET_PUT_FAILED, LOG_LEVEL_WARN, "Socket %u > Put > Request failed, error %d")     \
+    X(SOCKET_GET_FAILED, LOG_LEVEL_WARN, "Socket %u > Get > Request failed, error %d")     \
+    X(SOCKET_PUT_HTTP_ERROR, LOG_LEVEL_WARN, "Socket %u > Put > HTTP status %d")           \
+    X(SOCKET_GET_HTTP_ERROR, LOG_LEVEL_WARN, "Socket %u > Get > HTTP status %d")           \
+    X(SOCKET_JSON_ERROR, LOG_LEVEL_WARN, "Socket %u > Get > JSON error")                   \
+    X(SOCKET_PUT, LOG_LEVEL_DEBUG, "Socket %u > Put > Turn %d")                            \
+    X(SOCKET_STATE, LOG_LEVEL_DEBUG, "Socket %u > Get > Is %d")                            \
+    X(SOCKET_CONFIRMED, LOG_LEVEL_INFO, "Socket %u > Command > %d confirmed in %lu ms")    \
+    X(SOCKET_WRITE_AGAIN, LOG_LEVEL_WARN, "Socket %u > Command > Still %d, rewriting")     \
+    X(SOCKET_PUT_GAVE_UP, LOG_LEVEL_ERROR, "Socket %u > Command > %d gave up, PUT failed") \
+    X(SOCKET_NOT_TAKEN, LOG_LEVEL_ERROR, "Socket %u > Command > %d gave up, not taken")    \
+    X(SOCKET_OFFLINE, LOG_LEVEL_WARN, "Socket %u > Offline, retry in %lu s")               \
+    X(SOCKET_ONLINE, LOG_LEVEL_INFO, "Socket %u > Back online")                            \
+    X(P1_READ_FAILED, LOG_LEVEL_WARN, "P1 > Read failed, error %d")                        \
+    X(SCHED_OVERRUN, LOG_LEVEL_WARN, "Scheduler > Task %u overrun: %lu ms (budget %lu ms)")
+
+#define TRACE_EVENT_ID(id, level, format) TRACE_##id,
+enum TraceEvent : uint16_t
+{
+    TRACE_EVENTS(TRACE_EVENT_ID)
+    TRACE_EVENT_COUNT
+};
+#undef TRACE_EVENT_ID
+
+static const uint8_t TRACE_MAX_ARGS = 5;
+
+struct TraceRecord
+{
+    uint32_t time;     // Monotonic ms, low 32 bits
+    uint32_t sequence; // Running record number, shows gaps
+    uint16_t event;    // TraceEvent
+    uint8_t level;
+    uint8_t argCount;
+    uint32_t args[TRACE_MAX_ARGS]; // int32, or float bits for %f/%e/%g
+};
+
+// GET /trace: this header, then `count` records, oldest first
+struct TraceDumpHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;
+    uint32_t count;
+    uint32_t lost; // Records overwritten before the Serial drain printed them
+};
+
+static_assert(sizeof(TraceRecord) == 32, "TraceRecord must stay 32 bytes");
+static_assert(sizeof(TraceDumpHeader) == 16, "TraceDumpHeader must stay 16 bytes");
+
+static const uint32_t TRACE_MAGIC = 0x43525453; // "STRC" little-endian
+static const uint16_t TRACE_VERSION = 1;
+
+inline const char *traceFormatOf(uint16_t event)
+{
+#define TRACE_EVENT_FORMAT(id, level, format) format,
+    static const char *const formats[] = {TRACE_EVENTS(TRACE_EVENT_FORMAT)};
+#undef TRACE_EVENT_FORMAT
+    return event < TRACE_EVENT_COUNT ? formats[event] : nullptr;
+}
+
+inline char traceLevelLetter(uint8_t level)
+{
+    return level < 5 ? "-EWID"[level] : '?';
+}
+
+// Formats a record's text (without time or level) into out. Walks the
+// format itself, so each argument is passed to snprintf with the type its
+// conversion expects.
+inline size_t traceFormat(const TraceRecord &record, char *out, size_t size)
+{
+    const char *format = traceFormatOf(record.event);
+    if (!format)
+        return snprintf(out, size, "Unknown trace event %u", record.event);
+
+    size_t length = 0;
+    uint8_t arg = 0;
+    const char *p = format;
+    while (*p && length + 1 < size)
+    {
+        if (*p != '%')
+        {
+            out[length++] = *p++;
+            continue;
+        }
+        if (p[1] == '%')
+        {
+            out[length++] = '%';
+            p += 2;
+            continue;
+        }
+
+        // One conversion: flags, width, precision, 'l', type
+        char spec[16];
+        size_t specLength = 0;
+        spec[specLength++] = *p++;
+        while (*p && strchr("-+ #0123456789.", *p) && specLength < sizeof(spec) - 3)
+            spec[specLength++] = *p++;
+        while (*p == 'l')
+            p++;
+        char type = *p ? *p++ : 'd';
+        uint32_t value = arg < record.argCount ? record.args[arg] : 0;
+        arg++;
+
+        int written;
+        if (strchr("feEgG", type))
+        {
+            float f;
+            memcpy(&f, &value, sizeof(f));
+            spec[specLength++] = type;
+            spec[specLength] = '\0';
+            written = snprintf(out + length, size - length, spec, (double)f);
+        }
+        else if (strchr("uxXo", type))
+        {
+            spec[specLength++] = type;
+            spec[specLength] = '\0';
+            written = snprintf(out + length, size - length, spec, (unsigned)value);
+        }
+        else
+        {
+            spec[specLength++] = type == 'c' ? 'c' : 'd';
+            spec[specLength] = '\0';
+            written = snprintf(out + length, size - length, spec, (int)(int32_t)value);
+        }
+        if (written < 0)
+            break;
+        length += (size_t)written < size - length ? (size_t)written : size - length - 1;
+    }
+    out[length] = '\0';
+    return length;
+}
+
+#endif
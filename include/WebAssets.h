@@ -0,0 +1,496 @@
+// WebAssets.h
+// Generated by tools/webassets/web_assets.py from data/ before every build, do not edit.
+// Gzipped dashboard files, served from flash by WebInterface::serveAsset().
+#ifndef WEB_ASSETS_H
+#define WEB_ASSETS_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+struct WebAsset
+{
+    const char *path;
+    const char *contentType;
+    const char *etag;
+    const uint8_t *data; // gzip
+    uint32_t size;
+};
+
+// /index.html, 12787 bytes, 3122 gzipped
+static const uint8_t WEB_ASSET_0[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xcd, 0x1b, 0xed, 0x72, 0xda, 0x48,
+    0xf2, 0x7f, 0x9e, 0x62, 0x42, 0x92, 0x92, 0x94, 0x45, 0x80, 0x1d, 0xdb, 0x95, 0xc5, 0x86, 0xad,
+    0xac, 0xed, 0x54, 0x72, 0x95, 0xaf, 0x3a, 0xfb, 0x2a, 0x77, 0x95, 0x4a, 0x2d, 0x83, 0x34, 0x82,
+    0xd9, 0x08, 0x89, 0x9b, 0x19, 0x19, 0x73, 0x59, 0xde, 0x69, 0x9f, 0x61, 0x9f, 0xec, 0x7a, 0x66,
+    0x24, 0x18, 0x09, 0x8d, 0x80, 0x3d, 0x6f, 0xd5, 0xb1, 0x49, 0x00, 0xa9, 0xbf, 0xa6, 0xbf, 0xbb,
+    0xc5, 0x5e, 0x3c, 0xbe, 0xfa, 0x78, 0x79, 0xfb, 0xaf, 0x4f, 0xd7, 0x68, 0x2a, 0x66, 0xf1, 0xf0,
+    0xd1, 0x85, 0x7e, 0x83, 0x77, 0x82, 0xc3, 0xe1, 0x23, 0x04, 0xaf, 0x0b, 0x41, 0x45, 0x4c, 0x86,
+    0x6f, 0xd2, 0x19, 0x41, 0xd7, 0x09, 0x61, 0x93, 0x25, 0xba, 0xc2, 0x7c, 0x3a, 0x4e, 0x31, 0x0b,
+    0x2f, 0xba, 0xfa, 0xa6, 0x06, 0x9c, 0x11, 0x81, 0x51, 0x82, 0x67, 0x64, 0xd0, 0xba, 0xa3, 0x64,
+    0x31, 0x4f, 0x99, 0x68, 0xa1, 0x20, 0x4d, 0x04, 0x49, 0xc4, 0xa0, 0xb5, 0xa0, 0xa1, 0x98, 0x0e,
+    0x42, 0x72, 0x47, 0x03, 0xe2, 0xab, 0x2f, 0x6d, 0x44, 0x13, 0x2a, 0x28, 0x8e, 0x7d, 0x1e, 0xe0,
+    0x98, 0x0c, 0x8e, 0x5a, 0x39, 0x21, 0x2e, 0x96, 0x05, 0x51, 0xf9, 0x1a, 0xa7, 0xe1, 0x12, 0x7d,
+    0x5f, 0x7f, 0x95, 0xaf, 0x08, 0xa8, 0xfa, 0x11, 0x9e, 0xd1, 0x78, 0xd9, 0x47, 0xaf, 0x18, 0xd0,
+    0x68, 0x23, 0x8e, 0x13, 0xee, 0x73, 0xc2, 0x68, 0x74, 0x5e, 0x82, 0x9d, 0x61, 0x36, 0xa1, 0x49,
+    0x1f, 0x1d, 0xf7, 0xe6, 0xf7, 0xe5, 0x3b, 0x63, 0x1c, 0x7c, 0x9b, 0xb0, 0x34, 0x4b, 0xc2, 0x3e,
+    0x7a, 0x12, 0x9d, 0xca, 0xff, 0x36, 0x00, 0xab, 0x47, 0xeb, 0x8f, 0x9d, 0x09, 0xa3, 0x61, 0x45,
+    0x82, 0x90, 0xf2, 0x79, 0x8c, 0x81, 0xbb, 0xbc, 0x57, 0x26, 0x2b, 0xaf, 0xf8, 0x82, 0xcc, 0xe0,
+    0xbe, 0x20, 0x7e, 0x90, 0xc6, 0xd9, 0x2c, 0xe1, 0x7d, 0x74, 0x14, 0x31, 0xf9, 0xb7, 0x02, 0x8b,
+    0xe7, 0x55, 0xc9, 0x4c, 0xc6, 0x01, 0x28, 0xb9, 0xc2, 0x78, 0x9c, 0xb2, 0x90, 0x30, 0x20, 0x37,
+    0xbf, 0x47, 0x3c, 0x8d, 0x41, 0xb0, 0x27, 0x41, 0x10, 0x9c, 0xd7, 0xc0, 0xf8, 0x0c, 0x87, 0x34,
+    0x03, 0xce, 0x2f, 0xab, 0x07, 0x9f, 0xe3, 0x30, 0xa4, 0xc9, 0x04, 0x88, 0x9c, 0x56, 0x6f, 0x69,
+    0x6d, 0xf9, 0xe3, 0x54, 0x88, 0x74, 0xb6, 0x4b, 0x69, 0x8b, 0x29, 0x15, 0xa4, 0xca, 0xfa, 0xde,
+    0xe7, 0x53, 0x1c, 0xa6, 0x8b, 0x3e, 0xea, 0xa1, 0x63, 0x10, 0xf2, 0x04, 0xfe, 0xb2, 0xc9, 0x18,
+    0xbb, 0xbd, 0x36, 0xca, 0xff, 0x74, 0x8e, 0xbc, 0xfa, 0xf3, 0xf2, 0x05, 0x15, 0xc1, 0xd4, 0xaf,
+    0x39, 0xf6, 0x5a, 0xdf, 0x51, 0x4c, 0x2a, 0x12, 0xfd, 0x9a, 0x71, 0x41, 0xa3, 0xa5, 0x9f, 0xbb,
+    0x5a, 0x1f, 0xf1, 0x39, 0x06, 0x1f, 0x1b, 0x13, 0xb1, 0x20, 0x24, 0x29, 0xc3, 0xe2, 0x98, 0x4e,
+    0x12, 0x1f, 0xa4, 0x9e, 0x81, 0x5e, 0x02, 0x80, 0x26, 0xac, 0x5e, 0x92, 0x3b, 0x1c, 0x67, 0xa4,
+    0xce, 0xeb, 0x38, 0xfd, 0x0f, 0x01, 0xbd, 0x9c, 0x54, 0xf5, 0xa2, 0x6e, 0x2e, 0x08, 0x9d, 0x4c,
+    0x41, 0x82, 0x71, 0x1a, 0x57, 0x9c, 0x02, 0xdc, 0x20, 0x05, 0xab, 0x3d, 0x39, 0x3e, 0xfa, 0xf1,
+    0xec, 0xf5, 0x8b, 0x7a, 0x9e, 0x31, 0x1e, 0x93, 0xb8, 0xc2, 0xb3, 0xc0, 0x3b, 0x3b, 0x3b, 0xab,
+    0x45, 0xea, 0x3e, 0x47, 0xb7, 0xe9, 0x64, 0x12, 0x13, 0xa4, 0x75, 0x87, 0x64, 0xf0, 0x80, 0x6d,
+    0xd1, 0xf3, 0xee, 0x86, 0xb0, 0x50, 0x10, 0x7e, 0x0e, 0x51, 0x66, 0x30, 0x4f, 0x39, 0x04, 0x61,
+    0x0a, 0x01, 0xc2, 0x08, 0x38, 0x2c, 0xbd, 0xab, 0x18, 0x74, 0xad, 0x78, 0x9a, 0x00, 0x5d, 0x50,
+    0x6b, 0x9c, 0x06, 0xdf, 0xca, 0x20, 0x2a, 0x9a, 0xfb, 0xe8, 0x6c, 0xcb, 0x57, 0xa6, 0xb9, 0x3a,
+    0x5e, 0x9c, 0xd8, 0x1c, 0xbc, 0x2c, 0x19, 0x4d, 0xe6, 0x99, 0xa8, 0xc8, 0x97, 0x82, 0x31, 0xa9,
+    0x00, 0xfe, 0xbd, 0x5a, 0xa6, 0xbd, 0x7a, 0x8e, 0xbd, 0x66, 0x76, 0x10, 0x36, 0x84, 0x59, 0x15,
+    0x81, 0xc7, 0x10, 0x58, 0x59, 0xd5, 0xb3, 0x83, 0x8c, 0x71, 0x69, 0x8a, 0x79, 0x4a, 0xcb, 0x6e,
+    0x23, 0x5f, 0x22, 0x9d, 0x6f, 0xc9, 0x12, 0x93, 0x48, 0x6c, 0x5d, 0x64, 0x5b, 0xf2, 0xe9, 0xa8,
+    0xd1, 0xe1, 0xd6, 0xb3, 0xc5, 0x9a, 0x5f, 0xf8, 0xc1, 0x56, 0xac, 0x0b, 0x06, 0x79, 0x2f, 0x17,
+    0xbc, 0x73, 0xc2, 0x1b, 0x13, 0xc1, 0x6e, 0x3b, 0x28, 0xc5, 0xf4, 0xc7, 0x24, 0x4a, 0x19, 0x39,
+    0x54, 0x3f, 0x45, 0xf8, 0xb5, 0x5a, 0xf5, 0x36, 0x39, 0x3e, 0xab, 0xfa, 0x47, 0x6e, 0xc3, 0xed,
+    0x1b, 0x5a, 0x75, 0x5b, 0x31, 0x56, 0xa8, 0xe9, 0xc4, 0x9e, 0x94, 0x0a, 0x45, 0xd5, 0xa4, 0xa6,
+    0x43, 0x34, 0x75, 0xda, 0x7b, 0x56, 0xab, 0x28, 0xe5, 0xa1, 0xfd, 0x60, 0x4a, 0x82, 0x6f, 0x24,
+    0xfc, 0xa1, 0xd1, 0x9f, 0x6a, 0x8c, 0xd7, 0x10, 0xfc, 0x4d, 0x84, 0xeb, 0xed, 0xa1, 0x8e, 0x03,
+    0xd7, 0x41, 0x1f, 0xea, 0xa3, 0xac, 0x36, 0xff, 0x74, 0xa5, 0x2e, 0x6d, 0xc9, 0x55, 0x60, 0x91,
+    0x71, 0x7b, 0x4e, 0x3b, 0xda, 0x52, 0xeb, 0xae, 0xe4, 0xd3, 0x09, 0xa1, 0xe4, 0xd3, 0xb8, 0x89,
+    0xe6, 0xb1, 0x8d, 0xe6, 0xcb, 0x97, 0x2f, 0x6b, 0x2b, 0x8f, 0x8a, 0xa4, 0x53, 0x9b, 0x9f, 0xea,
+    0x33, 0xf8, 0x14, 0x9c, 0xcd, 0x56, 0x20, 0x76, 0xe6, 0xa9, 0x6d, 0x99, 0x0a, 0x0f, 0xdd, 0xbe,
+    0xd3, 0xe4, 0x16, 0x86, 0xd0, 0x79, 0x54, 0xbf, 0xdc, 0x21, 0xf6, 0x96, 0xd0, 0x35, 0x3e, 0x72,
+    0x72, 0xf9, 0xea, 0xf5, 0x69, 0xaf, 0x99, 0x4c, 0x14, 0xed, 0xa6, 0x53, 0x4a, 0x14, 0xa5, 0x50,
+    0xa7, 0x33, 0xe2, 0xd3, 0x24, 0x4a, 0xad, 0xf1, 0x1d, 0xd1, 0x7b, 0x12, 0xd6, 0x47, 0xde, 0xd1,
+    0x56, 0x8e, 0xcf, 0x8f, 0x7e, 0xd4, 0xd8, 0x28, 0xa8, 0xfa, 0x7f, 0x7c, 0x7a, 0xda, 0x46, 0x9b,
+    0x7f, 0x7a, 0x9d, 0x1f, 0x3d, 0x4b, 0x5b, 0x02, 0x7a, 0xac, 0x69, 0x4d, 0x2a, 0xb6, 0xa8, 0xaf,
+    0xc0, 0xbb, 0xdc, 0xae, 0xe4, 0xca, 0xff, 0x7b, 0xc3, 0x92, 0xcd, 0x43, 0xd9, 0xe4, 0x31, 0x22,
+    0x7b, 0x09, 0x4b, 0xe9, 0x6e, 0xb2, 0x68, 0x8e, 0x0f, 0xed, 0x82, 0x05, 0x39, 0x3a, 0x39, 0x79,
+    0xf1, 0xa2, 0x14, 0x7d, 0xaa, 0x45, 0xee, 0xe6, 0x3d, 0xf2, 0x45, 0x57, 0x77, 0xea, 0x8f, 0x2e,
+    0x64, 0x97, 0x9c, 0xf7, 0xcf, 0x21, 0xbd, 0x43, 0x41, 0x8c, 0x39, 0x1f, 0xb4, 0x64, 0x27, 0xd5,
+    0xda, 0xb4, 0xd2, 0x17, 0xd3, 0xe3, 0xe1, 0xa7, 0x74, 0x01, 0xb9, 0xea, 0x7d, 0x0a, 0xbd, 0x77,
+    0xca, 0x00, 0xff, 0xd8, 0xb8, 0x6d, 0x60, 0xca, 0x2e, 0xd6, 0xc0, 0x2c, 0x6e, 0x97, 0xaf, 0x54,
+    0x91, 0x54, 0x07, 0xd3, 0x1a, 0xbe, 0x9d, 0xc9, 0xe6, 0xff, 0xa2, 0xbb, 0x13, 0x5e, 0x75, 0x59,
+    0x2d, 0x44, 0xc3, 0x41, 0x8b, 0x2a, 0x1c, 0x7f, 0x2e, 0xa5, 0x6b, 0x0d, 0x7d, 0x1f, 0x7d, 0xae,
+    0xc1, 0xaf, 0xbb, 0xb4, 0xaf, 0x50, 0xd7, 0xf7, 0x87, 0x0b, 0x45, 0xee, 0x0f, 0x17, 0xca, 0xf8,
+    0x9a, 0x7f, 0xdc, 0xc7, 0x2a, 0xd7, 0xc9, 0x1d, 0x65, 0x69, 0x32, 0x03, 0x37, 0xfa, 0x6b, 0x6c,
+    0x72, 0x0b, 0x03, 0x09, 0x61, 0x90, 0x3f, 0x18, 0x39, 0x4c, 0x07, 0x62, 0x83, 0x28, 0x55, 0xf0,
+    0xc7, 0xef, 0x97, 0x0f, 0x6c, 0x98, 0x37, 0xd9, 0x8c, 0x86, 0xd0, 0xe2, 0x1d, 0x26, 0xd6, 0x34,
+    0xc7, 0x92, 0x32, 0x3d, 0x7b, 0x60, 0x89, 0xde, 0xc9, 0x9c, 0x76, 0x98, 0x38, 0xb1, 0x44, 0x51,
+    0x2e, 0x12, 0x67, 0xf7, 0x7f, 0xde, 0x49, 0x1e, 0x03, 0x81, 0x8f, 0x09, 0x41, 0x6a, 0x02, 0x02,
+    0xb5, 0xc3, 0x88, 0x07, 0x0d, 0x81, 0x80, 0xa2, 0x26, 0xfb, 0xab, 0x88, 0x4e, 0x3a, 0xbf, 0xf2,
+    0x34, 0x69, 0x43, 0xdd, 0x09, 0x09, 0x1a, 0x2f, 0x51, 0xc0, 0x08, 0xe4, 0x8f, 0x1b, 0xd5, 0x3e,
+    0x5f, 0x02, 0x0e, 0x77, 0x3d, 0xe4, 0xfb, 0x46, 0x1e, 0x90, 0xb2, 0xe9, 0xee, 0x9a, 0xf0, 0xd6,
+    0xd0, 0xe4, 0x55, 0x77, 0xa0, 0x75, 0x6d, 0x68, 0xd5, 0x1f, 0x7c, 0x78, 0x99, 0x31, 0x26, 0x33,
+    0xdd, 0x2d, 0x00, 0xf6, 0x61, 0x52, 0x9f, 0xe3, 0x44, 0xb1, 0x08, 0xf4, 0x75, 0x5f, 0x12, 0x90,
+    0x5a, 0xe8, 0xab, 0x3f, 0x90, 0xa6, 0x00, 0x60, 0xd8, 0xa0, 0xc9, 0xe1, 0x3b, 0xcc, 0x05, 0xfa,
+    0x87, 0xca, 0x82, 0x26, 0x3d, 0x10, 0x47, 0xf8, 0x3a, 0x39, 0xb6, 0x0a, 0xe1, 0x4a, 0xb9, 0x76,
+    0x1f, 0x26, 0xb5, 0xa7, 0xe5, 0x01, 0xa3, 0x73, 0xb1, 0x2d, 0x4d, 0x0c, 0x5a, 0x96, 0x5c, 0xb5,
+    0x2c, 0xf2, 0x7c, 0x68, 0x80, 0x92, 0x2c, 0x8e, 0xcf, 0x6b, 0x41, 0xb5, 0x4e, 0x2f, 0xa1, 0xbc,
+    0x09, 0x80, 0xf3, 0x8f, 0xea, 0xa1, 0xd2, 0xe4, 0x86, 0x26, 0x81, 0xa4, 0xf4, 0xe5, 0xeb, 0x39,
+    0xea, 0x76, 0xd1, 0xa7, 0xb5, 0x49, 0xdb, 0xd0, 0xa2, 0x12, 0x38, 0xac, 0x40, 0x0b, 0xcc, 0x73,
+    0x72, 0x24, 0x04, 0x0c, 0xe4, 0xce, 0xb8, 0xd7, 0x56, 0xac, 0x65, 0x17, 0x0b, 0x93, 0x1d, 0xd4,
+    0xfb, 0x47, 0x5b, 0xe4, 0xa3, 0x2c, 0x09, 0x64, 0xb9, 0x46, 0xb2, 0x05, 0xc4, 0xe2, 0x3d, 0x4d,
+    0xa0, 0x23, 0x77, 0x67, 0xea, 0xcd, 0xab, 0x14, 0x93, 0x75, 0xad, 0x26, 0x10, 0xc5, 0x09, 0x1a,
+    0x3d, 0xfd, 0x7e, 0x23, 0x18, 0x54, 0x5a, 0xf7, 0x3d, 0x16, 0xd3, 0x4e, 0x14, 0xa7, 0x29, 0xcb,
+    0x31, 0x51, 0x17, 0xc6, 0x38, 0xcf, 0xeb, 0x40, 0x29, 0xbe, 0x11, 0x98, 0x09, 0xf7, 0xb8, 0x8d,
+    0x9c, 0x9e, 0xe3, 0xad, 0xfa, 0x6b, 0x9c, 0x1c, 0xf0, 0x99, 0x04, 0xdc, 0x86, 0x1b, 0x6d, 0x2b,
+    0x62, 0xb5, 0x2d, 0x3c, 0x68, 0xe2, 0xf3, 0x14, 0x0b, 0x24, 0xa6, 0xe0, 0xc5, 0x19, 0x8d, 0x05,
+    0x38, 0x1d, 0x8a, 0xd3, 0x09, 0x0d, 0xe0, 0xb0, 0x08, 0x17, 0x5e, 0x1f, 0xa6, 0x84, 0xdb, 0x0f,
+    0x1e, 0x12, 0x69, 0xcb, 0x31, 0x79, 0x27, 0xf1, 0x5c, 0xad, 0xc1, 0x5f, 0xc0, 0x78, 0xd8, 0x76,
+    0x7c, 0x1a, 0x21, 0x13, 0xac, 0xa3, 0x19, 0x0e, 0x06, 0x03, 0xe4, 0xf0, 0x8c, 0xcd, 0xe3, 0x8c,
+    0x3b, 0x5e, 0xa1, 0x23, 0xe7, 0x55, 0x26, 0xd2, 0x3e, 0xba, 0x49, 0x63, 0xcc, 0x90, 0x2e, 0x03,
+    0x30, 0xf7, 0xa4, 0x77, 0x04, 0x64, 0x66, 0x84, 0x4f, 0xa1, 0x62, 0x3b, 0xe7, 0x87, 0x72, 0x21,
+    0x77, 0x24, 0x01, 0x15, 0x6e, 0xb8, 0x8c, 0x34, 0x17, 0x95, 0x6f, 0xd0, 0x05, 0x7a, 0xfa, 0xbd,
+    0x84, 0x98, 0xdd, 0xaf, 0x64, 0x36, 0x41, 0xee, 0xab, 0x08, 0x06, 0x4e, 0xb8, 0x5b, 0x32, 0xb5,
+    0x09, 0x8a, 0x25, 0x80, 0xb7, 0xf2, 0x46, 0xe7, 0x4d, 0x76, 0x77, 0xde, 0xe3, 0x24, 0xc3, 0x31,
+    0x4a, 0x19, 0x62, 0x59, 0x4c, 0xb8, 0xb3, 0xaf, 0xad, 0xfe, 0x4e, 0x94, 0x91, 0xb4, 0xc7, 0x4a,
+    0x9b, 0x25, 0xd9, 0x6c, 0x0c, 0x12, 0x81, 0xad, 0xb4, 0xa5, 0x38, 0x0a, 0xa6, 0x38, 0x99, 0x10,
+    0x8e, 0xdc, 0x84, 0x2c, 0xcc, 0x54, 0xe5, 0xd9, 0xed, 0xb7, 0x9d, 0xbb, 0x8a, 0x44, 0x65, 0x33,
+    0x20, 0xd0, 0x85, 0x6c, 0x21, 0x07, 0x4d, 0x0c, 0x2d, 0x3e, 0x83, 0xb0, 0x0a, 0xd3, 0x20, 0x93,
+    0x35, 0xb3, 0x33, 0x21, 0xe2, 0x3a, 0x26, 0xf2, 0xe3, 0xcf, 0xcb, 0xb7, 0xa1, 0xeb, 0x14, 0xa4,
+    0x1c, 0xef, 0xdc, 0x46, 0x4a, 0x13, 0xe9, 0xd0, 0x04, 0xfe, 0x7d, 0x73, 0xfb, 0xfe, 0x1d, 0x90,
+    0x73, 0x2c, 0x36, 0x2d, 0xa8, 0x75, 0xc0, 0x02, 0xd7, 0x38, 0x98, 0xba, 0xa6, 0xf6, 0xe5, 0x1e,
+    0x33, 0x24, 0xf7, 0x1e, 0x1a, 0x0c, 0x2d, 0x72, 0x6f, 0x64, 0xd7, 0x68, 0x1f, 0xb2, 0x19, 0x30,
+    0x53, 0x58, 0xe8, 0x07, 0x74, 0x74, 0xbe, 0x03, 0x49, 0x15, 0x03, 0xe3, 0xac, 0x5a, 0x71, 0xf9,
+    0x71, 0x5d, 0x07, 0x92, 0x9c, 0xed, 0x94, 0x8a, 0x06, 0x60, 0x77, 0x54, 0x0a, 0xfd, 0x80, 0x55,
+    0x52, 0x73, 0x14, 0x3d, 0x63, 0xd5, 0xe6, 0xec, 0x40, 0x36, 0x35, 0x34, 0xb2, 0x82, 0xda, 0x2b,
+    0xec, 0x16, 0xd4, 0xf4, 0xc5, 0x50, 0xa7, 0xfa, 0x3c, 0xb3, 0x9b, 0x53, 0xdd, 0x66, 0xc6, 0x91,
+    0xe5, 0x4a, 0xa7, 0xf6, 0x75, 0x59, 0xd0, 0x42, 0x17, 0x61, 0x02, 0x6a, 0x5c, 0xf9, 0x72, 0xe1,
+    0xbc, 0x81, 0xec, 0x02, 0xe9, 0xdd, 0xfc, 0x8d, 0x8a, 0xa7, 0xd9, 0xb5, 0x6c, 0xd4, 0xf3, 0xdb,
+    0xc3, 0x8f, 0x51, 0x64, 0xa9, 0x62, 0x4d, 0xc4, 0xf3, 0xf1, 0xd8, 0x4a, 0x5d, 0xa5, 0x86, 0xd6,
+    0x70, 0x0f, 0xca, 0xfb, 0x80, 0xe8, 0xf5, 0x61, 0x51, 0xc9, 0xcd, 0xc5, 0x5a, 0x6b, 0x0f, 0xb1,
+    0xf5, 0xee, 0x4d, 0x2c, 0xe7, 0x04, 0xaa, 0xb9, 0x5c, 0x43, 0xc0, 0x60, 0x64, 0x13, 0xbc, 0x05,
+    0x65, 0x4a, 0x07, 0x7c, 0xc1, 0x48, 0x47, 0xb1, 0x6b, 0x02, 0xb5, 0x21, 0x53, 0x50, 0xde, 0xc9,
+    0x57, 0x1a, 0xde, 0x3e, 0x32, 0x98, 0x3e, 0x51, 0xda, 0x80, 0xac, 0x0d, 0xbc, 0x43, 0x49, 0x4a,
+    0x05, 0xc3, 0x51, 0x63, 0x40, 0xe5, 0x61, 0x8f, 0xe7, 0x73, 0x92, 0x84, 0x97, 0x50, 0x60, 0x43,
+    0x57, 0x7a, 0x79, 0x43, 0x04, 0xd9, 0x92, 0xcc, 0xc8, 0xe2, 0x8e, 0x23, 0xaf, 0x23, 0xc8, 0xbd,
+    0xb8, 0xd4, 0x0b, 0x31, 0x08, 0x1a, 0x33, 0x55, 0x4b, 0x80, 0x87, 0x61, 0xa5, 0xbc, 0x67, 0x8b,
+    0x97, 0xbd, 0x2a, 0xd6, 0x73, 0x5d, 0x79, 0x4d, 0x29, 0xaf, 0x68, 0x70, 0xd6, 0x09, 0x30, 0x26,
+    0xc9, 0x44, 0x4c, 0xf7, 0x2d, 0x1c, 0xaf, 0x8b, 0x5c, 0x2f, 0x52, 0x24, 0xcc, 0x35, 0x75, 0x53,
+    0x5d, 0x2f, 0x79, 0xd4, 0xfa, 0xbc, 0x50, 0x6f, 0xda, 0x2a, 0x39, 0x58, 0xbb, 0x9b, 0x88, 0x48,
+    0x84, 0x51, 0x57, 0xa3, 0x74, 0x0d, 0x5d, 0x01, 0xee, 0x6a, 0xd4, 0x6e, 0x48, 0xce, 0x33, 0x22,
+    0xa6, 0x69, 0xd8, 0x47, 0xce, 0xa7, 0x8f, 0x37, 0xb7, 0x4e, 0xdb, 0x0a, 0x27, 0x87, 0x6d, 0xc2,
+    0x78, 0xbf, 0x81, 0x94, 0x7c, 0x39, 0xb9, 0x39, 0xfc, 0x5b, 0x08, 0x27, 0x07, 0xc8, 0x82, 0xb3,
+    0xc5, 0x34, 0xc0, 0xf2, 0x78, 0x5d, 0x59, 0x15, 0x1b, 0x58, 0xac, 0xec, 0xb7, 0xe4, 0x88, 0xdf,
+    0x47, 0x7f, 0xbb, 0xf9, 0xf8, 0xa1, 0xc3, 0x55, 0x2f, 0x46, 0xa3, 0xa5, 0xfb, 0x5d, 0x2b, 0xa5,
+    0xaf, 0xdf, 0xc0, 0x9c, 0x16, 0x2b, 0x5b, 0xa9, 0x76, 0xa0, 0xa0, 0x27, 0x2e, 0xf4, 0x34, 0x73,
+    0x28, 0x36, 0x44, 0x16, 0xb1, 0xe2, 0xb3, 0x2a, 0xe0, 0xae, 0xb7, 0x0b, 0x55, 0x3a, 0x57, 0x73,
+    0xed, 0x93, 0x2f, 0xdd, 0xbd, 0xdf, 0xa8, 0x7c, 0xfa, 0x16, 0xc2, 0xb0, 0xd6, 0xb2, 0xf6, 0xc0,
+    0x68, 0x3a, 0x00, 0x28, 0x16, 0x0c, 0x4f, 0x18, 0x83, 0xc6, 0x66, 0xa7, 0x1c, 0xb2, 0xa4, 0xa6,
+    0x31, 0xe9, 0x28, 0x70, 0xd7, 0xb9, 0x96, 0x6f, 0x7d, 0xa7, 0x8d, 0xd4, 0xf7, 0x06, 0x01, 0xd6,
+    0xad, 0xd0, 0x1d, 0x61, 0x62, 0xf3, 0xb0, 0x45, 0xea, 0x1c, 0x7c, 0x56, 0x61, 0x37, 0xe2, 0xee,
+    0x1f, 0xd9, 0xca, 0x5b, 0xbd, 0x22, 0x71, 0x42, 0xf0, 0x3d, 0x56, 0x6c, 0x9a, 0x74, 0xb3, 0x6f,
+    0x3c, 0xea, 0xe1, 0x46, 0xb5, 0x70, 0xf9, 0x36, 0x58, 0xd5, 0x5c, 0xe8, 0x6a, 0x64, 0xd3, 0xad,
+    0x04, 0xb0, 0xc7, 0xe5, 0x5e, 0x16, 0x6c, 0xec, 0xdc, 0x14, 0x33, 0xa3, 0x91, 0xf9, 0x77, 0x46,
+    0xd8, 0xf2, 0x86, 0xc4, 0x24, 0x10, 0x60, 0x8b, 0xd1, 0x93, 0x5a, 0x55, 0xe4, 0x35, 0x18, 0x34,
+    0x32, 0x67, 0xe4, 0x8e, 0xa6, 0x19, 0xcf, 0xd5, 0x77, 0x43, 0xc7, 0xf2, 0x49, 0x57, 0x85, 0x8a,
+    0x63, 0xee, 0x88, 0x6d, 0x7d, 0x91, 0xbc, 0x57, 0xee, 0x89, 0xcc, 0x16, 0xc4, 0x81, 0xa6, 0xcc,
+    0xd5, 0xa6, 0xfd, 0x69, 0x7d, 0x07, 0x88, 0xa1, 0xfe, 0xe6, 0x5b, 0x14, 0x39, 0x7b, 0x6b, 0xfd,
+    0xb5, 0x6a, 0xdb, 0x51, 0x98, 0x31, 0x95, 0x01, 0x90, 0x0e, 0xde, 0x5d, 0x13, 0xdd, 0x55, 0x0e,
+    0xee, 0x72, 0x02, 0x42, 0x85, 0xbc, 0x71, 0xaa, 0xd1, 0x20, 0x6a, 0xca, 0xe8, 0xad, 0xa7, 0x8b,
+    0x16, 0x74, 0x2d, 0xad, 0xf3, 0x06, 0x7b, 0x4c, 0xd3, 0x8c, 0x01, 0x12, 0x32, 0xc6, 0xc0, 0x82,
+    0x52, 0x17, 0xbd, 0x38, 0xeb, 0xf5, 0xbc, 0x26, 0x6c, 0x3d, 0x08, 0x56, 0xf0, 0xd7, 0x04, 0x9e,
+    0x69, 0x02, 0x7a, 0xa0, 0x6c, 0x1c, 0x4b, 0x46, 0x1f, 0xb5, 0x07, 0x3e, 0xfd, 0xae, 0xe4, 0x59,
+    0x4d, 0xe1, 0x53, 0x4e, 0x7b, 0x35, 0xdb, 0x7b, 0x9e, 0xbc, 0x99, 0xa6, 0x8b, 0xf5, 0xe4, 0xe8,
+    0x70, 0xed, 0x8e, 0xe7, 0x1b, 0xa5, 0x53, 0xb8, 0x94, 0x8b, 0xc6, 0xd5, 0x4c, 0x4e, 0x61, 0x6a,
+    0x91, 0x03, 0x7f, 0x3e, 0xba, 0xd8, 0xcd, 0x01, 0xc3, 0xde, 0x22, 0xaf, 0x46, 0xaa, 0x65, 0xcf,
+    0x5d, 0xbd, 0xbd, 0xa6, 0xdd, 0xec, 0xf4, 0x07, 0xb4, 0xfc, 0x07, 0x54, 0xff, 0x52, 0x82, 0x68,
+    0xc8, 0x0f, 0xf9, 0x06, 0xe2, 0x8b, 0xe2, 0xfc, 0xb5, 0x80, 0x05, 0xbf, 0xbe, 0x82, 0xb7, 0x4e,
+    0x92, 0x2e, 0xe4, 0xc2, 0x68, 0xa3, 0xa5, 0xe7, 0xe8, 0xa8, 0xd7, 0xeb, 0x81, 0xa3, 0xd7, 0x6f,
+    0x3e, 0x9a, 0x13, 0x79, 0x73, 0x16, 0xdf, 0xa8, 0x71, 0xed, 0xd9, 0x7a, 0x6e, 0xda, 0xcb, 0xc2,
+    0x35, 0xd6, 0xa8, 0x90, 0x69, 0x36, 0x82, 0x12, 0xf7, 0x0a, 0x5a, 0xf3, 0xc1, 0x6e, 0x2d, 0xaf,
+    0xad, 0xb4, 0xc9, 0x3d, 0x96, 0x23, 0x15, 0x54, 0x2b, 0x3d, 0x58, 0x45, 0xe9, 0x8f, 0x07, 0x7a,
+    0x93, 0x64, 0x4d, 0xe0, 0x3f, 0x55, 0x43, 0xde, 0x0c, 0xa8, 0x92, 0xa1, 0xca, 0x94, 0x65, 0x74,
+    0x49, 0x7b, 0x79, 0x9e, 0x4c, 0x4d, 0x10, 0xed, 0xce, 0xa1, 0x85, 0x40, 0xae, 0xb9, 0xf2, 0x27,
+    0x67, 0x7c, 0x57, 0xe6, 0x97, 0x3b, 0xb1, 0x2b, 0x0d, 0xeb, 0x36, 0x6b, 0x1b, 0xa4, 0x95, 0xcb,
+    0x33, 0xb2, 0x50, 0x5e, 0xe6, 0x7a, 0x87, 0x79, 0xbb, 0x63, 0x2e, 0x13, 0x9d, 0x4a, 0x7f, 0x6b,
+    0xd5, 0x21, 0xf0, 0xec, 0x88, 0xf4, 0x5d, 0x2a, 0x7f, 0x4a, 0x24, 0x25, 0xcd, 0xb7, 0x55, 0x5e,
+    0x63, 0x58, 0x18, 0xf3, 0xbc, 0xfc, 0x6a, 0x4e, 0xf2, 0x56, 0x3f, 0x03, 0x8a, 0xd6, 0x3c, 0x5c,
+    0x5e, 0x20, 0x7a, 0x3b, 0xd7, 0x01, 0x1b, 0xf8, 0xa6, 0x5d, 0x86, 0xb1, 0x0c, 0x6d, 0x1c, 0xf4,
+    0x15, 0x49, 0xa1, 0xac, 0x14, 0x45, 0xd2, 0x00, 0x60, 0x06, 0xbf, 0xb2, 0xd4, 0xb4, 0xa3, 0x6f,
+    0xe0, 0x2a, 0xde, 0x5c, 0x26, 0x70, 0x80, 0x92, 0x2b, 0x54, 0xcd, 0x7a, 0xbb, 0x96, 0x72, 0x88,
+    0x4e, 0x65, 0xc2, 0x81, 0x3a, 0xbb, 0x79, 0x14, 0xa6, 0x0a, 0x6d, 0x69, 0xdb, 0x6b, 0xd9, 0x50,
+    0xac, 0x0e, 0xa8, 0x0d, 0x5c, 0x75, 0x3d, 0x11, 0x25, 0x31, 0x54, 0x00, 0xe8, 0x24, 0xb8, 0x3c,
+    0x1c, 0x4d, 0x90, 0xec, 0x5e, 0xfb, 0x08, 0xc7, 0xb1, 0xdc, 0x66, 0x01, 0xc8, 0x0c, 0x45, 0x2c,
+    0x9d, 0xa1, 0xae, 0xea, 0x6a, 0x71, 0x12, 0xd6, 0xd1, 0x93, 0x94, 0x5a, 0x11, 0x44, 0x74, 0x0b,
+    0xc9, 0x95, 0x9e, 0x68, 0x83, 0x3f, 0xc5, 0x4b, 0x75, 0x59, 0x17, 0x13, 0xb9, 0xc7, 0x85, 0xca,
+    0xa8, 0x28, 0x61, 0xd4, 0x0a, 0x49, 0x2c, 0x70, 0x0e, 0xdb, 0x9c, 0xd9, 0x20, 0x5e, 0xb0, 0xbb,
+    0x6b, 0x87, 0xe9, 0xe8, 0x67, 0x65, 0xbf, 0xa8, 0xc7, 0x52, 0x4e, 0x71, 0x08, 0xcf, 0xee, 0x40,
+    0xe6, 0xb3, 0xb5, 0x6a, 0x40, 0xc9, 0x6d, 0xb0, 0x1a, 0x4c, 0x4d, 0xa2, 0x2b, 0xf4, 0x79, 0x64,
+    0xdf, 0x6e, 0x3a, 0x7a, 0x1f, 0xba, 0x3f, 0x7f, 0xf3, 0x31, 0x9a, 0x95, 0xbf, 0x49, 0x74, 0x07,
+    0x7f, 0xe3, 0x91, 0xd4, 0x3e, 0xec, 0x4d, 0x70, 0x1b, 0x77, 0x03, 0x66, 0xf5, 0xc7, 0xef, 0x97,
+    0x4d, 0xdc, 0x8b, 0x27, 0x4f, 0xfb, 0xb0, 0x5e, 0xc3, 0xda, 0xf8, 0x16, 0x00, 0xab, 0x67, 0x4d,
+    0x2c, 0xd5, 0xd3, 0xa5, 0x7d, 0xf8, 0x69, 0x40, 0x1b, 0x33, 0x75, 0x57, 0xed, 0x94, 0x2d, 0xcc,
+    0x66, 0x98, 0x7d, 0xd3, 0xd1, 0x1a, 0xba, 0x7f, 0xa2, 0x2e, 0xbf, 0x86, 0x90, 0xd8, 0xe9, 0xbd,
+    0x4a, 0x92, 0xca, 0x3e, 0x41, 0x95, 0x48, 0x63, 0xe3, 0xe0, 0xd5, 0x2c, 0x87, 0x4b, 0x78, 0xb6,
+    0x92, 0x52, 0xa2, 0xbd, 0x6b, 0x59, 0x5b, 0xd3, 0xd8, 0x19, 0x8b, 0x9a, 0xbc, 0xc9, 0x9b, 0x63,
+    0xc6, 0xc9, 0xdb, 0x44, 0x94, 0xf6, 0xed, 0xeb, 0xce, 0xcf, 0x6b, 0x68, 0x76, 0x36, 0xb1, 0x7c,
+    0xb8, 0x26, 0xaf, 0x64, 0xc6, 0x68, 0x54, 0x65, 0x59, 0x1f, 0xe8, 0xb7, 0xdf, 0xd0, 0x97, 0xaf,
+    0xde, 0xfa, 0xc8, 0x3a, 0x0d, 0x55, 0x0e, 0xa9, 0x2f, 0x76, 0xf2, 0xb3, 0xe6, 0xdf, 0xf2, 0x63,
+    0xe6, 0xdf, 0x36, 0x07, 0x7b, 0xf8, 0x73, 0x95, 0x9c, 0xcb, 0x72, 0xaa, 0xed, 0x27, 0x70, 0x3b,
+    0x9a, 0x88, 0x9a, 0xd6, 0x64, 0xef, 0xb1, 0x0c, 0x92, 0xbe, 0xfc, 0x91, 0x0a, 0x02, 0xed, 0xc0,
+    0xe4, 0x21, 0xd0, 0xb5, 0xcc, 0xcf, 0x37, 0x30, 0x83, 0x04, 0x44, 0xfe, 0xcc, 0x0f, 0x4a, 0x82,
+    0xaa, 0x02, 0xbb, 0xfa, 0x22, 0xa5, 0x8f, 0xe6, 0xa5, 0x94, 0xa3, 0x08, 0x39, 0x7f, 0xe1, 0x12,
+    0xa6, 0x08, 0xbf, 0xff, 0x87, 0x35, 0xc9, 0x7e, 0x8d, 0x4c, 0x79, 0xfe, 0x36, 0xaa, 0xff, 0x43,
+    0x2e, 0x3a, 0x8c, 0xfe, 0x56, 0x96, 0x5f, 0xb6, 0xcc, 0x87, 0xc0, 0x2d, 0x1c, 0x4e, 0xc4, 0x5b,
+    0xf9, 0xb3, 0xce, 0x3b, 0x1c, 0xbb, 0x5b, 0x3e, 0xd5, 0xd6, 0x5d, 0xf6, 0x79, 0x2d, 0xab, 0x5b,
+    0x59, 0xf5, 0x21, 0xd5, 0x32, 0x70, 0x18, 0xc2, 0xd0, 0x3c, 0xe3, 0x32, 0x1e, 0xf3, 0xe7, 0x61,
+    0xe7, 0xfa, 0x11, 0x27, 0x83, 0xfe, 0x03, 0xee, 0x31, 0xc9, 0x3b, 0x21, 0x01, 0x4c, 0x9e, 0xe3,
+    0xa5, 0x1c, 0x40, 0x49, 0x1c, 0x3d, 0xaa, 0xcb, 0x91, 0x0b, 0x88, 0x51, 0xe8, 0x67, 0x0d, 0x87,
+    0x6c, 0x6e, 0xb8, 0x55, 0x67, 0xc1, 0xf3, 0x70, 0x31, 0xb0, 0xc0, 0xf1, 0xf4, 0x2d, 0x5b, 0xdf,
+    0xa8, 0xef, 0x76, 0x70, 0x18, 0x2a, 0xac, 0x77, 0x94, 0x43, 0xc9, 0x20, 0x60, 0x70, 0xd9, 0xdd,
+    0x48, 0x73, 0x17, 0x29, 0x44, 0xa5, 0x76, 0xb5, 0x7a, 0x54, 0x09, 0xd1, 0x85, 0x54, 0x21, 0x33,
+    0x80, 0x77, 0x28, 0x5d, 0xd5, 0x0a, 0x99, 0x84, 0x75, 0xa6, 0x7b, 0x00, 0xca, 0x73, 0xf9, 0x64,
+    0xb5, 0x6d, 0x66, 0x99, 0x66, 0x0a, 0xd0, 0xa1, 0xe9, 0x50, 0x40, 0xae, 0xaa, 0x06, 0x0f, 0xee,
+    0xb5, 0x2b, 0x44, 0x62, 0x4e, 0x2c, 0x76, 0xdb, 0xf6, 0xb7, 0x2b, 0x55, 0x9d, 0x8e, 0x7b, 0xd6,
+    0xad, 0x8b, 0x99, 0x6d, 0xea, 0xe2, 0xa0, 0xfc, 0x28, 0xa4, 0xf8, 0x9d, 0xc3, 0x45, 0x57, 0xff,
+    0x32, 0x4c, 0xfe, 0x54, 0x4c, 0xfe, 0xcf, 0x1d, 0xff, 0x05, 0x72, 0x4d, 0x16, 0x0f, 0xf3, 0x31,
+    0x00, 0x00,
+};
+
+// /favicon.ico, 16958 bytes, 4266 gzipped
+static const uint8_t WEB_ASSET_1[] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xed, 0x5b, 0x09, 0x78, 0x54, 0xd5,
+    0x15, 0x9e, 0x99, 0xec, 0x0b, 0x64, 0x4f, 0xc8, 0x3e, 0x49, 0x20, 0x01, 0x02, 0x24, 0x40, 0x36,
+    0xb2, 0x90, 0x8d, 0x99, 0xc9, 0x82, 0x96, 0x20, 0x54, 0xbf, 0xaf, 0x5a, 0x5b, 0x6c, 0x81, 0x8a,
+    0x48, 0xd0, 0x42, 0x81, 0x28, 0x10, 0x1b, 0xfa, 0xd1, 0x56, 0xac, 0x9a, 0x6a, 0xf7, 0x05, 0xdb,
+    0x2a, 0x01, 0x2c, 0x28, 0x68, 0x45, 0x24, 0x2c, 0xf6, 0x03, 0x6c, 0x15, 0xad, 0xe5, 0xc3, 0x2a,
+    0xab, 0x12, 0x96, 0x84, 0x9d, 0x2c, 0x24, 0xb3, 0x9d, 0x9e, 0xff, 0xbe, 0xf7, 0xc2, 0x63, 0x12,
+    0xc8, 0x84, 0x04, 0x88, 0xad, 0x37, 0xdf, 0xcd, 0xb9, 0xef, 0xbe, 0xbb, 0x9c, 0x73, 0xee, 0xb9,
+    0x67, 0xb9, 0xf7, 0x8d, 0x46, 0xa3, 0xe5, 0xbf, 0x82, 0x02, 0x0d, 0xff, 0xd7, 0x6b, 0x86, 0x17,
+    0x69, 0x34, 0xa1, 0x1a, 0x8d, 0x66, 0x38, 0x67, 0xae, 0xd2, 0x2c, 0xd7, 0x48, 0xf5, 0x22, 0x71,
+    0xc5, 0xe0, 0x1c, 0x29, 0x7f, 0x95, 0xbe, 0x4a, 0x37, 0x91, 0xb4, 0x9c, 0x5d, 0x07, 0x52, 0xf6,
+    0xf4, 0xf4, 0x70, 0xdd, 0xba, 0x75, 0xab, 0xd6, 0xc3, 0xc3, 0x43, 0x3c, 0xeb, 0x74, 0x3a, 0xed,
+    0x2d, 0xa4, 0x5d, 0xf7, 0x25, 0x58, 0x23, 0x9d, 0x8c, 0x6b, 0xbf, 0x25, 0x37, 0x37, 0x37, 0x6d,
+    0x68, 0x68, 0xa8, 0x26, 0x24, 0x24, 0xc4, 0x8b, 0x1f, 0xef, 0x93, 0xd5, 0xca, 0xb2, 0x01, 0x90,
+    0x6b, 0x5c, 0x5c, 0x5c, 0xe6, 0x6e, 0xde, 0xbc, 0x29, 0x98, 0xe1, 0xa3, 0xfc, 0x7c, 0x7f, 0x78,
+    0x78, 0xb8, 0x17, 0x70, 0x05, 0xce, 0xfd, 0xc2, 0x4c, 0x59, 0x9e, 0x78, 0xbc, 0x30, 0x06, 0x1f,
+    0xe4, 0xe5, 0xe5, 0xd1, 0xfc, 0xf9, 0xf3, 0x6d, 0xf3, 0xe6, 0x3d, 0x4a, 0xf3, 0xe6, 0xcd, 0xbb,
+    0x63, 0xb9, 0xb2, 0xb2, 0x92, 0xe6, 0xcc, 0x99, 0x43, 0x4f, 0x3d, 0x55, 0x6d, 0x6f, 0x6c, 0x3c,
+    0x7d, 0xb1, 0xa6, 0xa6, 0xc6, 0x3a, 0x61, 0x42, 0x16, 0x01, 0x47, 0xc6, 0x35, 0x54, 0x8d, 0x7b,
+    0x5f, 0x92, 0xab, 0xab, 0xab, 0x8b, 0x5c, 0x5c, 0x3d, 0x73, 0xe6, 0x4c, 0xe2, 0xd4, 0x61, 0xb7,
+    0xdb, 0x2d, 0x0c, 0x07, 0x44, 0xb6, 0xd9, 0x6c, 0x96, 0x8b, 0x17, 0x2f, 0x90, 0xd5, 0x6a, 0xc5,
+    0x73, 0xc7, 0xcc, 0x99, 0xdf, 0x05, 0x0f, 0x56, 0x3b, 0xe0, 0xde, 0x97, 0x3d, 0x8f, 0xe4, 0xed,
+    0xe9, 0xe9, 0xd9, 0x70, 0xe0, 0xc0, 0x01, 0x6a, 0x6b, 0x6b, 0x05, 0xbf, 0xe9, 0xcc, 0x99, 0x26,
+    0xa7, 0x73, 0x53, 0x53, 0x23, 0xa1, 0x0f, 0xf0, 0x04, 0xc4, 0xf3, 0xcd, 0xb4, 0xe9, 0x2e, 0x9f,
+    0x3d, 0x7b, 0x86, 0x2e, 0x5c, 0x38, 0x2f, 0x70, 0x02, 0x6e, 0xc0, 0x91, 0x71, 0x3d, 0x0e, 0x9c,
+    0x1d, 0x68, 0xe8, 0x0b, 0xfd, 0x01, 0x41, 0x41, 0x41, 0xe7, 0x0e, 0x1e, 0xfc, 0x8c, 0x9a, 0x9b,
+    0x2f, 0xdb, 0xcf, 0x9f, 0x3f, 0x87, 0x39, 0x9d, 0xca, 0x68, 0xcb, 0x7d, 0xa8, 0xbd, 0xfd, 0x0a,
+    0x1d, 0x3d, 0x7a, 0x44, 0x40, 0x3c, 0xab, 0xc7, 0x70, 0xa6, 0x8d, 0x93, 0xf3, 0xd8, 0x81, 0x23,
+    0x70, 0x05, 0xce, 0xfd, 0x49, 0x3f, 0xa7, 0xf3, 0x18, 0xbb, 0xa5, 0xa5, 0xd9, 0x69, 0xfa, 0xd1,
+    0xee, 0xd2, 0xa5, 0x8b, 0xbc, 0x9e, 0x8d, 0x54, 0x56, 0x56, 0x46, 0x83, 0x06, 0x0d, 0x62, 0x58,
+    0x2a, 0x9e, 0x51, 0x8f, 0xf7, 0xce, 0xb4, 0x71, 0x76, 0x2e, 0xe0, 0x06, 0x1c, 0x81, 0xeb, 0x40,
+    0xa0, 0x1f, 0xf2, 0x89, 0xf4, 0xe4, 0x93, 0x4f, 0x52, 0x4e, 0x4e, 0x36, 0xfa, 0x0a, 0xb8, 0x74,
+    0xe9, 0x93, 0xa2, 0x5e, 0x91, 0xe1, 0x9e, 0xda, 0x7c, 0xd9, 0xe9, 0x07, 0x2d, 0xb9, 0xb9, 0xb9,
+    0x64, 0x36, 0x77, 0x50, 0x76, 0xf6, 0x04, 0x7e, 0x5e, 0xda, 0x85, 0x7e, 0xd4, 0x65, 0x67, 0x67,
+    0x8b, 0x36, 0xb9, 0xb9, 0x39, 0xff, 0x13, 0xf4, 0x2b, 0xb2, 0x0d, 0x5d, 0x66, 0x34, 0x1a, 0xa1,
+    0x97, 0xa9, 0xa2, 0x62, 0x0a, 0x9d, 0x3e, 0x7d, 0xaa, 0x8b, 0xfc, 0xa3, 0x0e, 0xef, 0xd0, 0x06,
+    0x6d, 0xd1, 0xe7, 0xcb, 0x2e, 0xff, 0xc8, 0xe7, 0xce, 0x9d, 0x85, 0x5e, 0xe6, 0xf2, 0x05, 0x62,
+    0xff, 0x89, 0xd6, 0xaf, 0x5f, 0xdf, 0x65, 0x5d, 0x15, 0x19, 0x78, 0xf5, 0xd5, 0xf5, 0xa2, 0x0d,
+    0xda, 0xa2, 0x0f, 0xfa, 0xf6, 0x46, 0xff, 0x0d, 0x44, 0xfa, 0xd1, 0x16, 0x6b, 0x8b, 0x7d, 0xbd,
+    0x76, 0x6d, 0x1d, 0x79, 0x7b, 0x7b, 0xd3, 0xe6, 0xcd, 0x9b, 0xa9, 0xb5, 0xb5, 0x45, 0xd8, 0x39,
+    0x64, 0x94, 0xdf, 0x78, 0x63, 0xb3, 0x78, 0xb7, 0x6e, 0xdd, 0x3a, 0xf1, 0x8c, 0x3e, 0xbd, 0x9d,
+    0x67, 0xa0, 0xd1, 0x8f, 0xf5, 0x83, 0x1d, 0x43, 0xb2, 0x58, 0x2c, 0x02, 0xce, 0x9a, 0x35, 0x8b,
+    0xe6, 0xce, 0x9d, 0xdb, 0x59, 0xa7, 0xd4, 0xa3, 0x0e, 0xef, 0x84, 0x83, 0xd5, 0xd1, 0x2e, 0x20,
+    0xfa, 0x3a, 0x2b, 0x03, 0x77, 0x8a, 0x7e, 0x94, 0x15, 0x3d, 0xa6, 0xae, 0x07, 0xde, 0x57, 0xae,
+    0xb4, 0xd1, 0xe1, 0xc3, 0x87, 0xa8, 0xba, 0xba, 0x5a, 0xf8, 0xac, 0x4f, 0x3c, 0x51, 0x45, 0xe3,
+    0xc6, 0x8d, 0xa3, 0xb1, 0x63, 0xc7, 0xb2, 0xbe, 0x7f, 0x82, 0xfd, 0xe8, 0x4a, 0x91, 0x51, 0x46,
+    0xfd, 0xa8, 0x51, 0xa3, 0x68, 0xfb, 0xf6, 0x7a, 0x5a, 0xb9, 0x72, 0xa5, 0x68, 0x7b, 0xe4, 0xc8,
+    0x61, 0x31, 0x86, 0x9a, 0x07, 0xd7, 0x9b, 0xef, 0x4e, 0xd0, 0xaf, 0xe8, 0x2e, 0x25, 0xa1, 0x0c,
+    0x5c, 0x15, 0x7f, 0x06, 0xb4, 0xc7, 0xc6, 0xc6, 0x12, 0xc7, 0x26, 0x14, 0x14, 0x18, 0x48, 0x83,
+    0x07, 0x0f, 0xa6, 0x88, 0xf0, 0x70, 0x8a, 0x88, 0x88, 0x10, 0x65, 0x7f, 0x7f, 0x7f, 0x91, 0x51,
+    0x8e, 0xe4, 0x3a, 0x8e, 0x5b, 0x68, 0x6c, 0x6a, 0xaa, 0xe8, 0x03, 0x3d, 0xa8, 0xd7, 0xeb, 0xc5,
+    0x18, 0x8a, 0x2f, 0x84, 0xb1, 0x1d, 0xe7, 0x53, 0xe3, 0x72, 0x3b, 0xe9, 0x57, 0x68, 0x84, 0x9e,
+    0xae, 0xaa, 0xaa, 0x12, 0xeb, 0x85, 0x35, 0x51, 0xf6, 0x2e, 0xd2, 0x8a, 0x15, 0x35, 0xe4, 0xe5,
+    0xe9, 0x49, 0x53, 0xa7, 0x4c, 0xa1, 0x72, 0xf6, 0x6d, 0x26, 0x97, 0x97, 0x53, 0x59, 0x69, 0xa9,
+    0xc8, 0x28, 0xab, 0x73, 0x69, 0x49, 0x89, 0xa8, 0x37, 0x1a, 0x0c, 0xa2, 0x3c, 0xb5, 0xa2, 0x42,
+    0xf4, 0xc5, 0x18, 0x48, 0x18, 0x13, 0x63, 0x37, 0x35, 0x35, 0x89, 0xb9, 0x30, 0x27, 0xe6, 0x56,
+    0x78, 0x73, 0xbb, 0xe9, 0xc7, 0x5a, 0xc0, 0x4f, 0x85, 0xcf, 0x96, 0x9e, 0x9e, 0x4e, 0x19, 0x19,
+    0x19, 0x64, 0x32, 0x19, 0x85, 0xff, 0xde, 0xdc, 0xdc, 0x4c, 0x08, 0x47, 0x38, 0x4e, 0xe4, 0x75,
+    0x0f, 0x12, 0xb4, 0x17, 0x16, 0x14, 0x50, 0x51, 0x61, 0x61, 0x8f, 0xb9, 0xb8, 0xa8, 0x48, 0xb4,
+    0x45, 0x1f, 0xf4, 0xc5, 0x18, 0x18, 0x0b, 0x63, 0x62, 0x6c, 0xd8, 0x46, 0xcc, 0x85, 0x39, 0x31,
+    0x37, 0x70, 0x50, 0x64, 0xee, 0x76, 0xd1, 0xaf, 0xe8, 0xb5, 0x63, 0xc7, 0x8e, 0x52, 0x54, 0x54,
+    0x14, 0x35, 0x34, 0x34, 0x08, 0x7f, 0x15, 0xbe, 0x2b, 0x64, 0xb9, 0xae, 0x6e, 0x8d, 0x58, 0xb3,
+    0xc5, 0x8b, 0x17, 0x8b, 0x67, 0xac, 0xaf, 0x42, 0x9b, 0x33, 0x19, 0x6d, 0xd1, 0x07, 0x7d, 0x31,
+    0x06, 0x52, 0x5d, 0x5d, 0x9d, 0x78, 0xc6, 0x1c, 0x98, 0xab, 0xa1, 0xe1, 0xb8, 0x98, 0x1b, 0x38,
+    0x28, 0x7a, 0xf2, 0x4e, 0xac, 0x7f, 0x29, 0xcb, 0x2c, 0xd6, 0x22, 0x2d, 0x2d, 0x8d, 0xa6, 0x4e,
+    0xad, 0x60, 0xfb, 0xbe, 0x4e, 0xd8, 0x31, 0xc4, 0xca, 0xa9, 0xbc, 0x97, 0xb1, 0xdf, 0x21, 0xd7,
+    0xbd, 0xa5, 0x1f, 0x7d, 0xd0, 0x17, 0x63, 0x60, 0x2c, 0x8c, 0x89, 0xb1, 0x31, 0x07, 0xe6, 0xc2,
+    0x9c, 0xe5, 0xe5, 0x77, 0x66, 0xfd, 0xd5, 0xfb, 0x1f, 0xf6, 0xbb, 0xaa, 0x6a, 0x89, 0xd8, 0x93,
+    0xca, 0xbe, 0x87, 0x7d, 0x87, 0x2d, 0x4b, 0x4d, 0x4d, 0x11, 0xba, 0xee, 0xa6, 0xe9, 0xe7, 0xbe,
+    0x18, 0x03, 0x63, 0x61, 0x4c, 0x45, 0x0f, 0x48, 0xfb, 0x7f, 0x89, 0x90, 0x83, 0x3b, 0xb5, 0xff,
+    0xaf, 0xa7, 0xff, 0xa1, 0x03, 0xe1, 0xeb, 0x20, 0x2d, 0x59, 0xb2, 0x84, 0xfc, 0xfa, 0x20, 0xff,
+    0xe8, 0x8b, 0x31, 0x90, 0x30, 0x26, 0xc6, 0x1e, 0x28, 0xfa, 0xff, 0x46, 0xf6, 0x18, 0x32, 0x61,
+    0xb3, 0x59, 0x85, 0x6d, 0x87, 0x7d, 0xbb, 0x59, 0xfa, 0xd1, 0x17, 0x63, 0x60, 0x2c, 0x8c, 0x39,
+    0xd0, 0xec, 0xff, 0xff, 0x3b, 0xfd, 0xff, 0xc3, 0xf2, 0xaf, 0x93, 0xef, 0x17, 0xdc, 0x7a, 0xe3,
+    0xff, 0xdc, 0x5e, 0xfd, 0xe7, 0xb4, 0xff, 0xe3, 0x26, 0xd3, 0xa2, 0xeb, 0x05, 0xed, 0x5a, 0x07,
+    0xde, 0x05, 0xf7, 0xe4, 0xff, 0xa4, 0xa5, 0x8d, 0x67, 0xdb, 0x34, 0xf5, 0x36, 0xd9, 0xbf, 0xf1,
+    0xce, 0xf8, 0x3f, 0xc1, 0x0e, 0x34, 0x38, 0x73, 0x7f, 0xa3, 0x95, 0xcf, 0xcd, 0xe3, 0x19, 0x2c,
+    0xe0, 0xbc, 0xd0, 0xd7, 0xd7, 0x37, 0x86, 0xe1, 0x20, 0x1e, 0xf3, 0xc2, 0x9d, 0xf5, 0x7f, 0xd6,
+    0xf4, 0xc6, 0xff, 0xb9, 0x00, 0x9c, 0x7d, 0x7d, 0x7c, 0x80, 0xfb, 0x42, 0xd0, 0x22, 0xd3, 0x74,
+    0xa3, 0xfd, 0xa0, 0xf0, 0xa6, 0x80, 0xe3, 0x95, 0x56, 0xc8, 0x1e, 0xb2, 0xab, 0xab, 0xeb, 0x25,
+    0xae, 0x7b, 0x20, 0x30, 0x30, 0xf0, 0xc4, 0x27, 0x9f, 0x1c, 0xb8, 0xae, 0xff, 0x03, 0x9f, 0x14,
+    0xbe, 0x69, 0x17, 0xff, 0x37, 0xe8, 0xaa, 0xff, 0xab, 0xd0, 0xd6, 0x53, 0x76, 0xd6, 0xff, 0xed,
+    0xce, 0xff, 0x01, 0x8e, 0xc0, 0x15, 0x38, 0x03, 0x77, 0x85, 0x0e, 0xd0, 0x24, 0x5f, 0x89, 0x6b,
+    0xba, 0x93, 0x83, 0x98, 0x98, 0x18, 0x85, 0x2f, 0x7b, 0x92, 0x47, 0x8e, 0x04, 0xff, 0xdb, 0x59,
+    0x06, 0x2d, 0x69, 0xe3, 0xc7, 0x23, 0x16, 0x6b, 0x0f, 0x0c, 0x0c, 0xb0, 0x38, 0x9e, 0x5b, 0xa9,
+    0xfd, 0x1f, 0x69, 0x3f, 0x76, 0x8d, 0x7f, 0x3c, 0x11, 0xff, 0x70, 0x2c, 0x83, 0x98, 0x06, 0xb1,
+    0x0d, 0xe4, 0x1a, 0x65, 0xc7, 0xf8, 0x47, 0x1d, 0x17, 0x81, 0x76, 0xc4, 0x4c, 0xdd, 0xc7, 0x3f,
+    0x92, 0xbe, 0xe9, 0xce, 0xff, 0x51, 0xce, 0xd1, 0x80, 0x2b, 0x70, 0x06, 0xee, 0xa0, 0x01, 0xb4,
+    0x80, 0x26, 0xd0, 0x06, 0x02, 0xa3, 0x22, 0x23, 0xb5, 0xd7, 0xd1, 0xf3, 0xfe, 0xcc, 0xb3, 0xd3,
+    0x05, 0xf9, 0xf9, 0x58, 0x2b, 0x3b, 0xd6, 0xa1, 0xc4, 0x64, 0xb2, 0x67, 0x65, 0x66, 0xda, 0x10,
+    0x8f, 0xd6, 0xd6, 0x3e, 0x2f, 0x70, 0x91, 0xef, 0x1c, 0x7a, 0x8c, 0x7f, 0x0f, 0x1d, 0x3a, 0xc4,
+    0x31, 0xac, 0x14, 0xcb, 0x22, 0xa6, 0x45, 0x6c, 0x8b, 0x18, 0x37, 0xb2, 0x9b, 0xf8, 0x57, 0xac,
+    0x13, 0xef, 0x77, 0x94, 0x11, 0x2b, 0x23, 0x66, 0x46, 0x1f, 0x67, 0xe3, 0x5f, 0xe5, 0x0c, 0xad,
+    0xb6, 0xb6, 0x56, 0xcc, 0x07, 0x9c, 0x81, 0xbb, 0x2c, 0x77, 0x76, 0xd0, 0xc4, 0xb4, 0x9d, 0xe2,
+    0x77, 0x7e, 0xdd, 0xed, 0x03, 0xf5, 0xfa, 0x8f, 0x4a, 0x4e, 0x16, 0x7c, 0x53, 0x62, 0x36, 0x1e,
+    0x87, 0x32, 0x33, 0x33, 0xc5, 0xb8, 0xcf, 0x3c, 0xb3, 0x4a, 0xc8, 0xa3, 0x9a, 0x07, 0x37, 0x3a,
+    0xff, 0xc0, 0x19, 0x06, 0xd6, 0xeb, 0xc7, 0x3f, 0x5e, 0x49, 0x3b, 0x76, 0x6c, 0x17, 0x67, 0x1c,
+    0x38, 0xeb, 0x70, 0x3c, 0xff, 0xc0, 0x99, 0x08, 0xea, 0xa1, 0xdb, 0x71, 0x56, 0x52, 0x5d, 0xbd,
+    0x5c, 0xd0, 0xee, 0xcc, 0xf9, 0x87, 0x42, 0xfb, 0xaa, 0x55, 0xab, 0x04, 0x8e, 0xc0, 0x15, 0x38,
+    0x2b, 0x7b, 0x09, 0xb4, 0x80, 0x26, 0x65, 0xfd, 0xa3, 0xa3, 0xa2, 0xba, 0xd3, 0x01, 0xca, 0x5d,
+    0x59, 0xa1, 0x8b, 0x4e, 0xd7, 0x31, 0x8e, 0xf1, 0x29, 0x35, 0x99, 0x6c, 0xca, 0x9e, 0xc4, 0x78,
+    0x39, 0xd9, 0xd9, 0x62, 0xfc, 0x57, 0x5e, 0x79, 0x99, 0xec, 0x76, 0x5b, 0xa7, 0x4f, 0xe2, 0xcc,
+    0xf9, 0x97, 0x72, 0xa6, 0x35, 0x7b, 0x76, 0xcf, 0xe7, 0x5f, 0x4a, 0x9d, 0x33, 0xe7, 0x5f, 0x78,
+    0x8f, 0x54, 0x53, 0x53, 0x23, 0x70, 0x03, 0x8e, 0x0a, 0xed, 0xc8, 0xa0, 0x01, 0xb4, 0xb0, 0x3c,
+    0x75, 0x80, 0x36, 0x07, 0x5a, 0xaf, 0xa7, 0x03, 0x0d, 0xac, 0x2f, 0x5b, 0x53, 0x52, 0x52, 0xb0,
+    0x57, 0x3b, 0x79, 0x80, 0x7d, 0x9b, 0xce, 0xb1, 0xd7, 0x43, 0x33, 0x66, 0x08, 0xdc, 0x20, 0x07,
+    0x8a, 0xbc, 0xf7, 0x74, 0xfe, 0x89, 0xbd, 0xab, 0xd8, 0xc6, 0x1b, 0x9d, 0x7f, 0xe2, 0x8c, 0x14,
+    0xbe, 0xce, 0x8d, 0xce, 0x3f, 0x31, 0x27, 0xe4, 0x0f, 0x7d, 0x21, 0x1f, 0xf0, 0x91, 0x40, 0x7b,
+    0x5e, 0x6e, 0xee, 0xb5, 0xb4, 0x33, 0xee, 0xa9, 0x4c, 0x03, 0x68, 0x01, 0x4d, 0xd7, 0xd3, 0x7d,
+    0x8e, 0x57, 0xbe, 0x62, 0x73, 0x68, 0xb5, 0x79, 0x9c, 0x2f, 0x8d, 0x66, 0x79, 0xe5, 0x71, 0xac,
+    0xca, 0x98, 0x86, 0x49, 0x93, 0x68, 0x52, 0x71, 0x31, 0x4d, 0x9c, 0x38, 0x51, 0xd8, 0x26, 0xc8,
+    0x81, 0xa2, 0x7f, 0x6e, 0xf5, 0xf9, 0x37, 0x68, 0x96, 0xf6, 0x55, 0x2b, 0xcf, 0x6b, 0x15, 0x7d,
+    0x1a, 0x1b, 0x4f, 0x51, 0xe2, 0xd0, 0x78, 0x2a, 0xc8, 0xcf, 0x63, 0xbd, 0x59, 0x2a, 0xe4, 0x5d,
+    0xd6, 0x5b, 0x96, 0xd1, 0xa3, 0x47, 0x13, 0x68, 0x00, 0x2d, 0x6a, 0xda, 0x9c, 0xb9, 0xf6, 0x96,
+    0x79, 0x90, 0xc1, 0xe0, 0x2c, 0x74, 0xa7, 0x9a, 0x07, 0xd0, 0xe3, 0x99, 0x6c, 0x83, 0xc0, 0xf3,
+    0xd9, 0xb3, 0x67, 0x77, 0xf2, 0xc0, 0x11, 0x5f, 0xf5, 0xfd, 0x07, 0xce, 0x86, 0xa4, 0xfb, 0x8f,
+    0x8a, 0x1b, 0xdc, 0x7f, 0x54, 0x88, 0x36, 0x68, 0xab, 0xdc, 0x7f, 0x28, 0x3c, 0x44, 0x46, 0x1c,
+    0x60, 0x31, 0x77, 0xd0, 0x07, 0xfb, 0x3e, 0xa4, 0x9f, 0xff, 0xe2, 0x77, 0xf4, 0x83, 0xaa, 0xa7,
+    0x28, 0x33, 0xa7, 0x98, 0x42, 0x86, 0xe8, 0x29, 0x61, 0xd8, 0x28, 0xb6, 0x89, 0x59, 0x4c, 0xb7,
+    0x81, 0xee, 0x2a, 0x2f, 0xb3, 0xa7, 0x8c, 0x19, 0x83, 0xb1, 0xce, 0xf2, 0xda, 0x67, 0xf4, 0x92,
+    0xf6, 0x6b, 0x78, 0xc0, 0xfd, 0x53, 0x18, 0x9c, 0x1a, 0x9e, 0x94, 0x74, 0x0d, 0x0f, 0x20, 0x67,
+    0x90, 0x03, 0xe0, 0xfb, 0xe0, 0x83, 0xdf, 0x14, 0x7b, 0x41, 0xc1, 0xf5, 0x7a, 0xf7, 0x5f, 0xd0,
+    0x01, 0x3d, 0xdd, 0x7f, 0xa1, 0x8d, 0xfa, 0xfe, 0x4b, 0xb9, 0x3b, 0xb0, 0x5a, 0xcd, 0xf4, 0x87,
+    0xd5, 0x7f, 0xa1, 0xd4, 0xb4, 0x6c, 0x8a, 0x0c, 0xf5, 0xa1, 0xac, 0x11, 0x1e, 0x34, 0x3d, 0xdf,
+    0x87, 0x66, 0xdd, 0x1d, 0x42, 0x33, 0x26, 0x87, 0x53, 0xe1, 0x38, 0x3f, 0x0a, 0x0b, 0xf4, 0x20,
+    0x17, 0xf7, 0x41, 0x34, 0x7c, 0xe4, 0x18, 0xca, 0x48, 0x1b, 0xbb, 0x88, 0x71, 0x8b, 0xec, 0x61,
+    0xbf, 0x3b, 0xc5, 0x03, 0xd6, 0x1d, 0xf8, 0x9c, 0xee, 0x8b, 0xc4, 0x61, 0xc3, 0xba, 0xec, 0x05,
+    0xc8, 0x82, 0x4e, 0xab, 0xa5, 0xaf, 0x7f, 0x7d, 0xba, 0xb8, 0xbb, 0x83, 0x8f, 0xa2, 0xf0, 0xe0,
+    0xda, 0xbb, 0xcd, 0x1c, 0xf9, 0x6e, 0x33, 0xe7, 0x06, 0xf7, 0x9f, 0x39, 0xaa, 0xfb, 0xcf, 0xa5,
+    0x64, 0x27, 0x9b, 0xd8, 0x07, 0xc7, 0x8e, 0x1e, 0xa1, 0x2c, 0x5e, 0xe7, 0x88, 0x00, 0x0d, 0xfd,
+    0xf4, 0x7b, 0x31, 0x74, 0x70, 0x6d, 0x1e, 0xb5, 0x6e, 0x37, 0x91, 0xf9, 0xef, 0x65, 0xd4, 0xf1,
+    0x6e, 0x09, 0x5d, 0xd9, 0x69, 0xa4, 0xe6, 0x6d, 0x06, 0x3a, 0xb4, 0x6e, 0x22, 0xbd, 0xf0, 0x78,
+    0x92, 0x3d, 0x31, 0xda, 0x0b, 0xeb, 0xf2, 0xe7, 0xe8, 0x30, 0xaf, 0xc1, 0x4e, 0xee, 0xf9, 0x1e,
+    0x79, 0xc0, 0xb6, 0x13, 0xfe, 0xe3, 0xa1, 0x84, 0x84, 0x04, 0xf0, 0xc0, 0xa2, 0xe6, 0x81, 0x89,
+    0x7d, 0x32, 0x7e, 0x4f, 0x77, 0xdd, 0x75, 0x97, 0xd0, 0x47, 0x97, 0x2f, 0x5f, 0xea, 0xb4, 0x8f,
+    0xd2, 0xdd, 0xf6, 0x69, 0xf6, 0x13, 0x4b, 0x84, 0xef, 0x0a, 0x7f, 0x51, 0x7d, 0xb7, 0x77, 0xf5,
+    0xfe, 0xfb, 0x6a, 0x1b, 0xdc, 0x7f, 0x9f, 0x3c, 0x79, 0x92, 0xac, 0x16, 0x33, 0xed, 0xdb, 0xb7,
+    0x8f, 0xfc, 0x02, 0xc2, 0xe8, 0x9b, 0x06, 0x3f, 0x3a, 0xb7, 0xc5, 0x40, 0xed, 0xbb, 0x4a, 0xa8,
+    0xf1, 0x8d, 0x22, 0x3a, 0xfe, 0x5a, 0x01, 0x1d, 0xfd, 0x6b, 0x3e, 0x7d, 0xbe, 0xa1, 0x80, 0xbe,
+    0xd8, 0x58, 0x20, 0x9e, 0x51, 0xdf, 0xb6, 0xc3, 0x48, 0x67, 0xfe, 0x56, 0x6c, 0x9b, 0x35, 0x25,
+    0x1a, 0x3c, 0x38, 0xe6, 0xe3, 0x29, 0xd6, 0x8e, 0xf7, 0x72, 0x9f, 0x78, 0x20, 0xe4, 0xc7, 0xdd,
+    0xdd, 0x3d, 0x8a, 0xc1, 0x81, 0x38, 0xbd, 0xfe, 0x1a, 0x1e, 0x60, 0x1f, 0xc0, 0x36, 0xf0, 0x7b,
+    0x32, 0x18, 0x26, 0x09, 0x5f, 0x15, 0xf6, 0x01, 0x3c, 0x50, 0x7f, 0xdb, 0x00, 0x5f, 0xa0, 0xa7,
+    0xef, 0x1f, 0xd0, 0x06, 0x6b, 0xae, 0x94, 0x83, 0x43, 0x22, 0x68, 0xd9, 0xb7, 0xa3, 0x89, 0xf6,
+    0x4e, 0xa6, 0x93, 0x9b, 0x0a, 0x05, 0xad, 0x27, 0x5e, 0x2f, 0x14, 0xe5, 0x96, 0x7a, 0x23, 0x5d,
+    0xda, 0x3a, 0x89, 0x4e, 0x6d, 0xce, 0x17, 0xcf, 0xa8, 0xc7, 0x7b, 0x94, 0x69, 0x4f, 0x89, 0x79,
+    0xc5, 0xec, 0x44, 0xf0, 0xe0, 0x70, 0x90, 0x9f, 0x5b, 0x38, 0xf0, 0xf7, 0x70, 0xeb, 0xd3, 0xf7,
+    0x40, 0x82, 0x07, 0x5e, 0x5e, 0x5e, 0xf8, 0x0e, 0xea, 0x43, 0xf6, 0x97, 0x60, 0x5b, 0x2d, 0x8a,
+    0x4f, 0x0f, 0x1e, 0xc0, 0x7f, 0xe5, 0xf7, 0x62, 0xaf, 0x43, 0x87, 0x43, 0x96, 0x15, 0x1e, 0xc8,
+    0xf1, 0xc9, 0x75, 0xed, 0xa5, 0xba, 0x0d, 0xfa, 0x58, 0xcc, 0xed, 0x94, 0x5f, 0x68, 0xa2, 0x19,
+    0xa5, 0x81, 0x4c, 0x7b, 0x39, 0xaf, 0x73, 0x7e, 0x27, 0xdd, 0x0d, 0xaf, 0x17, 0xd0, 0xc5, 0xad,
+    0x06, 0x5a, 0x7c, 0x7f, 0x34, 0xe5, 0xa5, 0xf8, 0xd1, 0xd1, 0x8d, 0x26, 0x5e, 0x7b, 0xe6, 0xcb,
+    0xa6, 0xc2, 0x4e, 0x3e, 0x40, 0x2e, 0x68, 0x77, 0x89, 0x79, 0xce, 0x3d, 0x31, 0xe0, 0xc1, 0x06,
+    0x49, 0x97, 0x69, 0x75, 0x6e, 0xae, 0x7d, 0xfa, 0x24, 0x4a, 0xf0, 0xc0, 0xc7, 0xdb, 0x3b, 0x90,
+    0xc1, 0x5e, 0xf6, 0xa3, 0x85, 0x9d, 0x51, 0x78, 0x00, 0x58, 0xce, 0x3c, 0xe0, 0x98, 0x91, 0xd2,
+    0xd2, 0xd3, 0xc4, 0xde, 0xc6, 0x5a, 0x2a, 0xb6, 0xce, 0x99, 0x7b, 0x43, 0xb4, 0x85, 0x6d, 0x5b,
+    0xfd, 0xa7, 0x97, 0x69, 0x68, 0x84, 0x2b, 0x9d, 0x65, 0x99, 0x57, 0x68, 0x02, 0x04, 0x1f, 0xce,
+    0xbf, 0x6d, 0xa0, 0x57, 0x57, 0x24, 0x53, 0x44, 0x94, 0x9e, 0x0e, 0x1e, 0xfe, 0x9c, 0xee, 0x99,
+    0x52, 0x46, 0x6b, 0x96, 0x0d, 0xa3, 0x0b, 0x5b, 0x8d, 0x82, 0x6e, 0x75, 0xfb, 0xb3, 0x6f, 0x15,
+    0x5b, 0x93, 0xe3, 0x7d, 0xc1, 0x83, 0xbb, 0x05, 0x0f, 0xb4, 0x9a, 0x3e, 0x7d, 0x13, 0xc5, 0x36,
+    0x51, 0xf4, 0xf7, 0xf3, 0xf3, 0x83, 0x6e, 0xd9, 0x09, 0x9f, 0xbd, 0xc4, 0x68, 0xbc, 0x96, 0x07,
+    0x1c, 0xbf, 0xf0, 0x7b, 0x82, 0xfd, 0x3d, 0x79, 0xf2, 0x84, 0xd0, 0x09, 0xce, 0x7e, 0xc7, 0x00,
+    0x19, 0xb0, 0x58, 0xda, 0x29, 0x73, 0x42, 0x3e, 0xfd, 0xec, 0x11, 0x3d, 0xb5, 0xef, 0x2c, 0xe9,
+    0x94, 0x69, 0xe4, 0xe6, 0x6d, 0x46, 0xa2, 0x7d, 0x5f, 0xa3, 0xcd, 0x3f, 0x19, 0x4d, 0x31, 0xfa,
+    0x61, 0xf4, 0x4e, 0xfd, 0xdf, 0x69, 0x48, 0x44, 0x2c, 0xbd, 0xf9, 0x74, 0x0a, 0xd7, 0xdf, 0x2d,
+    0xde, 0x2b, 0x6d, 0xd1, 0xaf, 0x7d, 0xa7, 0xd1, 0x5a, 0xfb, 0xd8, 0x08, 0xd0, 0xbf, 0x45, 0x1c,
+    0x64, 0xf8, 0xb9, 0xf7, 0xf9, 0x1b, 0x4e, 0xe6, 0x81, 0x8e, 0xe5, 0x5c, 0x13, 0x16, 0x16, 0x86,
+    0x6f, 0xac, 0xb6, 0x30, 0x84, 0x0e, 0x34, 0x63, 0x0f, 0x28, 0x3c, 0x40, 0x1c, 0x87, 0x38, 0x26,
+    0x31, 0x31, 0x91, 0x3e, 0xff, 0xfc, 0x98, 0xb0, 0x6b, 0x3d, 0xf1, 0x40, 0xf1, 0x6d, 0xde, 0x67,
+    0xfb, 0xae, 0x8f, 0xf0, 0xa3, 0xcf, 0xd6, 0xe6, 0x0a, 0x9d, 0x86, 0xb5, 0x3c, 0xc1, 0x32, 0x7f,
+    0x6e, 0xcb, 0x24, 0xaa, 0x7e, 0x28, 0x96, 0x0a, 0xc6, 0xb8, 0xd2, 0xbe, 0xd5, 0xb9, 0xf4, 0xe2,
+    0xf7, 0x47, 0x50, 0x5c, 0xa8, 0x86, 0x9e, 0x9e, 0x9b, 0x48, 0xef, 0xfd, 0x36, 0x8b, 0x0a, 0xc7,
+    0xb8, 0x89, 0xf7, 0x68, 0x87, 0xf6, 0xe8, 0xc7, 0xfd, 0xed, 0x9f, 0xad, 0x9d, 0x48, 0x43, 0x02,
+    0x3d, 0xda, 0x18, 0x57, 0x7d, 0x3f, 0xd8, 0x83, 0x4e, 0x1e, 0x00, 0xc6, 0xc7, 0xc5, 0xb9, 0x33,
+    0x78, 0x1d, 0x7e, 0x1b, 0xdb, 0xc2, 0x4e, 0x1e, 0x28, 0x67, 0x18, 0x88, 0xf7, 0x70, 0x8f, 0x89,
+    0x73, 0x09, 0xd8, 0xc7, 0x1b, 0xf1, 0x00, 0x76, 0xc1, 0x66, 0x33, 0xd3, 0xaf, 0x7e, 0xfb, 0x12,
+    0x65, 0x27, 0x7b, 0x0a, 0x1b, 0x07, 0xbd, 0x8e, 0x75, 0xbc, 0xfc, 0x8e, 0x91, 0x5e, 0x7c, 0x2c,
+    0x9e, 0x46, 0x8e, 0x4e, 0xa3, 0x85, 0x4b, 0x6a, 0xc8, 0xd7, 0x43, 0x43, 0x2f, 0x55, 0x0d, 0xa3,
+    0x03, 0x2f, 0x67, 0xd3, 0x17, 0x1b, 0x72, 0x69, 0xb8, 0x7e, 0x30, 0x55, 0x2e, 0xa8, 0xa6, 0xe4,
+    0x31, 0x69, 0xdc, 0x2e, 0x81, 0x2e, 0x71, 0xfb, 0xe3, 0xb2, 0x5d, 0x68, 0xad, 0x37, 0x58, 0x8b,
+    0xd3, 0x82, 0x20, 0x03, 0x53, 0xfa, 0xe8, 0x0f, 0x74, 0xc7, 0x03, 0x2d, 0xeb, 0x00, 0x8c, 0xb7,
+    0x16, 0x67, 0x1d, 0x6c, 0x0f, 0xbb, 0xf0, 0x20, 0x22, 0x5c, 0x3a, 0x83, 0xd8, 0xbf, 0x7f, 0xbf,
+    0x88, 0x6d, 0x40, 0xa7, 0x23, 0xed, 0xd0, 0x79, 0xb0, 0x9b, 0x48, 0x0f, 0xcf, 0x5d, 0x40, 0xf7,
+    0x16, 0x0c, 0x22, 0xf3, 0xbb, 0xa5, 0x82, 0xf6, 0x06, 0xa6, 0x01, 0xb2, 0xfd, 0xbb, 0x45, 0xc3,
+    0x98, 0xbe, 0x74, 0xd1, 0xe6, 0xad, 0x2d, 0x5b, 0xb9, 0x3c, 0x9e, 0x02, 0xfc, 0x07, 0xd3, 0xef,
+    0x7f, 0xf9, 0x53, 0x96, 0xaf, 0x2b, 0x5c, 0x6b, 0xa3, 0xd1, 0xa9, 0x99, 0xa2, 0x1d, 0xda, 0x37,
+    0xc8, 0xbc, 0x33, 0xbf, 0x6b, 0xb2, 0x7c, 0xab, 0x3c, 0x12, 0xf4, 0xcf, 0xbf, 0x49, 0x5f, 0xb0,
+    0x27, 0x1e, 0xe8, 0x78, 0x72, 0xf1, 0x8d, 0x68, 0x40, 0x40, 0x00, 0x6c, 0x81, 0x19, 0x7e, 0x81,
+    0x9a, 0x07, 0x31, 0xd1, 0xd1, 0x14, 0x1c, 0x1c, 0xcc, 0xf6, 0xfc, 0x03, 0xe1, 0xc7, 0xaa, 0x79,
+    0x20, 0xad, 0xbb, 0x95, 0xde, 0x7f, 0xff, 0x9f, 0xf4, 0xc3, 0xa7, 0x96, 0x53, 0x44, 0x4c, 0x22,
+    0x3d, 0x72, 0x4f, 0x04, 0xfb, 0x35, 0x26, 0x21, 0xc3, 0x0d, 0xaf, 0x15, 0x0a, 0xbf, 0x67, 0xe7,
+    0x8b, 0xe9, 0x74, 0xbf, 0x31, 0x84, 0xa2, 0x13, 0x52, 0xe9, 0x3f, 0x9f, 0x1e, 0x14, 0x7c, 0xb0,
+    0xd9, 0x6c, 0x02, 0xfe, 0x7b, 0xff, 0x27, 0x14, 0x33, 0x74, 0x2c, 0xdd, 0x6f, 0x08, 0xa1, 0x1d,
+    0x2f, 0xa4, 0x8b, 0xf6, 0xe8, 0x87, 0xfe, 0xa0, 0x5f, 0xb6, 0x03, 0xcb, 0xfa, 0x9b, 0x7e, 0x99,
+    0x07, 0xea, 0xb3, 0xc5, 0x5f, 0x41, 0xf7, 0xb1, 0x0e, 0xb0, 0x38, 0xf2, 0x20, 0x2e, 0x2e, 0x4e,
+    0xe8, 0xc5, 0xdd, 0xbb, 0x77, 0x77, 0xc6, 0xcf, 0xc8, 0x28, 0xef, 0xdd, 0xbb, 0x57, 0x9c, 0x85,
+    0xc4, 0xeb, 0x63, 0x68, 0x48, 0x64, 0x02, 0xcd, 0x28, 0x1f, 0xc2, 0xf2, 0x6f, 0x84, 0xfe, 0xa6,
+    0x69, 0x85, 0xa1, 0x34, 0x32, 0x25, 0x87, 0x7d, 0x81, 0x50, 0x5a, 0x57, 0x33, 0x86, 0x6a, 0xe7,
+    0x0f, 0x25, 0x3f, 0x6f, 0x0d, 0x25, 0x8d, 0x18, 0x4d, 0xf9, 0x45, 0xa5, 0xc2, 0xdf, 0x0d, 0xf0,
+    0xd5, 0x52, 0x6d, 0xe5, 0x50, 0xf1, 0x1e, 0xed, 0xd0, 0x7e, 0x3a, 0xf7, 0x43, 0x7f, 0xd6, 0x81,
+    0xca, 0xfa, 0x3f, 0x76, 0x2b, 0xe8, 0x57, 0x7d, 0x6b, 0xac, 0xec, 0xab, 0x67, 0xe1, 0xc7, 0x71,
+    0x1c, 0x06, 0x1e, 0xd8, 0xd5, 0x3c, 0x18, 0x36, 0x74, 0x28, 0xf9, 0xf8, 0xf8, 0x50, 0x7d, 0xfd,
+    0xb6, 0xce, 0x73, 0x1c, 0x7c, 0xf3, 0x01, 0x9b, 0x99, 0x10, 0x9f, 0x40, 0xd3, 0xa6, 0x56, 0x90,
+    0x3e, 0x7e, 0x04, 0x15, 0x8f, 0xf7, 0xa7, 0x66, 0xf6, 0x6f, 0x4e, 0x6c, 0x2a, 0x22, 0x7d, 0x98,
+    0x0b, 0xfd, 0xe3, 0x9f, 0xfb, 0x68, 0xf7, 0x9e, 0xbd, 0xc4, 0x93, 0xd0, 0xef, 0x17, 0x27, 0xb1,
+    0xad, 0x33, 0x51, 0xfd, 0xf3, 0x63, 0xe9, 0xe5, 0x65, 0x89, 0x02, 0xe2, 0x19, 0xf5, 0x8c, 0x05,
+    0xed, 0xd9, 0xf3, 0x9e, 0x68, 0x8f, 0x7e, 0x27, 0xb9, 0x3f, 0xf3, 0xd1, 0x5a, 0x74, 0x0b, 0xf6,
+    0x7f, 0x0f, 0x3c, 0x58, 0x09, 0x9a, 0x0a, 0xf2, 0xf3, 0x2d, 0xac, 0x17, 0xed, 0xea, 0x73, 0x4d,
+    0xc4, 0x52, 0x88, 0xf5, 0x57, 0x3d, 0xb3, 0x4a, 0x64, 0xf0, 0x23, 0x89, 0xeb, 0xf0, 0xce, 0xc0,
+    0xba, 0x23, 0x23, 0x63, 0x02, 0x85, 0x07, 0x7b, 0xd9, 0x3e, 0xad, 0xcb, 0x13, 0x7b, 0xa0, 0x7a,
+    0x46, 0x2c, 0x45, 0xc5, 0x26, 0x51, 0x5b, 0x6b, 0x0b, 0xed, 0xfb, 0xf0, 0x23, 0x0a, 0x8f, 0x4a,
+    0xa0, 0xc4, 0x08, 0x0d, 0x3d, 0x36, 0x3d, 0x98, 0x56, 0x3d, 0x1c, 0x2d, 0x20, 0x9e, 0x87, 0x44,
+    0xc6, 0x33, 0xed, 0x7b, 0xc5, 0x79, 0x02, 0xda, 0xc3, 0x16, 0x70, 0x7f, 0xfb, 0x7f, 0xd6, 0xe4,
+    0xd1, 0x90, 0xa0, 0xfe, 0xd5, 0xff, 0x3d, 0xf0, 0x40, 0x91, 0xaf, 0x65, 0xa0, 0x73, 0x62, 0x5e,
+    0x5e, 0x27, 0x0f, 0xc4, 0xd9, 0x3e, 0xfb, 0xca, 0x38, 0x93, 0xf1, 0xf0, 0xf0, 0x10, 0x19, 0x65,
+    0xf8, 0x8e, 0x9d, 0xe7, 0x6d, 0x46, 0x03, 0x79, 0x7a, 0xfb, 0xd3, 0x2f, 0x16, 0x0c, 0xb7, 0xb5,
+    0xd4, 0x1b, 0xe8, 0x32, 0xdb, 0xf4, 0xef, 0x94, 0x87, 0x50, 0x40, 0x48, 0x2c, 0xd3, 0xff, 0xb1,
+    0x90, 0x99, 0xb7, 0xdf, 0xd9, 0x49, 0x8f, 0x54, 0x2e, 0xa2, 0x7b, 0xbf, 0xf1, 0x90, 0x80, 0xef,
+    0xd4, 0xef, 0x92, 0x84, 0x89, 0xf7, 0xd2, 0x88, 0x51, 0xe3, 0xe8, 0x41, 0x53, 0x00, 0xcb, 0x8f,
+    0x89, 0xda, 0xb6, 0x1b, 0xfa, 0xdd, 0xfe, 0xf7, 0x92, 0x07, 0x0b, 0x71, 0x8e, 0x9b, 0x9b, 0x93,
+    0x63, 0x65, 0x1f, 0xa1, 0x93, 0x07, 0x88, 0x99, 0x94, 0x33, 0x5f, 0x94, 0x55, 0xb1, 0x84, 0x7d,
+    0x72, 0x79, 0x19, 0xc5, 0xc5, 0x27, 0xfd, 0x6b, 0xa4, 0xde, 0xab, 0xad, 0xe9, 0xcd, 0x62, 0x61,
+    0xcb, 0xdb, 0x76, 0x94, 0xd0, 0xd3, 0x73, 0xe2, 0xc8, 0xd7, 0x53, 0x43, 0xa6, 0xb2, 0xa9, 0xb4,
+    0xe9, 0xcd, 0xad, 0x74, 0xba, 0xf1, 0x0c, 0x35, 0xb7, 0xb4, 0xb2, 0xfe, 0x3c, 0x4b, 0x75, 0xeb,
+    0x5f, 0xa7, 0xc7, 0x17, 0x54, 0x51, 0xc3, 0x9e, 0x15, 0xb4, 0xed, 0xb9, 0x54, 0x11, 0x2b, 0x75,
+    0xe7, 0xff, 0x69, 0xb5, 0xb7, 0x46, 0xf6, 0xbb, 0x38, 0xca, 0x2e, 0x2e, 0x6a, 0x1e, 0x3c, 0x8a,
+    0x75, 0xe6, 0xf8, 0xfe, 0x1a, 0x1e, 0x38, 0x66, 0xb6, 0xa3, 0xb6, 0xac, 0xcc, 0x4c, 0x9c, 0xdf,
+    0x9f, 0x59, 0xf4, 0xf0, 0x64, 0x5f, 0xee, 0xb7, 0xee, 0x91, 0x69, 0xb1, 0x64, 0xde, 0x65, 0xea,
+    0xe0, 0x58, 0xcf, 0xde, 0xb6, 0xc3, 0xc4, 0xb1, 0xef, 0x44, 0x5a, 0x78, 0x5f, 0x08, 0xa5, 0xc6,
+    0x69, 0x29, 0x36, 0xcc, 0x83, 0x62, 0xc2, 0x07, 0x51, 0x0c, 0xc3, 0x31, 0x7a, 0x2d, 0x2d, 0x7d,
+    0x20, 0x94, 0x4e, 0x6e, 0xcc, 0xa4, 0x0b, 0x6f, 0x4f, 0x12, 0xb1, 0xa1, 0x1d, 0xfe, 0xff, 0x34,
+    0xa1, 0xf7, 0x37, 0xf6, 0x93, 0xff, 0xdf, 0x3b, 0x1e, 0xe8, 0x74, 0x6a, 0x5d, 0xfb, 0x5d, 0xc4,
+    0x87, 0x59, 0x59, 0x59, 0xb6, 0x12, 0x99, 0x07, 0xea, 0xfb, 0x1e, 0xd4, 0x4d, 0xe0, 0x77, 0x68,
+    0xc3, 0x6d, 0x67, 0x09, 0x59, 0xf5, 0x77, 0xc7, 0xf9, 0xc5, 0x91, 0xdf, 0x2c, 0x1a, 0x45, 0x57,
+    0x76, 0x18, 0xad, 0xf0, 0xfd, 0xb1, 0xa6, 0x1d, 0xbb, 0x4a, 0xa9, 0x85, 0x7d, 0xa3, 0x2f, 0x36,
+    0xe6, 0xd3, 0xa7, 0x75, 0x39, 0x02, 0xc2, 0x57, 0xba, 0xc2, 0xf5, 0xc7, 0x5f, 0x2b, 0x92, 0xfc,
+    0x05, 0x8e, 0xff, 0x7e, 0x24, 0xc5, 0x7f, 0x47, 0xfa, 0x29, 0xfe, 0xbb, 0xd9, 0xdf, 0x8f, 0x68,
+    0x54, 0xf7, 0xa8, 0x0f, 0xb8, 0xb9, 0xb9, 0xd9, 0x33, 0xd2, 0xd3, 0x71, 0x36, 0x6f, 0x53, 0x9d,
+    0xd5, 0xd9, 0x32, 0x32, 0x32, 0x6c, 0xfc, 0x0e, 0xf8, 0x3e, 0x20, 0xc5, 0xda, 0x6e, 0x0a, 0xdf,
+    0xa2, 0x7f, 0xbd, 0x28, 0xb9, 0xf2, 0xd8, 0x5f, 0xf3, 0x2f, 0xc1, 0x96, 0x77, 0xec, 0x32, 0x5a,
+    0x98, 0x07, 0x76, 0xc4, 0x39, 0x0d, 0x22, 0xc6, 0x29, 0x12, 0x50, 0x8e, 0x7b, 0xec, 0xf0, 0xf7,
+    0xcf, 0xbd, 0x55, 0x6c, 0x99, 0x5d, 0x21, 0xc5, 0xff, 0xde, 0x4a, 0xfc, 0x7f, 0x07, 0x7f, 0xbb,
+    0xc5, 0xb2, 0xaf, 0xe6, 0xc1, 0x34, 0xe6, 0x89, 0x75, 0xfc, 0xb8, 0x71, 0xd8, 0xfb, 0x66, 0x64,
+    0x94, 0x51, 0xc7, 0xef, 0xa6, 0xab, 0xee, 0x6c, 0x21, 0xaf, 0x5a, 0x5e, 0x33, 0x51, 0x8e, 0x09,
+    0xf3, 0x9c, 0x9b, 0x14, 0xe3, 0x43, 0xcf, 0xcd, 0x1f, 0x61, 0x85, 0x3f, 0xdf, 0xca, 0x7a, 0x8d,
+    0xf7, 0x85, 0x05, 0xbe, 0x0d, 0x20, 0x9e, 0xb1, 0x37, 0x9e, 0x9f, 0x3f, 0xc2, 0x9e, 0xc8, 0xed,
+    0xb8, 0xcb, 0x26, 0x96, 0x9f, 0xb0, 0x5b, 0x69, 0xef, 0x7a, 0xc5, 0x03, 0x77, 0x77, 0x35, 0x0f,
+    0x26, 0xab, 0xef, 0x18, 0xe5, 0xbb, 0xb9, 0xc9, 0x0a, 0xed, 0xbc, 0x07, 0x34, 0xda, 0xab, 0x92,
+    0xaa, 0xab, 0xbc, 0x4f, 0x2f, 0x9f, 0xc7, 0x6a, 0xca, 0x18, 0x6c, 0x0b, 0xf1, 0x77, 0x6f, 0x2f,
+    0x1a, 0x1f, 0x44, 0xf0, 0x69, 0xe0, 0xd7, 0x7d, 0x9b, 0x21, 0x9e, 0x43, 0x02, 0xdc, 0x71, 0xc6,
+    0xbf, 0x8d, 0xf9, 0x56, 0xae, 0xf4, 0xed, 0xe3, 0xb9, 0xcf, 0x2d, 0x51, 0x0b, 0x0e, 0x77, 0xcc,
+    0xea, 0xbb, 0xd9, 0x6b, 0xd6, 0x89, 0xe5, 0x59, 0xd3, 0xf4, 0x5a, 0x9a, 0xa6, 0x71, 0x63, 0x9a,
+    0xe6, 0xfd, 0x97, 0x8a, 0xd5, 0x22, 0x8c, 0x7b, 0xdd, 0xa9, 0x9c, 0x1f, 0x97, 0x7d, 0xda, 0xef,
+    0xcb, 0xcf, 0xb1, 0xf2, 0x3e, 0x57, 0x6c, 0xfc, 0x40, 0xfd, 0xbd, 0xa2, 0xe3, 0x6f, 0x14, 0x7b,
+    0xbc, 0x9b, 0x97, 0xe5, 0x01, 0x66, 0xa5, 0xb3, 0x1d, 0xef, 0x07, 0x01, 0x47, 0xc6, 0xf9, 0x5e,
+    0xd5, 0x37, 0xd2, 0x7b, 0x17, 0xad, 0x66, 0xc0, 0x27, 0xe5, 0x1b, 0x13, 0xd7, 0x9b, 0x58, 0x27,
+    0x75, 0x5f, 0xd7, 0x3e, 0x8c, 0xf3, 0x55, 0xfa, 0x3f, 0x4f, 0xe4, 0x98, 0xfe, 0x28, 0x54, 0x30,
+    0x51, 0x39, 0x1e, 0x3e, 0x26, 0xbb, 0xf4, 0xbc, 0xcc, 0x2e, 0xbe, 0x9c, 0xd0, 0x5d, 0x85, 0xcb,
+    0xc5, 0xae, 0x1c, 0xb0, 0x70, 0xaf, 0x04, 0x83, 0x3e, 0x96, 0x60, 0xf9, 0x1a, 0x89, 0xdc, 0x90,
+    0x8f, 0x24, 0xe8, 0xf3, 0xac, 0x04, 0xbd, 0xfe, 0x28, 0xdb, 0x1c, 0xe5, 0x59, 0x79, 0xaf, 0xb4,
+    0xdf, 0x2f, 0xc1, 0xe4, 0x7f, 0x48, 0xf0, 0x9e, 0x13, 0x12, 0x7c, 0xc5, 0x2c, 0xc6, 0xd5, 0x6c,
+    0xb0, 0x49, 0x5f, 0x94, 0xdc, 0x2b, 0xf1, 0x49, 0x93, 0x44, 0x52, 0x84, 0x99, 0x40, 0xd2, 0x00,
+    0x41, 0xb4, 0x5f, 0x86, 0x4d, 0xd2, 0xb8, 0xd4, 0x22, 0x43, 0xb3, 0x0c, 0x6d, 0x32, 0xb4, 0x3f,
+    0x2b, 0x41, 0x2a, 0x91, 0xe1, 0x9f, 0x65, 0xf8, 0xb1, 0xd4, 0x9f, 0x1a, 0x65, 0xd8, 0xb2, 0x5c,
+    0x8c, 0x4f, 0xe6, 0x02, 0x1d, 0xe6, 0x23, 0x9b, 0x9e, 0x8d, 0xea, 0xbd, 0x1c, 0xf8, 0x3c, 0xeb,
+    0x5d, 0xa0, 0xd9, 0xc0, 0x8b, 0x56, 0x12, 0xa0, 0xd7, 0x3d, 0x88, 0xcf, 0xd0, 0x46, 0xad, 0xf4,
+    0xdd, 0xce, 0xf0, 0xbd, 0x5a, 0xc3, 0xbf, 0x96, 0x31, 0x6c, 0x48, 0xfa, 0xc8, 0xad, 0xcb, 0x72,
+    0xff, 0x17, 0x44, 0xe9, 0xd1, 0x47, 0x3e, 0x42, 0x00, 0x00,
+};
+
+static const WebAsset WEB_ASSETS[] = {
+    {"/index.html", "text/html", "\"7e4af18c663117b1\"", WEB_ASSET_0, sizeof(WEB_ASSET_0)},
+    {"/favicon.ico", "image/x-icon", "\"e4cd3e8f12f99cc4\"", WEB_ASSET_1, sizeof(WEB_ASSET_1)},
+};
+static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
+
+#endif
@@ -7,6 +7,8 @@
 #include <ArduinoJson.h>
 #include <WebServer.h>
 #include "GlobalVars.h"
+#include "EventStream.h"
+#include "FileCache.h"
 
 using WebServer = ::WebServer;
 
@@ -20,49 +22,51 @@ private:
         float temperature = 0;
         float humidity = 0;
         float light = 0;
-        bool socket_states[3] = {false, false, false};
-        unsigned long socket_durations[3] = {0, 0, 0};
-    };
-
-    struct FileCache
-    {
-        String path;
-        uint8_t *data = nullptr;
-        size_t size = 0;
+        uint8_t socket_count = 0;
+        uint32_t socket_states = 0; // Bit per socket
+        unsigned long socket_durations[SocketRegistry::MAX_SOCKETS] = {};
+        HomeP1Device::Extras p1_extras;
     };
 
     WebServer server;
-    unsigned long lastCheck = 0;
+    MonoTime lastCheck = 0;
     static const size_t BUFFER_SIZE = 1024;
     static const int CHUNK_DELAY = 5;
-    static const unsigned long CHECK_INTERVAL = 30000;
+    static const MonoTime CHECK_INTERVAL = 30 * MONO_SECOND;
     static const unsigned long ERROR_COOLDOWN = 5000;
-    static const int MAX_CACHED_FILES = 2;
+    static const size_t MAX_HISTORY_POINTS = 240; // Per /history request
+    static const size_t DATA_DOC_SIZE = 1024 + SocketRegistry::MAX_SOCKETS * (JSON_OBJECT_SIZE(6) + 16);
 
     uint8_t *buffer;
     CachedData cached;
-    FileCache cachedFiles[MAX_CACHED_FILES];
+    CachedData pushed; // What the event stream clients have
+    EventStream events;
 
     void updateCache();
+    void fillData(JsonDocument &doc);
+    void pushChanges();
+    void handleEvents();
     String getContentType(const String &path);
-    bool serveFromCache(const String &path);
-    void cacheFile(const String &path, File &file);
+    bool serveAsset(const String &path);
+    void serveCached(const String &path, const FileCache::Entry &entry);
     bool serveFile(const String &path);
     void handleSwitch(int switchNumber);
+    void handleHistory();
+    void handleHistorySummary();
+    void handleLogStatus();
+    void handleGetRules();
+    void handlePostRules();
+    void handleTimers();
+    void handleTrace();
+    void handleConnections();
+    void handlePolling();
+    void handleCommands();
+    void handleMetrics();
+    void on(const String &uri, HTTPMethod method, WebServer::THandlerFunction handler, const char *label = nullptr);
 
 public:
     WebInterface() : server(8080), buffer(new uint8_t[BUFFER_SIZE]) {}
     void begin();
     void update();
-    ~WebInterface()
-    {
-        delete[] buffer;
-        for (int i = 0; i < MAX_CACHED_FILES; i++)
-        {
-            if (cachedFiles[i].data != nullptr)
-            {
-                delete[] cachedFiles[i].data;
-            }
-        }
-    }
+    ~WebInterface() { delete[] buffer; }
 };
\ No newline at end of file
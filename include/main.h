@@ -13,12 +13,10 @@
 #include "TimeSync.h"
 #include "WebInterface.h"
 #include "NetworkCheck.h"
+#include "RulesEngine.h"
+#include "PollController.h"
 
 extern HomeP1Device *p1Meter;
-extern HomeSocketDevice *socket1;
-extern HomeSocketDevice *socket2;
-extern HomeSocketDevice *socket3;
-extern unsigned long lastStateChangeTime[3];
 extern NetworkCheck *phoneCheck;
 // Timing control structure
 
@@ -27,29 +25,22 @@ unsigned long lastPhoneCheck;
 
 bool loadConfiguration();
 void connectWiFi();
-bool canChangeState(int switchIndex, bool newState);
 void checkMaxOnTime();
-void updateSwitch1Logic();
-void updateSwitch2Logic();
-void updateSwitch3Logic();
+void updateSocketLogic(int index);
 void updateDisplay();
 void setup();
 void reconnectWiFi();
+void setupTasks();
 void loop();
 
 // External variable declarations
-extern TimingControl timing;
+extern TaskScheduler scheduler;
 extern Config config;
 extern DisplayManager display;
 extern EnvironmentSensors sensors;
 extern HomeP1Device *p1Meter;
-extern HomeSocketDevice *socket1;
-extern HomeSocketDevice *socket2;
-extern HomeSocketDevice *socket3;
 extern TimeSync timeSync;
 extern WebInterface webServer;
-extern unsigned long lastStateChangeTime[3];
-extern bool switchForceOff[3];
-extern unsigned long lastTimeDisplay;
+extern MonoTime lastTimeDisplay;
 extern HomeP1Device *p1Meter;
 extern EnvironmentSensors sensors;
\ No newline at end of file
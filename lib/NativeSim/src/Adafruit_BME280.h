@@ -0,0 +1,16 @@
+// Adafruit_BME280.h
+#ifndef NATIVE_SIM_ADAFRUIT_BME280_H
+#define NATIVE_SIM_ADAFRUIT_BME280_H
+
+#include "SimEnvironment.h"
+
+class Adafruit_BME280
+{
+public:
+    bool begin(uint8_t address = 0x77) { return address == 0x76; }
+    float readTemperature() { return simEnvironment.temperature.at(simSeconds()); }
+    float readHumidity() { return simEnvironment.humidity.at(simSeconds()); }
+    float readPressure() { return simEnvironment.pressure.at(simSeconds()) * 100.0; } // Pa
+};
+
+#endif
@@ -0,0 +1,31 @@
+// Adafruit_GFX.h
+#ifndef NATIVE_SIM_ADAFRUIT_GFX_H
+#define NATIVE_SIM_ADAFRUIT_GFX_H
+
+#include "Arduino.h"
+
+// Text-only canvas: keeps the cursor API, drops the pixels
+class Adafruit_GFX : public Print
+{
+protected:
+    int16_t width;
+    int16_t height;
+
+public:
+    Adafruit_GFX(int16_t w, int16_t h) : width(w), height(h) {}
+    void setTextSize(uint8_t size) { (void)size; }
+    void setTextColor(uint16_t color) { (void)color; }
+    void setCursor(int16_t x, int16_t y)
+    {
+        (void)x;
+        (void)y;
+    }
+    using Print::write;
+    size_t write(uint8_t c) override
+    {
+        (void)c;
+        return 1;
+    }
+};
+
+#endif
@@ -0,0 +1,30 @@
+// Adafruit_SSD1306.h
+#ifndef NATIVE_SIM_ADAFRUIT_SSD1306_H
+#define NATIVE_SIM_ADAFRUIT_SSD1306_H
+
+#include "Adafruit_GFX.h"
+#include "Wire.h"
+
+#define SSD1306_SWITCHCAPVCC 0x02
+#define SSD1306_BLACK 0
+#define SSD1306_WHITE 1
+
+class Adafruit_SSD1306 : public Adafruit_GFX
+{
+public:
+    Adafruit_SSD1306(uint8_t w, uint8_t h, TwoWire *wire, int8_t resetPin) : Adafruit_GFX(w, h)
+    {
+        (void)wire;
+        (void)resetPin;
+    }
+    bool begin(uint8_t vccState, uint8_t address)
+    {
+        (void)vccState;
+        (void)address;
+        return true;
+    }
+    void clearDisplay() {}
+    void display() {}
+};
+
+#endif
@@ -0,0 +1,7 @@
+// Adafruit_Sensor.h
+#ifndef NATIVE_SIM_ADAFRUIT_SENSOR_H
+#define NATIVE_SIM_ADAFRUIT_SENSOR_H
+
+#include "Arduino.h"
+
+#endif
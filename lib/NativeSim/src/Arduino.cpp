@@ -0,0 +1,358 @@
+// Arduino.cpp
+#include "Arduino.h"
+#include "esp_timer.h"
+#include "SimHeap.h"
+
+#include <chrono>
+#include <ctype.h>
+#include <malloc.h>
+#include <stdarg.h>
+#include <thread>
+
+HardwareSerial Serial;
+EspClass ESP;
+
+static const std::chrono::steady_clock::time_point bootTime = std::chrono::steady_clock::now();
+static uint64_t clockStartMicros = 0;
+
+uint64_t simElapsedMicros()
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - bootTime)
+        .count();
+}
+
+void simSetClockStart(uint64_t ms)
+{
+    clockStartMicros = ms * 1000 - simElapsedMicros();
+}
+
+// 32 bits wide, as on the ESP32, so they wrap like the real ones
+unsigned long millis()
+{
+    return (uint32_t)((clockStartMicros + simElapsedMicros()) / 1000);
+}
+
+unsigned long micros()
+{
+    return (uint32_t)(clockStartMicros + simElapsedMicros());
+}
+
+int64_t esp_timer_get_time()
+{
+    return clockStartMicros + simElapsedMicros();
+}
+
+void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+void yield()
+{
+    std::this_thread::yield();
+}
+
+// String
+
+static std::string formatInteger(unsigned long long v, bool negative, unsigned char base)
+{
+    char buffer[72];
+    int pos = sizeof(buffer) - 1;
+    buffer[pos] = '\0';
+    do
+    {
+        int digit = v % base;
+        buffer[--pos] = digit < 10 ? '0' + digit : 'a' + digit - 10;
+        v /= base;
+    } while (v && pos > 1);
+    if (negative)
+        buffer[--pos] = '-';
+    return std::string(buffer + pos);
+}
+
+String::String(int v, unsigned char base) : String((long)v, base) {}
+String::String(unsigned int v, unsigned char base) : String((unsigned long)v, base) {}
+
+String::String(long v, unsigned char base)
+{
+    bool negative = v < 0 && base == DEC;
+    unsigned long long magnitude = negative ? -(long long)v : (unsigned long long)(unsigned long)v;
+    value = formatInteger(magnitude, negative, base);
+}
+
+String::String(unsigned long v, unsigned char base)
+{
+    value = formatInteger(v, false, base);
+}
+
+String::String(float v, unsigned int decimals) : String((double)v, decimals) {}
+
+String::String(double v, unsigned int decimals)
+{
+    char buffer[64];
+    snprintf(buffer, sizeof(buffer), "%.*f", (int)decimals, v);
+    value = buffer;
+}
+
+bool String::equalsIgnoreCase(const String &s) const
+{
+    return value.size() == s.value.size() && strcasecmp(value.c_str(), s.value.c_str()) == 0;
+}
+
+bool String::startsWith(const String &prefix) const
+{
+    return value.compare(0, prefix.value.size(), prefix.value) == 0;
+}
+
+bool String::endsWith(const String &suffix) const
+{
+    return value.size() >= suffix.value.size() &&
+           value.compare(value.size() - suffix.value.size(), suffix.value.size(), suffix.value) == 0;
+}
+
+int String::indexOf(char c, unsigned int from) const
+{
+    size_t pos = value.find(c, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::indexOf(const String &s, unsigned int from) const
+{
+    size_t pos = value.find(s.value, from);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+int String::lastIndexOf(char c) const
+{
+    size_t pos = value.rfind(c);
+    return pos == std::string::npos ? -1 : (int)pos;
+}
+
+String String::substring(unsigned int from) const
+{
+    return from >= value.size() ? String() : String(value.substr(from));
+}
+
+String String::substring(unsigned int from, unsigned int to) const
+{
+    if (from > to)
+        std::swap(from, to);
+    if (from >= value.size())
+        return String();
+    return String(value.substr(from, to - from));
+}
+
+void String::replace(const String &find, const String &with)
+{
+    if (find.value.empty())
+        return;
+    size_t pos = 0;
+    while ((pos = value.find(find.value, pos)) != std::string::npos)
+    {
+        value.replace(pos, find.value.size(), with.value);
+        pos += with.value.size();
+    }
+}
+
+void String::remove(unsigned int index, unsigned int count)
+{
+    if (index < value.size())
+        value.erase(index, count);
+}
+
+void String::trim()
+{
+    size_t start = value.find_first_not_of(" \t\r\n");
+    size_t end = value.find_last_not_of(" \t\r\n");
+    value = start == std::string::npos ? std::string() : value.substr(start, end - start + 1);
+}
+
+void String::toLowerCase()
+{
+    for (char &c : value)
+        c = tolower((unsigned char)c);
+}
+
+void String::toUpperCase()
+{
+    for (char &c : value)
+        c = toupper((unsigned char)c);
+}
+
+// Print / Stream
+
+size_t Print::write(const uint8_t *buffer, size_t size)
+{
+    size_t n = 0;
+    while (size--)
+        n += write(*buffer++);
+    return n;
+}
+
+size_t Print::printf(const char *format, ...)
+{
+    char small[256];
+    va_list args;
+    va_start(args, format);
+    int length = vsnprintf(small, sizeof(small), format, args);
+    va_end(args);
+    if (length < 0)
+        return 0;
+    if ((size_t)length < sizeof(small))
+        return write((const uint8_t *)small, length);
+
+    std::string large(length + 1, '\0');
+    va_start(args, format);
+    vsnprintf(&large[0], large.size(), format, args);
+    va_end(args);
+    return write((const uint8_t *)large.data(), length);
+}
+
+size_t Print::print(long v, int base)
+{
+    return print(String(v, (unsigned char)base));
+}
+
+size_t Print::print(unsigned long v, int base)
+{
+    return print(String(v, (unsigned char)base));
+}
+
+size_t Print::print(double v, int digits)
+{
+    return print(String(v, (unsigned int)digits));
+}
+
+size_t Stream::readBytes(char *buffer, size_t length)
+{
+    size_t count = 0;
+    uint32_t start = millis();
+    while (count < length && (uint32_t)(millis() - start) < timeout)
+    {
+        int c = read();
+        if (c < 0)
+        {
+            if (available() <= 0)
+                break;
+            continue;
+        }
+        buffer[count++] = (char)c;
+    }
+    return count;
+}
+
+String Stream::readString()
+{
+    String result;
+    int c;
+    while ((c = read()) >= 0)
+        result += (char)c;
+    return result;
+}
+
+String Stream::readStringUntil(char terminator)
+{
+    String result;
+    int c;
+    while ((c = read()) >= 0 && c != terminator)
+        result += (char)c;
+    return result;
+}
+
+size_t HardwareSerial::write(uint8_t c)
+{
+    return fwrite(&c, 1, 1, stdout);
+}
+
+size_t HardwareSerial::write(const uint8_t *buffer, size_t size)
+{
+    return fwrite(buffer, 1, size, stdout);
+}
+
+// Time zone handling mirrors the Arduino-ESP32 core: configTime() turns the
+// offsets into a POSIX TZ string, configTzTime() takes one directly.
+void configTime(long gmtOffset_sec, int daylightOffset_sec,
+                const char *server1, const char *server2, const char *server3)
+{
+    (void)server1;
+    (void)server2;
+    (void)server3;
+
+    long offset = -gmtOffset_sec;
+    char tz[48];
+    if (daylightOffset_sec == 0)
+    {
+        snprintf(tz, sizeof(tz), "UTC%ld", offset / 3600);
+    }
+    else if (daylightOffset_sec == 3600)
+    {
+        snprintf(tz, sizeof(tz), "UTC%ldDST", offset / 3600);
+    }
+    else
+    {
+        snprintf(tz, sizeof(tz), "UTC%ldDST%ld", offset / 3600, (offset - daylightOffset_sec) / 3600);
+    }
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+void configTzTime(const char *tz, const char *server1, const char *server2, const char *server3)
+{
+    (void)server1;
+    (void)server2;
+    (void)server3;
+    setenv("TZ", tz, 1);
+    tzset();
+}
+
+// The host clock is always synchronised, so this never waits
+bool getLocalTime(struct tm *info, uint32_t ms)
+{
+    (void)ms;
+    time_t now = time(nullptr);
+    localtime_r(&now, info);
+    return info->tm_year > (2016 - 1900);
+}
+
+static uint32_t minFreeHeap = EspClass::SIM_HEAP_SIZE;
+
+// Only sampled when asked, so the minimum is the lowest seen by a caller
+uint32_t EspClass::getFreeHeap()
+{
+    size_t used = mallinfo2().uordblks;
+    uint32_t free = used < SIM_HEAP_SIZE ? SIM_HEAP_SIZE - used : 0;
+    if (free < minFreeHeap)
+        minFreeHeap = free;
+    return free;
+}
+
+uint32_t EspClass::getMinFreeHeap()
+{
+    getFreeHeap();
+    return minFreeHeap;
+}
+
+// FreeRTOS
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth,
+                                   void *parameter, UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t core)
+{
+    (void)stackDepth;
+    (void)priority;
+    (void)core;
+    std::thread([task, name, parameter]()
+                {
+                    simHeapTrackThread(name);
+                    task(parameter);
+                })
+        .detach();
+    if (handle)
+        *handle = nullptr;
+    return pdPASS;
+}
+
+void vTaskDelay(TickType_t ticks)
+{
+    delay(ticks * portTICK_PERIOD_MS);
+}
@@ -0,0 +1,279 @@
+// Arduino.h
+// Host (Linux) stand-in for the parts of the Arduino-ESP32 core this firmware
+// uses. Only compiled by the [env:native] simulation build.
+#ifndef NATIVE_SIM_ARDUINO_H
+#define NATIVE_SIM_ARDUINO_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <string>
+#include <type_traits>
+
+// By value like the core's macros, so static const members need no definition
+template <typename A, typename B>
+inline auto min(A a, B b) -> typename std::decay<decltype(a < b ? a : b)>::type { return b < a ? b : a; }
+template <typename A, typename B>
+inline auto max(A a, B b) -> typename std::decay<decltype(a < b ? a : b)>::type { return a < b ? b : a; }
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+#define DEC 10
+#define HEX 16
+
+// Timing
+unsigned long millis();
+unsigned long micros();
+void delay(unsigned long ms);
+void yield();
+
+// Simulation only: move the clocks (millis(), micros(), esp_timer) to start
+// at the given ms, e.g. just before the 49.7 day millis() wrap. Elapsed
+// time since the process started is unaffected.
+void simSetClockStart(uint64_t ms);
+uint64_t simElapsedMicros();
+
+// Arduino String, backed by std::string
+class String
+{
+private:
+    std::string value;
+
+public:
+    String() {}
+    String(const char *s) : value(s ? s : "") {}
+    String(const std::string &s) : value(s) {}
+    explicit String(char c) : value(1, c) {}
+    explicit String(int v, unsigned char base = DEC);
+    explicit String(unsigned int v, unsigned char base = DEC);
+    explicit String(long v, unsigned char base = DEC);
+    explicit String(unsigned long v, unsigned char base = DEC);
+    explicit String(float v, unsigned int decimals = 2);
+    explicit String(double v, unsigned int decimals = 2);
+
+    const char *c_str() const { return value.c_str(); }
+    size_t length() const { return value.size(); }
+    bool isEmpty() const { return value.empty(); }
+    bool reserve(unsigned int size)
+    {
+        value.reserve(size);
+        return true;
+    }
+
+    bool concat(const String &s)
+    {
+        value += s.value;
+        return true;
+    }
+    bool concat(const char *s)
+    {
+        value += s ? s : "";
+        return true;
+    }
+    bool concat(const char *s, unsigned int n)
+    {
+        value.append(s, n);
+        return true;
+    }
+    bool concat(char c)
+    {
+        value += c;
+        return true;
+    }
+
+    String &operator+=(const String &s)
+    {
+        concat(s);
+        return *this;
+    }
+    String &operator+=(const char *s)
+    {
+        concat(s);
+        return *this;
+    }
+    String &operator+=(char c)
+    {
+        concat(c);
+        return *this;
+    }
+
+    bool operator==(const String &s) const { return value == s.value; }
+    bool operator==(const char *s) const { return value == (s ? s : ""); }
+    bool operator!=(const String &s) const { return value != s.value; }
+    bool operator!=(const char *s) const { return !(*this == s); }
+    bool operator<(const String &s) const { return value < s.value; }
+    char operator[](unsigned int i) const { return i < value.size() ? value[i] : 0; }
+    char charAt(unsigned int i) const { return (*this)[i]; }
+
+    bool equals(const String &s) const { return value == s.value; }
+    bool equalsIgnoreCase(const String &s) const;
+    bool startsWith(const String &prefix) const;
+    bool endsWith(const String &suffix) const;
+    int indexOf(char c, unsigned int from = 0) const;
+    int indexOf(const String &s, unsigned int from = 0) const;
+    int lastIndexOf(char c) const;
+    String substring(unsigned int from) const;
+    String substring(unsigned int from, unsigned int to) const;
+    void replace(const String &find, const String &with);
+    void remove(unsigned int index, unsigned int count = (unsigned int)-1);
+    void trim();
+    void toLowerCase();
+    void toUpperCase();
+    long toInt() const { return atol(value.c_str()); }
+    float toFloat() const { return (float)atof(value.c_str()); }
+
+    friend String operator+(const String &a, const String &b) { return String(a.value + b.value); }
+    friend String operator+(const String &a, const char *b) { return String(a.value + (b ? b : "")); }
+    friend String operator+(const char *a, const String &b) { return String((a ? a : "") + b.value); }
+    friend String operator+(const String &a, char b) { return String(a.value + b); }
+    friend String operator+(const String &a, int b) { return a + String(b); }
+    friend String operator+(const String &a, unsigned int b) { return a + String(b); }
+    friend String operator+(const String &a, long b) { return a + String(b); }
+    friend String operator+(const String &a, unsigned long b) { return a + String(b); }
+    friend String operator+(const String &a, float b) { return a + String(b); }
+    friend String operator+(const String &a, double b) { return a + String(b); }
+};
+
+class Print;
+
+class Printable
+{
+public:
+    virtual ~Printable() {}
+    virtual size_t printTo(Print &p) const = 0;
+};
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t *buffer, size_t size);
+    size_t write(const char *s) { return s ? write((const uint8_t *)s, strlen(s)) : 0; }
+    size_t write(const char *buffer, size_t size) { return write((const uint8_t *)buffer, size); }
+    virtual void flush() {}
+
+    size_t printf(const char *format, ...) __attribute__((format(printf, 2, 3)));
+    size_t print(const char *s) { return write(s); }
+    size_t print(const String &s) { return write(s.c_str(), s.length()); }
+    size_t print(char c) { return write((uint8_t)c); }
+    size_t print(int v, int base = DEC) { return print((long)v, base); }
+    size_t print(unsigned int v, int base = DEC) { return print((unsigned long)v, base); }
+    size_t print(long v, int base = DEC);
+    size_t print(unsigned long v, int base = DEC);
+    size_t print(double v, int digits = 2);
+    size_t print(const Printable &p) { return p.printTo(*this); }
+
+    size_t println() { return write("\r\n"); }
+    template <typename T>
+    size_t println(const T &v)
+    {
+        size_t n = print(v);
+        return n + println();
+    }
+    template <typename T>
+    size_t println(const T &v, int format)
+    {
+        size_t n = print(v, format);
+        return n + println();
+    }
+};
+
+class Stream : public Print
+{
+protected:
+    unsigned long timeout = 1000;
+
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+    void setTimeout(unsigned long ms) { timeout = ms; }
+    virtual size_t readBytes(char *buffer, size_t length);
+    size_t readBytes(uint8_t *buffer, size_t length) { return readBytes((char *)buffer, length); }
+    String readString();
+    String readStringUntil(char terminator);
+};
+
+class HardwareSerial : public Stream
+{
+public:
+    void begin(unsigned long baud) { (void)baud; }
+    using Print::write;
+    size_t write(uint8_t c) override;
+    size_t write(const uint8_t *buffer, size_t size) override;
+    int available() override { return 0; }
+    int read() override { return -1; }
+    int peek() override { return -1; }
+    int availableForWrite() { return 4096; } // stdout never fills up like the UART FIFO
+    operator bool() const { return true; }
+};
+
+extern HardwareSerial Serial;
+
+// ESP-IDF reset reason, a simulated start is always a power-on
+typedef enum
+{
+    ESP_RST_UNKNOWN,
+    ESP_RST_POWERON,
+    ESP_RST_EXT,
+    ESP_RST_SW,
+    ESP_RST_PANIC,
+    ESP_RST_INT_WDT,
+    ESP_RST_TASK_WDT,
+    ESP_RST_WDT,
+    ESP_RST_DEEPSLEEP,
+    ESP_RST_BROWNOUT,
+    ESP_RST_SDIO
+} esp_reset_reason_t;
+inline esp_reset_reason_t esp_reset_reason() { return ESP_RST_POWERON; }
+
+// Heap figures as if the program ran in the ESP32's SIM_HEAP_SIZE bytes
+class EspClass
+{
+public:
+    static const uint32_t SIM_HEAP_SIZE = 300 * 1024;
+
+    uint32_t getHeapSize() { return SIM_HEAP_SIZE; }
+    uint32_t getFreeHeap();
+    uint32_t getMinFreeHeap();
+    uint32_t getMaxAllocHeap() { return getFreeHeap(); } // No fragmentation on the host
+};
+
+extern EspClass ESP;
+
+// Sketch entry points, called by SimMain.cpp
+void setup();
+void loop();
+
+// Time, as set up by configTime()/configTzTime() on the ESP32
+bool getLocalTime(struct tm *info, uint32_t ms = 5000);
+void configTime(long gmtOffset_sec, int daylightOffset_sec,
+                const char *server1, const char *server2 = nullptr, const char *server3 = nullptr);
+void configTzTime(const char *tz,
+                  const char *server1, const char *server2 = nullptr, const char *server3 = nullptr);
+
+// The FreeRTOS calls used by the firmware, mapped onto std::thread
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef void *TaskHandle_t;
+typedef void (*TaskFunction_t)(void *);
+#define pdPASS 1
+#define pdFAIL 0
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t task, const char *name, uint32_t stackDepth,
+                                   void *parameter, UBaseType_t priority, TaskHandle_t *handle,
+                                   BaseType_t core);
+void vTaskDelay(TickType_t ticks);
+
+#endif
@@ -0,0 +1,27 @@
+// BH1750.h
+#ifndef NATIVE_SIM_BH1750_H
+#define NATIVE_SIM_BH1750_H
+
+#include "SimEnvironment.h"
+
+class BH1750
+{
+public:
+    enum Mode
+    {
+        UNCONFIGURED = 0,
+        CONTINUOUS_HIGH_RES_MODE = 0x10,
+        CONTINUOUS_HIGH_RES_MODE_2 = 0x11,
+        CONTINUOUS_LOW_RES_MODE = 0x13,
+        ONE_TIME_HIGH_RES_MODE = 0x20
+    };
+
+    bool begin(Mode mode = CONTINUOUS_HIGH_RES_MODE)
+    {
+        (void)mode;
+        return true;
+    }
+    float readLightLevel() { return simEnvironment.lux.at(simSeconds()); }
+};
+
+#endif
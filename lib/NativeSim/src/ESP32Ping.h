@@ -0,0 +1,28 @@
+// ESP32Ping.h
+#ifndef NATIVE_SIM_ESP32_PING_H
+#define NATIVE_SIM_ESP32_PING_H
+
+#include "SimEnvironment.h"
+#include "Arduino.h"
+
+class PingClass
+{
+private:
+    float lastTime = 0;
+
+public:
+    // Blocks for the round trip, like the real library
+    bool ping(const char *host, byte count = 5)
+    {
+        (void)host;
+        bool present = simEnvironment.phonePresent.at(simSeconds()) > 0.5;
+        delay(present ? (unsigned long)(simEnvironment.pingMs * count) : 1000UL * count);
+        lastTime = present ? simEnvironment.pingMs : 0;
+        return present;
+    }
+    float averageTime() const { return lastTime; }
+};
+
+extern PingClass Ping;
+
+#endif
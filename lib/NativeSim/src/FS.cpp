@@ -0,0 +1,205 @@
+// FS.cpp
+#include "FS.h"
+
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+FS SPIFFS;
+
+struct File::Handle
+{
+    FILE *file;
+    String path;
+
+    ~Handle()
+    {
+        if (file)
+            fclose(file);
+    }
+};
+
+File::File(FILE *file, const String &path) : handle(new Handle{file, path}) {}
+
+File::operator bool() const
+{
+    return handle && handle->file;
+}
+
+size_t File::size() const
+{
+    if (!*this)
+        return 0;
+    struct stat info;
+    fflush(handle->file);
+    return fstat(fileno(handle->file), &info) == 0 ? info.st_size : 0;
+}
+
+size_t File::position() const
+{
+    return *this ? ftell(handle->file) : 0;
+}
+
+bool File::seek(uint32_t pos, SeekMode mode)
+{
+    int whence = mode == SeekCur ? SEEK_CUR : (mode == SeekEnd ? SEEK_END : SEEK_SET);
+    return *this && fseek(handle->file, pos, whence) == 0;
+}
+
+const char *File::name() const
+{
+    return handle ? handle->path.c_str() : "";
+}
+
+void File::close()
+{
+    if (*this)
+    {
+        fclose(handle->file);
+        handle->file = nullptr;
+    }
+}
+
+size_t File::write(const uint8_t *buffer, size_t size)
+{
+    return *this ? fwrite(buffer, 1, size, handle->file) : 0;
+}
+
+void File::flush()
+{
+    if (*this)
+        fflush(handle->file);
+}
+
+size_t File::read(uint8_t *buffer, size_t size)
+{
+    return *this ? fread(buffer, 1, size, handle->file) : 0;
+}
+
+int File::read()
+{
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int File::peek()
+{
+    if (!*this)
+        return -1;
+    int c = fgetc(handle->file);
+    if (c != EOF)
+        ungetc(c, handle->file);
+    return c == EOF ? -1 : c;
+}
+
+int File::available()
+{
+    return *this ? (int)(size() - position()) : 0;
+}
+
+static void makeParentDirectories(const std::string &path)
+{
+    for (size_t pos = path.find('/', 1); pos != std::string::npos; pos = path.find('/', pos + 1))
+    {
+        ::mkdir(path.substr(0, pos).c_str(), 0755);
+    }
+}
+
+std::string FS::resolve(const String &path, bool forWrite) const
+{
+    const char *relative = path.c_str();
+    while (*relative == '/')
+        relative++;
+
+    if (!forWrite)
+    {
+        for (const std::string &root : roots)
+        {
+            std::string candidate = root + "/" + relative;
+            if (access(candidate.c_str(), F_OK) == 0)
+                return candidate;
+        }
+    }
+    return (roots.empty() ? std::string(".") : roots.front()) + "/" + relative;
+}
+
+bool FS::begin(bool formatOnFail, const char *basePath, uint8_t maxOpenFiles)
+{
+    (void)formatOnFail;
+    (void)basePath;
+    (void)maxOpenFiles;
+    if (roots.empty())
+        roots.push_back("data");
+    ::mkdir(roots.front().c_str(), 0755);
+    mounted = true;
+    return true;
+}
+
+bool FS::format()
+{
+    return true; // Never wipe the host directories
+}
+
+File FS::open(const char *path, const char *mode)
+{
+    if (!mounted)
+        return File();
+
+    bool forWrite = mode[0] == 'w' || mode[0] == 'a';
+    std::string hostPath = resolve(path, forWrite);
+    if (forWrite)
+        makeParentDirectories(hostPath);
+
+    std::string hostMode = std::string(mode) + "b";
+    FILE *file = fopen(hostPath.c_str(), hostMode.c_str());
+    return file ? File(file, path) : File();
+}
+
+bool FS::exists(const String &path) const
+{
+    return access(resolve(path, false).c_str(), F_OK) == 0;
+}
+
+bool FS::remove(const String &path)
+{
+    return ::remove(resolve(path, true).c_str()) == 0;
+}
+
+bool FS::rename(const String &from, const String &to)
+{
+    std::string target = resolve(to, true);
+    makeParentDirectories(target);
+    return ::rename(resolve(from, true).c_str(), target.c_str()) == 0;
+}
+
+bool FS::mkdir(const String &path)
+{
+    std::string hostPath = resolve(path, true);
+    makeParentDirectories(hostPath + "/");
+    return true;
+}
+
+static size_t directorySize(const std::string &path)
+{
+    size_t total = 0;
+    DIR *dir = opendir(path.c_str());
+    if (!dir)
+        return 0;
+    while (struct dirent *entry = readdir(dir))
+    {
+        if (entry->d_name[0] == '.')
+            continue;
+        std::string child = path + "/" + entry->d_name;
+        struct stat info;
+        if (stat(child.c_str(), &info) != 0)
+            continue;
+        total += S_ISDIR(info.st_mode) ? directorySize(child) : info.st_size;
+    }
+    closedir(dir);
+    return total;
+}
+
+size_t FS::usedBytes() const
+{
+    return roots.empty() ? 0 : directorySize(roots.front());
+}
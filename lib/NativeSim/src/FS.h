@@ -0,0 +1,74 @@
+// FS.h
+#ifndef NATIVE_SIM_FS_H
+#define NATIVE_SIM_FS_H
+
+#include "Arduino.h"
+#include <memory>
+#include <vector>
+
+enum SeekMode
+{
+    SeekSet = 0,
+    SeekCur = 1,
+    SeekEnd = 2
+};
+
+class File : public Stream
+{
+private:
+    struct Handle;
+    std::shared_ptr<Handle> handle;
+
+public:
+    File() {}
+    File(FILE *file, const String &path);
+
+    operator bool() const;
+    size_t size() const;
+    size_t position() const;
+    bool seek(uint32_t pos, SeekMode mode = SeekSet);
+    const char *name() const;
+    const char *path() const { return name(); }
+    bool isDirectory() const { return false; }
+    void close();
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    void flush() override;
+    size_t read(uint8_t *buffer, size_t size);
+    using Stream::readBytes;
+    size_t readBytes(char *buffer, size_t length) override { return read((uint8_t *)buffer, length); }
+    int read() override;
+    int peek() override;
+    int available() override;
+};
+
+// Flat flash file system mapped onto host directories. Reads look through
+// the roots in order (so a simulation directory can override files from
+// data/), writes always go to the first root.
+class FS
+{
+private:
+    std::vector<std::string> roots;
+    bool mounted = false;
+
+    std::string resolve(const String &path, bool forWrite) const;
+
+public:
+    void addRoot(const char *directory) { roots.push_back(directory); }
+
+    bool begin(bool formatOnFail = false, const char *basePath = "/spiffs", uint8_t maxOpenFiles = 10);
+    void end() { mounted = false; }
+    bool format();
+    File open(const String &path, const char *mode = "r") { return open(path.c_str(), mode); }
+    File open(const char *path, const char *mode = "r");
+    bool exists(const String &path) const;
+    bool remove(const String &path);
+    bool rename(const String &from, const String &to);
+    bool mkdir(const String &path);
+    size_t totalBytes() const { return 1408 * 1024; } // default.csv SPIFFS partition
+    size_t usedBytes() const;
+};
+
+#endif
@@ -0,0 +1,38 @@
+// IPAddress.h
+#ifndef NATIVE_SIM_IPADDRESS_H
+#define NATIVE_SIM_IPADDRESS_H
+
+#include "Arduino.h"
+
+class IPAddress
+{
+private:
+    uint8_t octets[4] = {0, 0, 0, 0};
+
+public:
+    IPAddress() {}
+    IPAddress(uint8_t a, uint8_t b, uint8_t c, uint8_t d) : octets{a, b, c, d} {}
+
+    bool fromString(const char *address)
+    {
+        unsigned int a, b, c, d;
+        if (sscanf(address, "%u.%u.%u.%u", &a, &b, &c, &d) != 4 || a > 255 || b > 255 || c > 255 || d > 255)
+            return false;
+        octets[0] = a;
+        octets[1] = b;
+        octets[2] = c;
+        octets[3] = d;
+        return true;
+    }
+
+    String toString() const
+    {
+        char buffer[16];
+        snprintf(buffer, sizeof(buffer), "%u.%u.%u.%u", octets[0], octets[1], octets[2], octets[3]);
+        return String(buffer);
+    }
+
+    uint8_t operator[](int index) const { return octets[index]; }
+};
+
+#endif
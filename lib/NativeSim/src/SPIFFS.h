@@ -0,0 +1,9 @@
+// SPIFFS.h
+#ifndef NATIVE_SIM_SPIFFS_H
+#define NATIVE_SIM_SPIFFS_H
+
+#include "FS.h"
+
+extern FS SPIFFS;
+
+#endif
@@ -0,0 +1,64 @@
+// SimCurve.h
+#ifndef NATIVE_SIM_CURVE_H
+#define NATIVE_SIM_CURVE_H
+
+#include <math.h>
+#include <vector>
+#include <ArduinoJson.h>
+
+// Scripted signal: (seconds, value) points, linearly interpolated and
+// repeated once the last point has passed. A single point is a constant.
+class SimCurve
+{
+private:
+    std::vector<double> times;
+    std::vector<double> values;
+
+public:
+    SimCurve(double constant = 0) { set(constant); }
+
+    void set(double constant)
+    {
+        times.assign(1, 0);
+        values.assign(1, constant);
+    }
+
+    // Accepts a number or an array of [seconds, value] pairs
+    void load(JsonVariantConst json, double fallback)
+    {
+        if (json.is<JsonArrayConst>() && json.size() > 0)
+        {
+            times.clear();
+            values.clear();
+            for (JsonArrayConst point : json.as<JsonArrayConst>())
+            {
+                times.push_back(point[0].as<double>());
+                values.push_back(point[1].as<double>());
+            }
+        }
+        else
+        {
+            set(json.is<double>() ? json.as<double>() : fallback);
+        }
+    }
+
+    double at(double seconds) const
+    {
+        if (times.size() == 1 || times.back() <= 0)
+            return values.front();
+
+        double t = fmod(seconds, times.back());
+        for (size_t i = 1; i < times.size(); i++)
+        {
+            if (t <= times[i])
+            {
+                double span = times[i] - times[i - 1];
+                double f = span > 0 ? (t - times[i - 1]) / span : 1;
+                return values[i - 1] + f * (values[i] - values[i - 1]);
+            }
+        }
+        return values.back();
+    }
+};
+
+#endif
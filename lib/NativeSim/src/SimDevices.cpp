@@ -0,0 +1,225 @@
+// SimDevices.cpp
+#include "SimDevices.h"
+
+#include <errno.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <random>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+void SimDevice::configure(JsonObjectConst json)
+{
+    port = json["port"] | 0;
+    latencyMs = json["latency_ms"] | 0.0;
+    loss = json["loss"] | 0.0;
+}
+
+bool SimDevice::start()
+{
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(listenFd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(listenFd, 8) < 0)
+    {
+        Serial.printf("Sim > %s > Cannot listen on port %u: %s\n", name, port, strerror(errno));
+        close(listenFd);
+        listenFd = -1;
+        return false;
+    }
+
+    Serial.printf("Sim > %s > Listening on 127.0.0.1:%u (latency %.0f ms, loss %.0f%%)\n",
+                  name, port, latencyMs, loss * 100);
+    std::thread(threadEntry, this).detach();
+    return true;
+}
+
+void SimDevice::serve()
+{
+    while (true)
+    {
+        int fd = accept(listenFd, nullptr, nullptr);
+        if (fd >= 0)
+        {
+            handleConnection(fd);
+            close(fd);
+        }
+    }
+}
+
+void SimDevice::handleConnection(int fd)
+{
+    connections++;
+    // HTTP/1.1 keep-alive: answer requests until the client closes, asks
+    // to close or stays quiet for KEEP_ALIVE_TIME
+    while (handleRequest(fd))
+    {
+    }
+}
+
+bool SimDevice::handleRequest(int fd)
+{
+    static thread_local std::mt19937 random(port);
+    std::string raw;
+    size_t headerEnd = std::string::npos;
+    size_t bodyLength = 0;
+    char chunk[512];
+
+    while (headerEnd == std::string::npos || raw.size() < headerEnd + bodyLength)
+    {
+        struct pollfd waitFor = {fd, POLLIN, 0};
+        if (poll(&waitFor, 1, raw.empty() ? KEEP_ALIVE_TIME : 1000) <= 0)
+            return false;
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0)
+            return false;
+        raw.append(chunk, n);
+
+        if (headerEnd == std::string::npos && (headerEnd = raw.find("\r\n\r\n")) != std::string::npos)
+        {
+            headerEnd += 4;
+            const char *lengthHeader = strcasestr(raw.c_str(), "Content-Length:");
+            if (lengthHeader && lengthHeader < raw.c_str() + headerEnd)
+                bodyLength = atol(lengthHeader + 15);
+        }
+    }
+    requests++;
+
+    if (std::uniform_real_distribution<double>(0, 1)(random) < loss)
+    {
+        dropped++;
+        delay(STALL_TIME);
+        return false;
+    }
+    if (latencyMs > 0)
+        delay((unsigned long)latencyMs);
+
+    size_t methodEnd = raw.find(' ');
+    size_t pathEnd = raw.find(' ', methodEnd + 1);
+    String response;
+    int status = respond(String(raw.substr(0, methodEnd)),
+                         String(raw.substr(methodEnd + 1, pathEnd - methodEnd - 1)),
+                         String(raw.substr(headerEnd, bodyLength)), response);
+
+    const char *connection = strcasestr(raw.c_str(), "Connection:");
+    bool keepAlive = !(connection && connection < raw.c_str() + headerEnd &&
+                       strncasecmp(connection + 11 + strspn(connection + 11, " "), "close", 5) == 0);
+
+    char head[160];
+    int headLength = snprintf(head, sizeof(head),
+                              "HTTP/1.1 %d %s\r\nContent-Type: application/json\r\n"
+                              "Content-Length: %u\r\nConnection: %s\r\n\r\n",
+                              status, status == 200 ? "OK" : "Error", (unsigned)response.length(),
+                              keepAlive ? "keep-alive" : "close");
+    send(fd, head, headLength, MSG_NOSIGNAL);
+    send(fd, response.c_str(), response.length(), MSG_NOSIGNAL);
+    return keepAlive;
+}
+
+// Socket
+
+void SimSocket::configure(JsonObjectConst json)
+{
+    SimDevice::configure(json);
+    loadW = json["load_w"] | 0.0;
+    powerOn = json["power_on"] | false;
+}
+
+int SimSocket::respond(const String &method, const String &path, const String &body, String &response)
+{
+    if (path != "/api/v1/state")
+        return 404;
+
+    if (method == "PUT")
+    {
+        StaticJsonDocument<128> doc;
+        if (deserializeJson(doc, body.c_str()) || !doc["power_on"].is<bool>())
+            return 400;
+        powerOn = doc["power_on"].as<bool>();
+    }
+
+    StaticJsonDocument<128> state;
+    state["power_on"] = (bool)powerOn;
+    state["switch_lock"] = false;
+    state["brightness"] = 255;
+    serializeJson(state, response);
+    return 200;
+}
+
+// P1 meter
+
+void SimP1Meter::configure(JsonObjectConst json)
+{
+    SimDevice::configure(json);
+    power.load(json["power_w"], 0);
+    importKwh = json["import_kwh"] | 12345.0;
+    exportKwh = json["export_kwh"] | 6789.0;
+}
+
+double SimP1Meter::activePower() const
+{
+    double watts = power.at(simSeconds());
+    for (int i = 0; i < MAX_SOCKETS; i++)
+    {
+        if (sockets[i])
+            watts += sockets[i]->getLoad();
+    }
+    return watts;
+}
+
+int SimP1Meter::respond(const String &method, const String &path, const String &body, String &response)
+{
+    (void)body;
+    if (method != "GET" || path != "/api/v1/data")
+        return 404;
+
+    double watts = activePower();
+    double now = simSeconds();
+    {
+        std::lock_guard<std::mutex> lock(meterMutex);
+        double kwh = fabs(watts) * (now - lastSample) / 3600000.0;
+        (watts >= 0 ? importKwh : exportKwh) += kwh;
+        lastSample = now;
+    }
+
+    // Same shape as the HomeWizard P1 meter API v1
+    StaticJsonDocument<1024> doc;
+    doc["wifi_ssid"] = "simulation";
+    doc["wifi_strength"] = 100;
+    doc["smr_version"] = 50;
+    doc["meter_model"] = "Simulated";
+    doc["unique_id"] = "00000000000000000000000000000000";
+    doc["active_tariff"] = 2;
+    doc["total_power_import_kwh"] = importKwh;
+    doc["total_power_import_t1_kwh"] = importKwh / 2;
+    doc["total_power_import_t2_kwh"] = importKwh / 2;
+    doc["total_power_export_kwh"] = exportKwh;
+    doc["total_power_export_t1_kwh"] = exportKwh / 2;
+    doc["total_power_export_t2_kwh"] = exportKwh / 2;
+    doc["active_power_w"] = (int)lround(watts);
+    doc["active_power_l1_w"] = (int)lround(watts / 3);
+    doc["active_power_l2_w"] = (int)lround(watts / 3);
+    doc["active_power_l3_w"] = (int)lround(watts / 3);
+    doc["active_voltage_l1_v"] = 230.1;
+    doc["active_voltage_l2_v"] = 229.8;
+    doc["active_voltage_l3_v"] = 231.0;
+    doc["active_current_a"] = fabs(watts) / 230.0;
+    doc["active_current_l1_a"] = fabs(watts) / 690.0;
+    doc["active_current_l2_a"] = fabs(watts) / 690.0;
+    doc["active_current_l3_a"] = fabs(watts) / 690.0;
+    doc["voltage_sag_l1_count"] = 1;
+    doc["voltage_swell_l1_count"] = 0;
+    doc["any_power_fail_count"] = 4;
+    doc["long_power_fail_count"] = 1;
+    doc["total_gas_m3"] = 2569.646;
+    doc["gas_timestamp"] = 210606140010;
+    doc["gas_unique_id"] = "00000000000000000000000000000000";
+    serializeJson(doc, response);
+    return 200;
+}
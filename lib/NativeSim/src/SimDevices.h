@@ -0,0 +1,93 @@
+// SimDevices.h
+#ifndef NATIVE_SIM_DEVICES_H
+#define NATIVE_SIM_DEVICES_H
+
+#include "Arduino.h"
+#include "SimCurve.h"
+#include "SimEnvironment.h"
+#include <atomic>
+#include <mutex>
+#include <ArduinoJson.h>
+
+// Stand-in for a HomeWizard device: a small HTTP server on 127.0.0.1 with
+// its own thread. Every request is answered after latencyMs, or - with
+// probability loss - accepted and then left hanging until the client gives
+// up. Connections are kept open between requests (HTTP/1.1 keep-alive).
+class SimDevice
+{
+protected:
+    const char *name;
+    uint16_t port = 0;
+    double latencyMs = 0;
+    double loss = 0;
+    int listenFd = -1;
+    std::atomic<unsigned long> requests{0};
+    std::atomic<unsigned long> dropped{0};
+    std::atomic<unsigned long> connections{0};
+
+    // Builds the response body, returns the HTTP status code
+    virtual int respond(const String &method, const String &path, const String &body, String &response) = 0;
+
+private:
+    static const unsigned long STALL_TIME = 3000; // Longer than any client timeout
+    static const int KEEP_ALIVE_TIME = 30000;      // ms an idle connection stays open
+
+    static void threadEntry(SimDevice *device) { device->serve(); }
+    void serve();
+    void handleConnection(int fd);
+    bool handleRequest(int fd); // false: close the connection
+
+public:
+    explicit SimDevice(const char *name) : name(name) {}
+    virtual ~SimDevice() {}
+
+    void configure(JsonObjectConst json);
+    bool start(); // Binds the port and starts the thread
+    uint16_t getPort() const { return port; }
+    unsigned long getRequests() const { return requests; }
+    unsigned long getDropped() const { return dropped; }
+    unsigned long getConnections() const { return connections; }
+};
+
+class SimSocket : public SimDevice
+{
+private:
+    std::atomic<bool> powerOn{false};
+    double loadW = 0;
+
+protected:
+    int respond(const String &method, const String &path, const String &body, String &response) override;
+
+public:
+    SimSocket() : SimDevice("socket") {}
+    void configure(JsonObjectConst json);
+    double getLoad() const { return powerOn ? loadW : 0; }
+    bool isOn() const { return powerOn; }
+};
+
+// P1 meter: the scripted household power (positive = import, negative =
+// solar export) plus whatever the simulated sockets are switching.
+class SimP1Meter : public SimDevice
+{
+public:
+    static const int MAX_SOCKETS = 32;
+
+private:
+    SimCurve power;
+    SimSocket *sockets[MAX_SOCKETS] = {};
+    std::mutex meterMutex;
+    double importKwh = 0;
+    double exportKwh = 0;
+    double lastSample = 0;
+
+protected:
+    int respond(const String &method, const String &path, const String &body, String &response) override;
+
+public:
+    SimP1Meter() : SimDevice("p1") {}
+    void configure(JsonObjectConst json);
+    void attachSocket(int index, SimSocket *socket) { sockets[index] = socket; }
+    double activePower() const;
+};
+
+#endif
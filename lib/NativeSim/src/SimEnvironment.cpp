@@ -0,0 +1,13 @@
+// SimEnvironment.cpp
+#include "SimEnvironment.h"
+#include "ESP32Ping.h"
+#include "Wire.h"
+
+SimEnvironment simEnvironment;
+TwoWire Wire;
+PingClass Ping;
+
+double simSeconds()
+{
+    return simElapsedMicros() / 1e6;
+}
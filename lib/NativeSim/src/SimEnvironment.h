@@ -0,0 +1,21 @@
+// SimEnvironment.h
+#ifndef NATIVE_SIM_ENVIRONMENT_H
+#define NATIVE_SIM_ENVIRONMENT_H
+
+#include "SimCurve.h"
+
+// What the simulated I2C sensors and the ping target report
+struct SimEnvironment
+{
+    SimCurve temperature{21.5};
+    SimCurve humidity{45};
+    SimCurve pressure{1013}; // hPa
+    SimCurve lux{300};
+    SimCurve phonePresent{1}; // > 0.5 = answers pings
+    double pingMs = 12;
+};
+
+extern SimEnvironment simEnvironment;
+double simSeconds(); // Seconds since the simulation started
+
+#endif
@@ -0,0 +1,85 @@
+// SimHeap.cpp
+// Replaces malloc/calloc/realloc of the C library (glibc) for the whole
+// program; the real ones are still there as __libc_*.
+#include "SimHeap.h"
+
+#include <atomic>
+#include <stddef.h>
+#include <string.h>
+
+extern "C"
+{
+    void *__libc_malloc(size_t size);
+    void *__libc_calloc(size_t count, size_t size);
+    void *__libc_realloc(void *pointer, size_t size);
+}
+
+static const int MAX_TASKS = 16;
+
+struct TrackedTask
+{
+    const char *name;
+    std::atomic<unsigned long> allocations;
+};
+
+static TrackedTask tasks[MAX_TASKS];
+static std::atomic<int> taskCount{0};
+static thread_local TrackedTask *currentTask = nullptr;
+
+static inline void countAllocation()
+{
+    if (currentTask)
+        currentTask->allocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+extern "C"
+{
+    void *malloc(size_t size)
+    {
+        countAllocation();
+        return __libc_malloc(size);
+    }
+
+    void *calloc(size_t count, size_t size)
+    {
+        countAllocation();
+        return __libc_calloc(count, size);
+    }
+
+    void *realloc(void *pointer, size_t size)
+    {
+        countAllocation();
+        return __libc_realloc(pointer, size);
+    }
+}
+
+void simHeapTrackThread(const char *name)
+{
+    int index = taskCount.fetch_add(1);
+    if (index >= MAX_TASKS)
+        return;
+    tasks[index].name = name;
+    currentTask = &tasks[index];
+}
+
+unsigned long simHeapAllocations(const char *name)
+{
+    unsigned long total = 0;
+    for (int i = 0; i < simHeapTaskCount(); i++)
+    {
+        if (tasks[i].name && strcmp(tasks[i].name, name) == 0)
+            total += tasks[i].allocations.load(std::memory_order_relaxed);
+    }
+    return total;
+}
+
+int simHeapTaskCount()
+{
+    int count = taskCount.load();
+    return count < MAX_TASKS ? count : MAX_TASKS;
+}
+
+const char *simHeapTaskName(int index)
+{
+    return tasks[index].name;
+}
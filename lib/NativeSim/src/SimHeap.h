@@ -0,0 +1,19 @@
+// SimHeap.h
+#ifndef NATIVE_SIM_HEAP_H
+#define NATIVE_SIM_HEAP_H
+
+// Counts heap allocations (malloc, calloc, realloc and so every new and
+// String) per FreeRTOS task in the native build. xTaskCreatePinnedToCore()
+// registers its tasks by name, SimMain registers loop().
+
+// Counts allocations made on the calling thread under this name
+void simHeapTrackThread(const char *name);
+
+// Allocations made by the named task so far, 0 for an unknown name
+unsigned long simHeapAllocations(const char *name);
+
+// Tracked tasks, for the report
+int simHeapTaskCount();
+const char *simHeapTaskName(int index);
+
+#endif
@@ -0,0 +1,244 @@
+// SimMain.cpp
+// Entry point of the native simulation: loads the scenario, starts the
+// stand-in devices and runs the firmware's setup()/loop() on the host.
+//
+//   .pio/build/native/program [scenario.json]
+#include "Arduino.h"
+#include "SPIFFS.h"
+#include "SimDevices.h"
+#include "SimEnvironment.h"
+#include "SimHeap.h"
+
+#include <signal.h>
+#include <vector>
+
+static const char *DEFAULT_SCENARIO = "sim/scenario.json";
+static const unsigned long REPORT_INTERVAL = 60000; // ms between loop timing reports
+
+static volatile sig_atomic_t stopRequested = 0;
+
+static SimP1Meter p1Meter;
+static SimSocket sockets[SimP1Meter::MAX_SOCKETS];
+
+// "heap_check" in the scenario: allocations per task after a warm-up
+class HeapCheck
+{
+private:
+    static const int MAX_LIMITS = 8;
+
+    unsigned long afterMs = 0;
+    bool started = false;
+    int limitCount = 0;
+    std::string names[MAX_LIMITS];
+    unsigned long limits[MAX_LIMITS];
+    unsigned long atStart[MAX_LIMITS];
+
+public:
+    void load(JsonObjectConst check)
+    {
+        afterMs = (check["after_s"] | 10UL) * 1000;
+        for (JsonPairConst limit : check["max_allocations"].as<JsonObjectConst>())
+        {
+            if (limitCount == MAX_LIMITS)
+                break;
+            names[limitCount] = limit.key().c_str();
+            limits[limitCount] = limit.value().as<unsigned long>();
+            limitCount++;
+        }
+    }
+
+    // Call every pass with the ms since setup()
+    void update(uint64_t elapsedMs)
+    {
+        if (started || limitCount == 0 || elapsedMs < afterMs)
+            return;
+        started = true;
+        for (int i = 0; i < limitCount; i++)
+            atStart[i] = simHeapAllocations(names[i].c_str());
+    }
+
+    // Prints the counts, false when a task went over its limit
+    bool report() const
+    {
+        for (int i = 0; i < simHeapTaskCount(); i++)
+        {
+            Serial.printf("Sim > heap > %s > %lu allocations\n", simHeapTaskName(i),
+                          simHeapAllocations(simHeapTaskName(i)));
+        }
+        if (limitCount == 0)
+            return true;
+        if (!started)
+        {
+            Serial.printf("Sim > heap check > FAIL: ended before the %lu s warm-up\n", afterMs / 1000);
+            return false;
+        }
+
+        bool passed = true;
+        for (int i = 0; i < limitCount; i++)
+        {
+            unsigned long count = simHeapAllocations(names[i].c_str()) - atStart[i];
+            bool ok = count <= limits[i];
+            Serial.printf("Sim > heap check > %s > %lu allocations after %lu s (max %lu) %s\n", names[i].c_str(),
+                          count, afterMs / 1000, limits[i], ok ? "ok" : "FAIL");
+            passed &= ok;
+        }
+        return passed;
+    }
+};
+
+static HeapCheck heapCheck;
+
+// Loop pass times in 10 us buckets, the last bucket collects everything above
+class PassTimer
+{
+private:
+    static const unsigned long BUCKET_US = 10;
+    static const size_t BUCKETS = 10000;
+
+    std::vector<unsigned long> histogram = std::vector<unsigned long>(BUCKETS, 0);
+    unsigned long passes = 0;
+    unsigned long long total = 0;
+    unsigned long worst = 0;
+
+public:
+    void record(unsigned long us)
+    {
+        histogram[std::min<size_t>(us / BUCKET_US, BUCKETS - 1)]++;
+        passes++;
+        total += us;
+        worst = std::max(worst, us);
+    }
+
+    unsigned long percentile(double p) const
+    {
+        unsigned long target = (unsigned long)(passes * p);
+        unsigned long seen = 0;
+        for (size_t i = 0; i < BUCKETS; i++)
+        {
+            seen += histogram[i];
+            if (seen > target)
+                return (i + 1) * BUCKET_US;
+        }
+        return worst;
+    }
+
+    void print() const
+    {
+        if (passes == 0)
+            return;
+        Serial.printf("Sim > loop() > passes %lu, avg %llu us, p99 %lu us, max %lu us\n",
+                      passes, total / passes, percentile(0.99), worst);
+    }
+};
+
+static bool loadScenario(const char *path, unsigned long &duration)
+{
+    FILE *file = fopen(path, "rb");
+    if (!file)
+    {
+        Serial.printf("Sim > Cannot open scenario %s\n", path);
+        return false;
+    }
+    std::string text;
+    char chunk[512];
+    size_t n;
+    while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+        text.append(chunk, n);
+    fclose(file);
+
+    DynamicJsonDocument doc(8192);
+    DeserializationError error = deserializeJson(doc, text);
+    if (error)
+    {
+        Serial.printf("Sim > Scenario %s: %s\n", path, error.c_str());
+        return false;
+    }
+
+    duration = (doc["duration_s"] | 0UL) * 1000; // 0 = run until Ctrl-C
+    if (doc.containsKey("clock_start_ms"))
+    {
+        uint64_t clockStart = doc["clock_start_ms"].as<uint64_t>();
+        simSetClockStart(clockStart);
+        Serial.printf("Sim > Clock starts at %llu ms, millis() wraps in %lld s\n", (unsigned long long)clockStart,
+                      (long long)((0x100000000ULL - clockStart % 0x100000000ULL) / 1000));
+    }
+
+    JsonObjectConst env = doc["environment"];
+    simEnvironment.temperature.load(env["temperature"], 21.5);
+    simEnvironment.humidity.load(env["humidity"], 45);
+    simEnvironment.pressure.load(env["pressure"], 1013);
+    simEnvironment.lux.load(env["lux"], 300);
+    simEnvironment.phonePresent.load(env["phone_present"], 1);
+    simEnvironment.pingMs = env["ping_ms"] | 12.0;
+    heapCheck.load(doc["heap_check"]);
+
+    p1Meter.configure(doc["p1"]);
+    JsonArrayConst socketList = doc["sockets"];
+    for (int i = 0; i < SimP1Meter::MAX_SOCKETS && i < (int)socketList.size(); i++)
+    {
+        sockets[i].configure(socketList[i]);
+    }
+
+    const char *fsRoot = doc["fs_root"] | "sim/fs";
+    SPIFFS.addRoot(fsRoot); // config.json pointing at the stand-ins
+    SPIFFS.addRoot("data"); // Web pages, as uploaded to the real device
+    return true;
+}
+
+static void onSignal(int)
+{
+    stopRequested = 1;
+}
+
+int main(int argc, char **argv)
+{
+    setvbuf(stdout, nullptr, _IOLBF, 0);
+    signal(SIGINT, onSignal);
+    signal(SIGTERM, onSignal);
+    signal(SIGPIPE, SIG_IGN);
+
+    const char *scenario = argc > 1 ? argv[1] : DEFAULT_SCENARIO;
+    unsigned long duration = 0;
+    if (!loadScenario(scenario, duration))
+        return 1;
+
+    if (p1Meter.getPort())
+        p1Meter.start();
+    for (int i = 0; i < SimP1Meter::MAX_SOCKETS; i++)
+    {
+        if (sockets[i].getPort() && sockets[i].start())
+            p1Meter.attachSocket(i, &sockets[i]);
+    }
+
+    simHeapTrackThread("loop");
+    setup();
+
+    PassTimer timer;
+    uint64_t start = simElapsedMicros() / 1000;
+    uint64_t lastReport = start;
+    while (!stopRequested && (duration == 0 || simElapsedMicros() / 1000 - start < duration))
+    {
+        uint64_t passStart = simElapsedMicros();
+        loop();
+        timer.record(simElapsedMicros() - passStart);
+        heapCheck.update(simElapsedMicros() / 1000 - start);
+
+        if (simElapsedMicros() / 1000 - lastReport >= REPORT_INTERVAL)
+        {
+            lastReport = simElapsedMicros() / 1000;
+            timer.print();
+        }
+    }
+
+    timer.print();
+    Serial.printf("Sim > p1 > %lu requests on %lu connections, %lu dropped\n", p1Meter.getRequests(),
+                  p1Meter.getConnections(), p1Meter.getDropped());
+    for (int i = 0; i < SimP1Meter::MAX_SOCKETS; i++)
+    {
+        if (sockets[i].getPort())
+            Serial.printf("Sim > socket %d > %lu requests on %lu connections, %lu dropped, %s\n", i + 1,
+                          sockets[i].getRequests(), sockets[i].getConnections(), sockets[i].getDropped(),
+                          sockets[i].isOn() ? "on" : "off");
+    }
+    return heapCheck.report() ? 0 : 1;
+}
@@ -0,0 +1,323 @@
+// WebServer.cpp
+#include "WebServer.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+static const size_t MAX_REQUEST_SIZE = 16384;
+static const int REQUEST_TIMEOUT = 1000; // ms to receive a complete request
+
+void WebServer::begin()
+{
+    if (listenFd >= 0)
+        return;
+
+    listenFd = socket(AF_INET, SOCK_STREAM, 0);
+    int reuse = 1;
+    setsockopt(listenFd, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(port);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(listenFd, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(listenFd, 8) < 0)
+    {
+        Serial.printf("Sim > Web server cannot listen on port %d: %s\n", port, strerror(errno));
+        ::close(listenFd);
+        listenFd = -1;
+        return;
+    }
+    fcntl(listenFd, F_SETFL, fcntl(listenFd, F_GETFL, 0) | O_NONBLOCK);
+}
+
+void WebServer::close()
+{
+    if (listenFd >= 0)
+    {
+        ::close(listenFd);
+        listenFd = -1;
+    }
+}
+
+void WebServer::on(const String &uri, HTTPMethod method, THandlerFunction handler)
+{
+    routes.push_back({uri, method, handler});
+}
+
+void WebServer::handleClient()
+{
+    if (listenFd < 0)
+        return;
+
+    int fd = accept(listenFd, nullptr, nullptr);
+    if (fd < 0)
+        return;
+
+    current = WiFiClient(fd);
+    args.clear();
+    requestHeaders.clear();
+    responseHeaders = "";
+    contentLength = CONTENT_LENGTH_NOT_SET;
+    chunked = false;
+
+    if (readRequest(fd))
+    {
+        bool handled = false;
+        for (const Route &route : routes)
+        {
+            if (route.uri == requestUri && (route.method == HTTP_ANY || route.method == requestMethod))
+            {
+                route.handler();
+                handled = true;
+                break;
+            }
+        }
+        if (!handled)
+        {
+            if (notFoundHandler)
+                notFoundHandler();
+            else
+                send(404, "text/plain", "Not found");
+        }
+    }
+
+    current.stop();
+    current = WiFiClient();
+}
+
+bool WebServer::readRequest(int fd)
+{
+    std::string raw;
+    size_t headerEnd = std::string::npos;
+    size_t bodyLength = 0;
+    char chunk[1024];
+
+    while (true)
+    {
+        struct pollfd waitFor = {fd, POLLIN, 0};
+        if (poll(&waitFor, 1, REQUEST_TIMEOUT) <= 0)
+            return false;
+        ssize_t n = recv(fd, chunk, sizeof(chunk), 0);
+        if (n <= 0)
+            return false;
+        raw.append(chunk, n);
+        if (raw.size() > MAX_REQUEST_SIZE)
+            return false;
+
+        if (headerEnd == std::string::npos)
+        {
+            headerEnd = raw.find("\r\n\r\n");
+            if (headerEnd == std::string::npos)
+                continue;
+            headerEnd += 4;
+
+            // Request line
+            size_t lineEnd = raw.find("\r\n");
+            String line(raw.substr(0, lineEnd));
+            int space1 = line.indexOf(' ');
+            int space2 = line.indexOf(' ', space1 + 1);
+            if (space1 < 0 || space2 < 0)
+                return false;
+            String methodName = line.substring(0, space1);
+            requestMethod = methodName == "POST"      ? HTTP_POST
+                            : methodName == "PUT"     ? HTTP_PUT
+                            : methodName == "DELETE"  ? HTTP_DELETE
+                            : methodName == "OPTIONS" ? HTTP_OPTIONS
+                                                      : HTTP_GET;
+            String target = line.substring(space1 + 1, space2);
+            int question = target.indexOf('?');
+            requestUri = urlDecode(question < 0 ? target : target.substring(0, question));
+            if (question >= 0)
+                parseQuery(target.substring(question + 1));
+
+            // Headers
+            size_t pos = lineEnd + 2;
+            while (pos < headerEnd - 2)
+            {
+                size_t end = raw.find("\r\n", pos);
+                String headerLine(raw.substr(pos, end - pos));
+                int colon = headerLine.indexOf(':');
+                if (colon > 0)
+                {
+                    String value = headerLine.substring(colon + 1);
+                    value.trim();
+                    requestHeaders.push_back({headerLine.substring(0, colon), value});
+                    if (headerLine.substring(0, colon).equalsIgnoreCase("Content-Length"))
+                        bodyLength = value.toInt();
+                }
+                pos = end + 2;
+            }
+        }
+
+        if (raw.size() >= headerEnd + bodyLength)
+            break;
+    }
+
+    if (bodyLength > 0)
+        args.push_back({"plain", String(raw.substr(headerEnd, bodyLength))});
+    return true;
+}
+
+void WebServer::parseQuery(const String &query)
+{
+    int start = 0;
+    while (start < (int)query.length())
+    {
+        int end = query.indexOf('&', start);
+        if (end < 0)
+            end = query.length();
+        String pair = query.substring(start, end);
+        int equals = pair.indexOf('=');
+        if (equals < 0)
+            args.push_back({urlDecode(pair), String()});
+        else
+            args.push_back({urlDecode(pair.substring(0, equals)), urlDecode(pair.substring(equals + 1))});
+        start = end + 1;
+    }
+}
+
+String WebServer::urlDecode(const String &text)
+{
+    String decoded;
+    for (unsigned int i = 0; i < text.length(); i++)
+    {
+        char c = text[i];
+        if (c == '+')
+        {
+            decoded += ' ';
+        }
+        else if (c == '%' && i + 2 < text.length())
+        {
+            char hex[3] = {text[i + 1], text[i + 2], 0};
+            decoded += (char)strtol(hex, nullptr, 16);
+            i += 2;
+        }
+        else
+        {
+            decoded += c;
+        }
+    }
+    return decoded;
+}
+
+bool WebServer::hasArg(const String &name) const
+{
+    for (const Arg &a : args)
+    {
+        if (a.key == name)
+            return true;
+    }
+    return false;
+}
+
+String WebServer::arg(const String &name) const
+{
+    for (const Arg &a : args)
+    {
+        if (a.key == name)
+            return a.value;
+    }
+    return String();
+}
+
+String WebServer::header(const String &name) const
+{
+    bool collected = false;
+    for (const String &key : collectedHeaders)
+    {
+        collected |= key.equalsIgnoreCase(name);
+    }
+    if (!collected)
+        return String();
+
+    for (const Arg &h : requestHeaders)
+    {
+        if (h.key.equalsIgnoreCase(name))
+            return h.value;
+    }
+    return String();
+}
+
+void WebServer::collectHeaders(const char *headerKeys[], const size_t headerKeysCount)
+{
+    collectedHeaders.clear();
+    for (size_t i = 0; i < headerKeysCount; i++)
+    {
+        collectedHeaders.push_back(headerKeys[i]);
+    }
+}
+
+void WebServer::sendHeader(const String &name, const String &value, bool first)
+{
+    String line = name + ": " + value + "\r\n";
+    responseHeaders = first ? line + responseHeaders : responseHeaders + line;
+}
+
+static const char *reasonPhrase(int code)
+{
+    switch (code)
+    {
+    case 200:
+        return "OK";
+    case 204:
+        return "No Content";
+    case 304:
+        return "Not Modified";
+    case 400:
+        return "Bad Request";
+    case 404:
+        return "Not Found";
+    case 500:
+        return "Internal Server Error";
+    case 503:
+        return "Service Unavailable";
+    default:
+        return "";
+    }
+}
+
+// Same rules as the ESP32 core: an explicit setContentLength() wins, so a
+// handler can send the headers with an empty body and stream the rest.
+// CONTENT_LENGTH_UNKNOWN makes it a chunked response, see sendContent().
+void WebServer::send(int code, const char *contentType, const String &content)
+{
+    String head = "HTTP/1.1 " + String(code) + " " + reasonPhrase(code) + "\r\n";
+    if (contentType && *contentType)
+        head += String("Content-Type: ") + contentType + "\r\n";
+    if (contentLength == CONTENT_LENGTH_NOT_SET)
+        head += "Content-Length: " + String((unsigned long)content.length()) + "\r\n";
+    else if (contentLength != CONTENT_LENGTH_UNKNOWN)
+        head += "Content-Length: " + String((unsigned long)contentLength) + "\r\n";
+    else
+        head += "Transfer-Encoding: chunked\r\n";
+    chunked = contentLength == CONTENT_LENGTH_UNKNOWN;
+    head += responseHeaders;
+    head += "Connection: close\r\n\r\n";
+    responseHeaders = "";
+
+    current.write(head.c_str(), head.length());
+    if (content.length() > 0)
+        sendContent(content);
+}
+
+// One chunk in a chunked response, an empty one is the last; otherwise
+// written as it is
+void WebServer::sendContent(const char *content, size_t length)
+{
+    if (!chunked)
+    {
+        current.write((const uint8_t *)content, length);
+        return;
+    }
+    char size[12];
+    int n = snprintf(size, sizeof(size), "%zx\r\n", length);
+    current.write((const uint8_t *)size, n);
+    current.write((const uint8_t *)content, length);
+    current.write((const uint8_t *)"\r\n", 2);
+    if (length == 0)
+        chunked = false;
+}
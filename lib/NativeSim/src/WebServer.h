@@ -0,0 +1,94 @@
+// WebServer.h
+#ifndef NATIVE_SIM_WEB_SERVER_H
+#define NATIVE_SIM_WEB_SERVER_H
+
+#include "Arduino.h"
+#include "WiFiClient.h"
+#include <functional>
+#include <vector>
+
+enum HTTPMethod
+{
+    HTTP_ANY,
+    HTTP_GET,
+    HTTP_POST,
+    HTTP_PUT,
+    HTTP_DELETE,
+    HTTP_OPTIONS
+};
+
+#define CONTENT_LENGTH_UNKNOWN ((size_t)-1)
+#define CONTENT_LENGTH_NOT_SET ((size_t)-2)
+
+// Single-threaded HTTP/1.1 server with the Arduino-ESP32 WebServer API.
+// handleClient() serves at most one request per call and never waits for a
+// connection; the connection is closed after the response.
+class WebServer
+{
+public:
+    typedef std::function<void()> THandlerFunction;
+
+private:
+    struct Route
+    {
+        String uri;
+        HTTPMethod method;
+        THandlerFunction handler;
+    };
+    struct Arg
+    {
+        String key;
+        String value;
+    };
+
+    int port;
+    int listenFd = -1;
+    WiFiClient current;
+    std::vector<Route> routes;
+    THandlerFunction notFoundHandler;
+
+    HTTPMethod requestMethod = HTTP_GET;
+    String requestUri;
+    std::vector<Arg> args;
+    std::vector<Arg> requestHeaders;
+    std::vector<String> collectedHeaders; // As on the ESP32, header() only sees these
+    String responseHeaders;
+    size_t contentLength = CONTENT_LENGTH_NOT_SET;
+    bool chunked = false; // CONTENT_LENGTH_UNKNOWN response, sendContent("") ends it
+
+    bool readRequest(int fd);
+    void parseQuery(const String &query);
+    static String urlDecode(const String &text);
+
+public:
+    explicit WebServer(int port = 80) : port(port) {}
+    ~WebServer() { close(); }
+
+    void begin();
+    void close();
+    void handleClient();
+
+    void on(const String &uri, THandlerFunction handler) { on(uri, HTTP_ANY, handler); }
+    void on(const String &uri, HTTPMethod method, THandlerFunction handler);
+    void onNotFound(THandlerFunction handler) { notFoundHandler = handler; }
+
+    WiFiClient &client() { return current; }
+    HTTPMethod method() const { return requestMethod; }
+    String uri() const { return requestUri; }
+    bool hasArg(const String &name) const;
+    String arg(const String &name) const;
+    String header(const String &name) const;
+    void collectHeaders(const char *headerKeys[], const size_t headerKeysCount);
+
+    void sendHeader(const String &name, const String &value, bool first = false);
+    void setContentLength(size_t length) { contentLength = length; }
+    void send(int code, const char *contentType = nullptr, const String &content = String());
+    void send(int code, const String &contentType, const String &content)
+    {
+        send(code, contentType.c_str(), content);
+    }
+    void sendContent(const char *content, size_t length);
+    void sendContent(const String &content) { sendContent(content.c_str(), content.length()); }
+};
+
+#endif
@@ -0,0 +1,83 @@
+// WiFi.cpp
+#include "WiFi.h"
+
+#include <errno.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+WiFiClass WiFi;
+
+uint8_t WiFiClient::connected()
+{
+    int sock = fd();
+    if (sock < 0)
+        return 0;
+
+    char probe;
+    ssize_t n = recv(sock, &probe, 1, MSG_PEEK | MSG_DONTWAIT);
+    if (n == 0 || (n < 0 && errno != EAGAIN && errno != EWOULDBLOCK))
+        return 0;
+    return 1;
+}
+
+WiFiClient::Socket::~Socket()
+{
+    close(fd);
+}
+
+void WiFiClient::setNoDelay(bool noDelay)
+{
+    int sock = fd();
+    if (sock < 0)
+        return;
+    int flag = noDelay ? 1 : 0;
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+}
+
+size_t WiFiClient::write(const uint8_t *buffer, size_t size)
+{
+    int sock = fd();
+    if (sock < 0)
+        return 0;
+
+    size_t total = 0;
+    while (total < size)
+    {
+        ssize_t n = send(sock, buffer + total, size - total, MSG_NOSIGNAL);
+        if (n <= 0)
+            break;
+        total += n;
+    }
+    return total;
+}
+
+int WiFiClient::available()
+{
+    int sock = fd();
+    if (sock < 0)
+        return 0;
+    int pending = 0;
+    ioctl(sock, FIONREAD, &pending);
+    return pending;
+}
+
+int WiFiClient::read()
+{
+    int sock = fd();
+    uint8_t c;
+    if (sock < 0 || recv(sock, &c, 1, MSG_DONTWAIT) != 1)
+        return -1;
+    return c;
+}
+
+int WiFiClient::peek()
+{
+    int sock = fd();
+    uint8_t c;
+    if (sock < 0 || recv(sock, &c, 1, MSG_PEEK | MSG_DONTWAIT) != 1)
+        return -1;
+    return c;
+}
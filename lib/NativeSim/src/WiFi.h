@@ -0,0 +1,83 @@
+// WiFi.h
+#ifndef NATIVE_SIM_WIFI_H
+#define NATIVE_SIM_WIFI_H
+
+#include "Arduino.h"
+#include "IPAddress.h"
+#include "WiFiClient.h"
+
+typedef enum
+{
+    WL_IDLE_STATUS = 0,
+    WL_NO_SSID_AVAIL = 1,
+    WL_CONNECTED = 3,
+    WL_CONNECT_FAILED = 4,
+    WL_CONNECTION_LOST = 5,
+    WL_DISCONNECTED = 6
+} wl_status_t;
+
+typedef enum
+{
+    WIFI_OFF = 0,
+    WIFI_STA = 1,
+    WIFI_AP = 2,
+    WIFI_AP_STA = 3
+} wifi_mode_t;
+
+typedef enum
+{
+    WIFI_POWER_19_5dBm = 78,
+    WIFI_POWER_2dBm = 8
+} wifi_power_t;
+
+// The host network is always up; begin() just records the SSID
+class WiFiClass
+{
+private:
+    String ssid;
+    wl_status_t currentStatus = WL_DISCONNECTED;
+
+public:
+    wl_status_t status() const { return currentStatus; }
+    wl_status_t begin(const char *networkSsid, const char *password = nullptr)
+    {
+        (void)password;
+        ssid = networkSsid ? networkSsid : "";
+        currentStatus = WL_CONNECTED;
+        return currentStatus;
+    }
+    bool disconnect(bool wifiOff = false)
+    {
+        (void)wifiOff;
+        currentStatus = WL_DISCONNECTED;
+        return true;
+    }
+    bool reconnect()
+    {
+        currentStatus = WL_CONNECTED;
+        return true;
+    }
+    void persistent(bool persistent) { (void)persistent; }
+    bool mode(wifi_mode_t mode)
+    {
+        (void)mode;
+        return true;
+    }
+    bool setSleep(bool enabled)
+    {
+        (void)enabled;
+        return true;
+    }
+    bool setTxPower(wifi_power_t power)
+    {
+        (void)power;
+        return true;
+    }
+    IPAddress localIP() const { return IPAddress(127, 0, 0, 1); }
+    String SSID() const { return ssid; }
+    int8_t RSSI() const { return -50; }
+};
+
+extern WiFiClass WiFi;
+
+#endif
@@ -0,0 +1,44 @@
+// WiFiClient.h
+#ifndef NATIVE_SIM_WIFI_CLIENT_H
+#define NATIVE_SIM_WIFI_CLIENT_H
+
+#include "Arduino.h"
+#include <memory>
+
+// TCP connection on a host socket. Only the server side is used in the
+// simulation (WebServer::client()); device traffic goes through
+// AsyncHttpClient, which talks to the sockets directly.
+// As on the ESP32, copies share the socket: stop() lets go of this copy and
+// the socket closes with the last one, so a handler can keep a connection
+// (server-sent events) after the server has stopped its own copy.
+class WiFiClient : public Stream
+{
+private:
+    struct Socket
+    {
+        int fd;
+        explicit Socket(int socketFd) : fd(socketFd) {}
+        ~Socket();
+    };
+    std::shared_ptr<Socket> socket;
+
+public:
+    WiFiClient() {}
+    explicit WiFiClient(int socketFd) : socket(std::make_shared<Socket>(socketFd)) {}
+
+    uint8_t connected();
+    operator bool() { return socket != nullptr; }
+    void stop() { socket.reset(); }
+    void setNoDelay(bool noDelay);
+    void setTimeout(uint32_t seconds) { Stream::setTimeout(seconds * 1000); }
+    int fd() const { return socket ? socket->fd : -1; }
+
+    using Print::write;
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t *buffer, size_t size) override;
+    int available() override;
+    int read() override;
+    int peek() override;
+};
+
+#endif
@@ -0,0 +1,22 @@
+// Wire.h
+#ifndef NATIVE_SIM_WIRE_H
+#define NATIVE_SIM_WIRE_H
+
+#include "Arduino.h"
+
+class TwoWire
+{
+public:
+    bool begin() { return true; }
+    bool begin(int sda, int scl, uint32_t frequency = 0)
+    {
+        (void)sda;
+        (void)scl;
+        (void)frequency;
+        return true;
+    }
+};
+
+extern TwoWire Wire;
+
+#endif
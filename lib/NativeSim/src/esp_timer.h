@@ -0,0 +1,10 @@
+// esp_timer.h
+#ifndef NATIVE_SIM_ESP_TIMER_H
+#define NATIVE_SIM_ESP_TIMER_H
+
+#include <stdint.h>
+
+// Microseconds since boot, 64-bit so it never wraps
+int64_t esp_timer_get_time();
+
+#endif
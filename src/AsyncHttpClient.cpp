@@ -0,0 +1,451 @@
+// AsyncHttpClient.cpp
+#include "AsyncHttpClient.h"
+
+#include <errno.h>
+#include <fcntl.h>
+#if defined(ESP32)
+#include <lwip/sockets.h>
+#include <lwip/inet.h>
+#else
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <strings.h>
+#include <sys/select.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+AsyncHttpClient::AsyncHttpClient(const char *ip, uint16_t port, size_t bufferSize)
+    : address(0),
+      port(port),
+      sock(-1),
+      poolHost(-1),
+      reusedConnection(false),
+      serverCloses(false),
+      state(IDLE),
+      error(ERR_NONE),
+      requestStart(0),
+      phaseStart(0),
+      buffer(nullptr),
+      bufferSize(bufferSize),
+      response(nullptr),
+      responseSize(0),
+      requestLength(0),
+      requestSent(0),
+      responseLength(0),
+      headerLength(0),
+      contentLength(-1),
+      chunked(false),
+      statusCode(0)
+{
+    strncpy(host, ip, sizeof(host) - 1);
+    host[sizeof(host) - 1] = '\0';
+    reset();
+    if (bufferSize > HttpBufferPool::LARGE_SIZE)
+    {
+        Serial.printf("HTTP > %s > No buffer holds %u bytes\n", host, (unsigned)bufferSize);
+    }
+
+    // "ip:port" overrides the port, used by the native simulation build
+    char addressText[sizeof(host)];
+    strcpy(addressText, host);
+    char *colon = strchr(addressText, ':');
+    if (colon)
+    {
+        *colon = '\0';
+        this->port = (uint16_t)atoi(colon + 1);
+    }
+
+    struct in_addr addr;
+    if (inet_pton(AF_INET, addressText, &addr) == 1)
+    {
+        address = addr.s_addr;
+        poolHost = httpPool.addHost(host, address, this->port);
+    }
+    else
+    {
+        Serial.printf("HTTP > %s > Invalid IPv4 address\n", host);
+    }
+}
+
+AsyncHttpClient::~AsyncHttpClient()
+{
+    reset();
+}
+
+const char *AsyncHttpClient::getErrorString() const
+{
+    switch (error)
+    {
+    case ERR_NONE:
+        return "none";
+    case ERR_SOCKET:
+        return "socket";
+    case ERR_CONNECT:
+        return "connect refused";
+    case ERR_CONNECT_TIMEOUT:
+        return "connect timeout";
+    case ERR_SEND:
+        return "send";
+    case ERR_SEND_TIMEOUT:
+        return "send timeout";
+    case ERR_RECEIVE:
+        return "receive";
+    case ERR_RECEIVE_TIMEOUT:
+        return "receive timeout";
+    case ERR_OVERFLOW:
+        return "buffer overflow";
+    case ERR_BAD_RESPONSE:
+        return "bad response";
+    }
+    return "unknown";
+}
+
+void AsyncHttpClient::enterPhase(State next)
+{
+    state = next;
+    phaseStart = monoNow();
+}
+
+void AsyncHttpClient::fail(Error reason)
+{
+    closeSocket();
+    httpPool.recordFailure(poolHost);
+    error = reason;
+    state = FAILED;
+}
+
+void AsyncHttpClient::closeSocket()
+{
+    if (sock >= 0)
+    {
+        close(sock);
+        sock = -1;
+    }
+}
+
+void AsyncHttpClient::reset()
+{
+    closeSocket();
+    state = IDLE;
+    error = ERR_NONE;
+    requestLength = 0;
+    requestSent = 0;
+    responseLength = 0;
+    headerLength = 0;
+    contentLength = -1;
+    chunked = false;
+    statusCode = 0;
+    reusedConnection = false;
+    serverCloses = false;
+
+    static char noResponse[1] = "";
+    httpBuffers.release(buffer);
+    buffer = nullptr;
+    response = noResponse;
+    responseSize = 0;
+}
+
+bool AsyncHttpClient::start(const char *method, const char *path, const char *body)
+{
+    if (isBusy())
+        return false;
+
+    reset();
+    buffer = httpBuffers.acquire(bufferSize);
+    if (!buffer)
+        return false;
+    response = buffer->response;
+    responseSize = buffer->responseSize;
+    requestStart = monoNow();
+
+    char *request = buffer->request;
+    int length;
+    if (body)
+    {
+        length = snprintf(request, REQUEST_SIZE,
+                          "%s %s HTTP/1.1\r\nHost: %s\r\nConnection: keep-alive\r\n"
+                          "Content-Type: application/json\r\nContent-Length: %u\r\n\r\n%s",
+                          method, path, host, (unsigned)strlen(body), body);
+    }
+    else
+    {
+        length = snprintf(request, REQUEST_SIZE,
+                          "%s %s HTTP/1.1\r\nHost: %s\r\nConnection: keep-alive\r\n\r\n",
+                          method, path, host);
+    }
+    if (length < 0 || (size_t)length >= REQUEST_SIZE)
+    {
+        fail(ERR_OVERFLOW);
+        return true;
+    }
+    requestLength = length;
+
+    if (address == 0)
+    {
+        fail(ERR_SOCKET);
+        return true;
+    }
+
+    sock = httpPool.acquire(poolHost);
+    if (sock >= 0)
+    {
+        reusedConnection = true;
+        enterPhase(SENDING);
+        return true;
+    }
+    openConnection();
+    return true;
+}
+
+void AsyncHttpClient::openConnection()
+{
+    sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+    if (sock < 0)
+    {
+        fail(ERR_SOCKET);
+        return;
+    }
+    httpPool.recordConnect(poolHost);
+    fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK);
+
+    struct sockaddr_in target;
+    memset(&target, 0, sizeof(target));
+    target.sin_family = AF_INET;
+    target.sin_port = htons(port);
+    target.sin_addr.s_addr = address;
+
+    enterPhase(CONNECTING);
+    if (connect(sock, (struct sockaddr *)&target, sizeof(target)) == 0)
+    {
+        enterPhase(SENDING); // Loopback can connect immediately
+    }
+    else if (errno != EINPROGRESS)
+    {
+        fail(ERR_CONNECT);
+    }
+}
+
+// A kept connection the device closed while it sat in the pool shows up as
+// a failed send or an empty read. Start over once on a new connection.
+bool AsyncHttpClient::retryOnNewConnection()
+{
+    if (!reusedConnection || responseLength > 0)
+        return false;
+    closeSocket();
+    reusedConnection = false;
+    requestSent = 0;
+    httpPool.recordReconnect(poolHost);
+    openConnection();
+    return true;
+}
+
+AsyncHttpClient::State AsyncHttpClient::poll()
+{
+    // A phase that completes falls straight through to the next one
+    if (state == CONNECTING)
+        stepConnect();
+    if (state == SENDING)
+        stepSend();
+    if (state == RECEIVING)
+        stepReceive();
+    return state;
+}
+
+void AsyncHttpClient::stepConnect()
+{
+    fd_set writable;
+    FD_ZERO(&writable);
+    FD_SET(sock, &writable);
+    struct timeval noWait = {0, 0};
+
+    int ready = select(sock + 1, nullptr, &writable, nullptr, &noWait);
+    if (ready > 0)
+    {
+        int socketError = 0;
+        socklen_t length = sizeof(socketError);
+        getsockopt(sock, SOL_SOCKET, SO_ERROR, &socketError, &length);
+        if (socketError != 0)
+        {
+            fail(ERR_CONNECT);
+            return;
+        }
+        enterPhase(SENDING);
+    }
+    else if (ready < 0)
+    {
+        fail(ERR_CONNECT);
+    }
+    else if (monoNow() - phaseStart >= CONNECT_TIMEOUT)
+    {
+        fail(ERR_CONNECT_TIMEOUT);
+    }
+}
+
+void AsyncHttpClient::stepSend()
+{
+    while (requestSent < requestLength)
+    {
+        ssize_t sent = send(sock, buffer->request + requestSent, requestLength - requestSent, MSG_NOSIGNAL);
+        if (sent > 0)
+        {
+            requestSent += sent;
+            continue;
+        }
+        if (sent < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+        {
+            if (monoNow() - phaseStart >= SEND_TIMEOUT)
+                fail(ERR_SEND_TIMEOUT);
+            return;
+        }
+        if (!retryOnNewConnection())
+            fail(ERR_SEND);
+        return;
+    }
+    enterPhase(RECEIVING);
+}
+
+void AsyncHttpClient::stepReceive()
+{
+    while (true)
+    {
+        size_t space = responseSize - 1 - responseLength; // Keep room for the terminator
+        if (space == 0)
+        {
+            fail(ERR_OVERFLOW);
+            return;
+        }
+
+        ssize_t received = recv(sock, response + responseLength, space, 0);
+        if (received > 0)
+        {
+            responseLength += received;
+            response[responseLength] = '\0';
+            if (headerLength == 0 && !parseHeaders())
+                return;
+            if (responseComplete())
+            {
+                finish();
+                return;
+            }
+            continue;
+        }
+
+        if (received == 0)
+        {
+            if (retryOnNewConnection())
+                return;
+            // Server closed the connection: that is the end of the response
+            if (headerLength == 0 || (contentLength >= 0 && getBodyLength() < (size_t)contentLength))
+            {
+                fail(headerLength == 0 ? ERR_BAD_RESPONSE : ERR_RECEIVE);
+                return;
+            }
+            finish();
+            return;
+        }
+
+        if (errno == EAGAIN || errno == EWOULDBLOCK)
+        {
+            if (monoNow() - phaseStart >= RECEIVE_TIMEOUT)
+                fail(ERR_RECEIVE_TIMEOUT);
+            return;
+        }
+        if (!retryOnNewConnection())
+            fail(ERR_RECEIVE);
+        return;
+    }
+}
+
+// Returns false when the response is malformed (request has failed)
+bool AsyncHttpClient::parseHeaders()
+{
+    char *end = strstr(response, "\r\n\r\n");
+    if (!end)
+        return true; // Not all headers received yet
+
+    if (strncmp(response, "HTTP/1.", 7) != 0)
+    {
+        fail(ERR_BAD_RESPONSE);
+        return false;
+    }
+    headerLength = end + 4 - response;
+    statusCode = atoi(response + 9);
+
+    const char *line = strstr(response, "\r\n") + 2;
+    while (line < end)
+    {
+        if (strncasecmp(line, "Content-Length:", 15) == 0)
+        {
+            contentLength = atol(line + 15);
+        }
+        else if (strncasecmp(line, "Transfer-Encoding:", 18) == 0)
+        {
+            const char *value = strstr(line, "chunked");
+            chunked = value != nullptr && value < strstr(line, "\r\n");
+        }
+        else if (strncasecmp(line, "Connection:", 11) == 0)
+        {
+            const char *value = line + 11;
+            while (*value == ' ')
+                value++;
+            serverCloses = strncasecmp(value, "close", 5) == 0;
+        }
+        line = strstr(line, "\r\n") + 2;
+    }
+    return true;
+}
+
+bool AsyncHttpClient::responseComplete() const
+{
+    if (headerLength == 0)
+        return false;
+    if (chunked)
+        return responseLength >= headerLength + 5 &&
+               strcmp(response + responseLength - 5, "0\r\n\r\n") == 0;
+    return contentLength >= 0 && getBodyLength() >= (size_t)contentLength;
+}
+
+void AsyncHttpClient::finish()
+{
+    // Keep the connection when the response had a known end and the
+    // device did not ask to close it
+    if (!serverCloses && (contentLength >= 0 || chunked))
+    {
+        httpPool.release(poolHost, sock);
+        sock = -1;
+    }
+    else
+    {
+        closeSocket();
+    }
+    httpPool.recordRequest(poolHost, getElapsed(), reusedConnection);
+
+    if (chunked)
+    {
+        // Strip the chunk size lines in place
+        char *in = response + headerLength;
+        char *out = in;
+        char *end = response + responseLength;
+        while (in < end)
+        {
+            unsigned long chunkSize = strtoul(in, nullptr, 16);
+            char *data = strstr(in, "\r\n");
+            if (!data || chunkSize == 0)
+                break;
+            data += 2;
+            if (data + chunkSize > end)
+                break;
+            memmove(out, data, chunkSize);
+            out += chunkSize;
+            in = data + chunkSize + 2;
+        }
+        *out = '\0';
+        responseLength = out - response;
+    }
+    state = DONE;
+}
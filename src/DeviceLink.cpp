@@ -0,0 +1,187 @@
+// DeviceLink.cpp
+#include "DeviceLink.h"
+#include <WiFi.h>
+
+void DeviceLink::begin(HomeP1Device *p1Meter, HomeSocketDevice *const *devices, uint8_t count)
+{
+    if (started)
+        return;
+
+    p1 = p1Meter;
+    socketCount = count < MAX_SOCKETS ? count : MAX_SOCKETS;
+    snapshot.socketCount = socketCount;
+    for (int i = 0; i < socketCount; i++)
+    {
+        socketIntervalMs[i].store(5000, std::memory_order_relaxed);
+        sockets[i] = devices[i];
+        if (sockets[i])
+            snapshot.socketPresent |= 1UL << i;
+    }
+
+    BaseType_t result = xTaskCreatePinnedToCore(pollTaskEntry, "devices", TASK_STACK_SIZE,
+                                                this, 1, nullptr, TASK_CORE);
+    started = (result == pdPASS);
+    Serial.printf("DeviceLink > Polling task %s on core %d\n",
+                  started ? "started" : "failed to start", TASK_CORE);
+}
+
+void DeviceLink::pollTaskEntry(void *arg)
+{
+    static_cast<DeviceLink *>(arg)->pollLoop();
+}
+
+void DeviceLink::pollLoop()
+{
+    while (true)
+    {
+        if (WiFi.status() == WL_CONNECTED)
+        {
+            pollOnce();
+        }
+        vTaskDelay(pdMS_TO_TICKS(IDLE_DELAY));
+    }
+}
+
+// Every device call below is non-blocking; the devices keep their own poll
+// intervals and several requests can be in flight at the same time.
+void DeviceLink::pollOnce()
+{
+    // Commands first: switching has priority over routine reads
+    Command command;
+    while (commands.pop(command))
+    {
+        HomeSocketDevice *socket = sockets[command.socketIndex];
+        if (socket)
+        {
+            socket->setState(command.state);
+            acceptedCommands[command.socketIndex]++;
+        }
+    }
+
+    if (p1)
+        p1->setReadInterval(monoMs(p1IntervalMs.load(std::memory_order_relaxed)));
+    if (p1 && p1->update())
+    {
+        Measurement m = {};
+        m.source = Measurement::P1;
+        m.ok = p1->isConnected();
+        m.importPower = p1->getCurrentImport();
+        m.exportPower = p1->getCurrentExport();
+        m.p1Extras = p1->getExtras();
+        m.timestamp = monoNow();
+        measurements.push(m);
+    }
+
+    for (int i = 0; i < socketCount; i++)
+    {
+        if (!sockets[i])
+            continue;
+        sockets[i]->setReadInterval(monoMs(socketIntervalMs[i].load(std::memory_order_relaxed)));
+        if (sockets[i]->update())
+        {
+            publishSocket(i, sockets[i]->isConnected());
+        }
+    }
+
+    httpPool.maintain();
+}
+
+void DeviceLink::publishSocket(int index, bool ok)
+{
+    Measurement m = {};
+    m.source = Measurement::SOCKET;
+    m.index = index;
+    m.ok = ok;
+    m.state = sockets[index]->getCurrentState();
+    m.pending = sockets[index]->isCommandPending();
+    m.accepted = acceptedCommands[index];
+    m.timestamp = monoNow();
+    measurements.push(m);
+}
+
+DeviceLink::Updates DeviceLink::process()
+{
+    Updates updated;
+    Measurement m;
+    while (measurements.pop(m))
+    {
+        if (m.source == Measurement::P1)
+        {
+            snapshot.p1Connected = m.ok;
+            if (m.ok)
+            {
+                snapshot.importPower = m.importPower;
+                snapshot.exportPower = m.exportPower;
+                snapshot.p1Extras = m.p1Extras;
+                snapshot.p1UpdateTime = m.timestamp;
+            }
+            updated.p1 = true;
+        }
+        else if (m.index < socketCount)
+        {
+            uint32_t bit = 1UL << m.index;
+            snapshot.socketConnected = m.ok ? snapshot.socketConnected | bit : snapshot.socketConnected & ~bit;
+            // Read before our last command was taken, or that command is
+            // still being written: keep the requested state
+            if (m.pending || m.accepted != sentCommands[m.index])
+            {
+                snapshot.socketPending |= bit;
+            }
+            else
+            {
+                snapshot.socketPending &= ~bit;
+                snapshot.socketOn = m.state ? snapshot.socketOn | bit : snapshot.socketOn & ~bit;
+                if (m.ok)
+                    snapshot.socketKnown |= bit;
+            }
+            updated.sockets |= bit;
+        }
+    }
+
+    updated.powerChanged = snapshot.p1Connected != processed.p1Connected ||
+                           snapshot.importPower != processed.importPower ||
+                           snapshot.exportPower != processed.exportPower;
+    updated.socketsChanged = (snapshot.socketOn ^ processed.socketOn) |
+                             (snapshot.socketConnected ^ processed.socketConnected);
+    processed = snapshot;
+    return updated;
+}
+
+void DeviceLink::setPollIntervals(uint32_t p1Ms, const uint32_t *socketMs)
+{
+    p1IntervalMs.store(p1Ms, std::memory_order_relaxed);
+    for (int i = 0; i < socketCount; i++)
+    {
+        socketIntervalMs[i].store(socketMs[i], std::memory_order_relaxed);
+    }
+}
+
+bool DeviceLink::requestSocketState(int index, bool state)
+{
+    if (!hasSocket(index))
+        return false;
+
+    uint32_t bit = 1UL << index;
+    if ((snapshot.socketKnown & bit) && snapshot.isOn(index) == state)
+    {
+        coalescedCommands[index]++;
+        return true;
+    }
+
+    Command command = {(uint8_t)index, state};
+    if (!commands.push(command))
+    {
+        Serial.printf("DeviceLink > Command queue full, socket %d dropped\n", index + 1);
+        return false;
+    }
+    lastCommand[index] = monoNow();
+    sentCommands[index]++;
+    // Optimistic: the confirmed state follows once the command is verified
+    snapshot.socketKnown |= bit;
+    snapshot.socketPending |= bit;
+    if (state)
+        snapshot.socketOn |= bit;
+    else
+        snapshot.socketOn &= ~bit;
+    return true;
+}
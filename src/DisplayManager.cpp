@@ -22,7 +22,7 @@ bool DisplayManager::begin()
     return true;
 }
 
-void DisplayManager::showPowerPage(float importPower, float exportPower)
+void DisplayManager::showPowerPage(float importPower, float exportPower, float averagePower)
 {
     if (!displayFound)
         return;
@@ -41,6 +41,14 @@ void DisplayManager::showPowerPage(float importPower, float exportPower)
     display.print(exportPower, 1);
     display.println("W");
 
+    // Net power over the last 10 minutes, NAN until there is history
+    if (!isnan(averagePower))
+    {
+        display.print("Avg 10m: ");
+        display.print(averagePower, 0);
+        display.println("W");
+    }
+
     display.display();
 }
 
@@ -70,8 +78,7 @@ void DisplayManager::showEnvironmentPage(float temp, float humidity, float light
     display.display();
 }
 
-void DisplayManager::showSwitchesPage(bool switch1, bool switch2, bool switch3,
-                                      const String &sw1Time, const String &sw2Time, const String &sw3Time)
+void DisplayManager::showSwitchesPage(const SwitchStatus *switches, uint8_t count, uint8_t page, uint8_t pages)
 {
     if (!displayFound)
         return;
@@ -79,47 +86,63 @@ void DisplayManager::showSwitchesPage(bool switch1, bool switch2, bool switch3,
     display.clearDisplay();
     display.setTextSize(1);
     display.setCursor(0, 0);
-    display.println("Switches");
+    display.print("Switches");
+    if (pages > 1)
+    {
+        display.printf(" %u/%u", page + 1, pages);
+    }
+    display.println();
     display.println();
 
-    display.print("SW1: ");
-    display.println(switch1 ? "ON " + sw1Time : "OFF");
-
-    display.print("SW2: ");
-    display.println(switch2 ? "ON " + sw2Time : "OFF");
-
-    display.print("SW3: ");
-    display.println(switch3 ? "ON " + sw3Time : "OFF");
+    // 21 characters a line: 10 for the name, the rest for the state
+    char line[24];
+    uint8_t first = page * SWITCHES_PER_PAGE;
+    for (uint8_t i = first; i < count && i < first + SWITCHES_PER_PAGE; i++)
+    {
+        if (switches[i].on)
+            snprintf(line, sizeof(line), "%-10.10s ON %lus", switches[i].name, switches[i].seconds);
+        else
+            snprintf(line, sizeof(line), "%-10.10s OFF", switches[i].name);
+        display.println(line);
+    }
 
     display.display();
 }
 
-void DisplayManager::updateDisplay(float importPower, float exportPower,
+void DisplayManager::updateDisplay(float importPower, float exportPower, float averagePower,
                                    float temp, float humidity, float light,
-                                   bool sw1, bool sw2, bool sw3,
-                                   const String &sw1Time, const String &sw2Time, const String &sw3Time)
+                                   const SwitchStatus *switches, uint8_t switchCount)
 {
     if (!displayFound)
         return;
 
-    // Rotate pages every PAGE_DURATION milliseconds
-    if (millis() - lastPageChange >= PAGE_DURATION)
+    // Power, environment, then as many switch pages as there are sockets
+    uint8_t switchPages = switchCount > 0 ? (switchCount + SWITCHES_PER_PAGE - 1) / SWITCHES_PER_PAGE : 1;
+    int pageCount = 2 + switchPages;
+
+    // Rotate pages every PAGE_DURATION
+    MonoTime now = monoNow();
+    if (now - lastPageChange >= PAGE_DURATION)
+    {
+        currentPage = (currentPage + 1) % pageCount;
+        lastPageChange = now;
+    }
+    else if (currentPage >= pageCount)
     {
-        currentPage = (currentPage + 1) % 3; // Cycle through 3 pages
-        lastPageChange = millis();
+        currentPage = 0;
     }
 
     // Show current page
     switch (currentPage)
     {
     case 0:
-        showPowerPage(importPower, exportPower);
+        showPowerPage(importPower, exportPower, averagePower);
         break;
     case 1:
         showEnvironmentPage(temp, humidity, light);
         break;
-    case 2:
-        showSwitchesPage(sw1, sw2, sw3, sw1Time, sw2Time, sw3Time);
+    default:
+        showSwitchesPage(switches, switchCount, currentPage - 2, switchPages);
         break;
     }
 }
\ No newline at end of file
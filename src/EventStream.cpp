@@ -0,0 +1,138 @@
+// EventStream.cpp
+#include "EventStream.h"
+#include "TraceLog.h"
+
+#include <errno.h>
+#if defined(ESP32)
+#include <lwip/sockets.h>
+#else
+#include <sys/socket.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+// All of it or nothing usable: after a partial write the stream is out of
+// step, so false means the client has to go
+bool EventStream::sendAll(WiFiClient &client, const void *data, size_t length)
+{
+    int sock = client.fd();
+    const uint8_t *bytes = (const uint8_t *)data;
+    while (length > 0)
+    {
+        ssize_t written = send(sock, bytes, length, MSG_DONTWAIT | MSG_NOSIGNAL);
+        if (written <= 0)
+            return false;
+        bytes += written;
+        length -= written;
+    }
+    return true;
+}
+
+void EventStream::drop(uint8_t slot)
+{
+    // Still connected means it just did not keep up
+    if (clients[slot].connected())
+    {
+        slowDropped++;
+        TRACE(WEB_EVENTS_SLOW, slot);
+    }
+    else
+    {
+        TRACE(WEB_EVENTS_CLOSED, slot);
+    }
+    clients[slot].stop();
+}
+
+int EventStream::add(WiFiClient &client)
+{
+    for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+    {
+        if (clients[i] && clients[i].connected())
+            continue;
+
+        static const char headers[] = "HTTP/1.1 200 OK\r\n"
+                                      "Content-Type: text/event-stream\r\n"
+                                      "Cache-Control: no-cache\r\n"
+                                      "Connection: keep-alive\r\n"
+                                      "Access-Control-Allow-Origin: *\r\n\r\n"
+                                      "retry: 3000\n\n";
+        clients[i] = client;
+        clients[i].setNoDelay(true);
+        if (!sendAll(clients[i], headers, sizeof(headers) - 1))
+        {
+            clients[i].stop();
+            return -1;
+        }
+        TRACE(WEB_EVENTS_OPEN, i, getClientCount());
+        return i;
+    }
+    TRACE(WEB_EVENTS_FULL);
+    return -1;
+}
+
+// id, event name and data in one write; data must be a single line (JSON)
+bool EventStream::writeEvent(WiFiClient &client, uint32_t id, const char *event, const char *data, size_t length)
+{
+    char head[48];
+    int headLength = snprintf(head, sizeof(head), "id: %lu\nevent: %s\ndata: ", (unsigned long)id, event);
+    bool ok = sendAll(client, head, headLength) && sendAll(client, data, length) && sendAll(client, "\n\n", 2);
+    if (ok)
+        sent++;
+    return ok;
+}
+
+bool EventStream::sendTo(uint8_t slot, const char *event, const char *data, size_t length)
+{
+    if (slot >= MAX_CLIENTS || !clients[slot])
+        return false;
+    if (!writeEvent(clients[slot], nextId++, event, data, length))
+    {
+        drop(slot);
+        return false;
+    }
+    return true;
+}
+
+void EventStream::broadcast(const char *event, const char *data, size_t length)
+{
+    uint32_t id = nextId++;
+    for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+    {
+        if (!clients[i])
+            continue;
+        if (!writeEvent(clients[i], id, event, data, length))
+            drop(i);
+    }
+}
+
+void EventStream::ping()
+{
+    MonoTime now = monoNow();
+    if (now - lastPing < PING_INTERVAL)
+        return;
+    lastPing = now;
+
+    // Dropped here too when the tablet went to sleep without closing
+    for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+    {
+        if (clients[i] && !clients[i].connected())
+        {
+            clients[i].stop();
+            TRACE(WEB_EVENTS_CLOSED, i);
+        }
+    }
+    broadcast("ping", "{}", 2);
+}
+
+uint8_t EventStream::getClientCount()
+{
+    uint8_t count = 0;
+    for (uint8_t i = 0; i < MAX_CLIENTS; i++)
+    {
+        if (clients[i])
+            count++;
+    }
+    return count;
+}
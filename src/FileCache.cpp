@@ -0,0 +1,169 @@
+// FileCache.cpp
+#include "FileCache.h"
+
+#include <SPIFFS.h>
+#include <new>
+
+FileCache::FileCache()
+{
+    for (uint8_t i = 0; i < MAX_ENTRIES; i++)
+    {
+        entries[i].hash = 0;
+        entries[i].data = nullptr;
+        entries[i].size = 0;
+    }
+}
+
+FileCache::~FileCache()
+{
+    for (uint8_t i = 0; i < MAX_ENTRIES; i++)
+    {
+        delete[] entries[i].data;
+    }
+}
+
+// FNV-1a; 0 marks a free slot, so it is never returned
+uint32_t FileCache::hashPath(const char *path)
+{
+    uint32_t hash = 2166136261u;
+    for (const char *c = path; *c; c++)
+    {
+        hash ^= (uint8_t)*c;
+        hash *= 16777619u;
+    }
+    return hash ? hash : 1;
+}
+
+FileCache::Entry *FileCache::lookup(const char *path)
+{
+    uint32_t hash = hashPath(path);
+    for (uint8_t i = 0; i < MAX_ENTRIES; i++)
+    {
+        if (entries[i].hash == hash && strcmp(entries[i].path, path) == 0)
+            return &entries[i];
+    }
+    return nullptr;
+}
+
+void FileCache::evict(Entry &entry)
+{
+    delete[] entry.data;
+    stats.bytes -= entry.size;
+    stats.entries--;
+    entry.hash = 0;
+    entry.data = nullptr;
+    entry.size = 0;
+}
+
+size_t FileCache::getBudget() const
+{
+    // What is cached now would be free again if it were evicted
+    size_t available = ESP.getFreeHeap() + stats.bytes;
+    if (available <= HEAP_RESERVE)
+        return 0;
+    size_t budget = (available - HEAP_RESERVE) / 2;
+    if (budget > MAX_BYTES)
+        budget = MAX_BYTES;
+    // Free heap can be in pieces; a file needs one block
+    size_t largestBlock = ESP.getMaxAllocHeap();
+    if (budget > largestBlock)
+        budget = largestBlock;
+    return budget;
+}
+
+const FileCache::Entry *FileCache::find(const char *path)
+{
+    Entry *entry = lookup(path);
+    if (!entry)
+    {
+        stats.misses++;
+        return nullptr;
+    }
+    stats.hits++;
+    entry->lastUsed = ++useCounter;
+    return entry;
+}
+
+const FileCache::Entry *FileCache::add(const char *path, File &file)
+{
+    size_t size = file.size();
+    size_t budget = getBudget();
+    if (size == 0 || size > budget || strlen(path) >= MAX_PATH)
+    {
+        stats.skipped++;
+        return nullptr;
+    }
+
+    // Read before anything is evicted, so a failure leaves the cache as it
+    // was. Arduino-ESP32 has exceptions on, a plain new would abort.
+    uint8_t *data = new (std::nothrow) uint8_t[size];
+    if (!data || file.read(data, size) != size)
+    {
+        delete[] data;
+        stats.skipped++;
+        return nullptr;
+    }
+    remove(path);
+
+    // Least recently used out until there is a slot and room for it
+    Entry *slot = nullptr;
+    while (true)
+    {
+        Entry *oldest = nullptr;
+        slot = nullptr;
+        for (uint8_t i = 0; i < MAX_ENTRIES; i++)
+        {
+            if (entries[i].hash == 0)
+                slot = &entries[i];
+            else if (!oldest || entries[i].lastUsed < oldest->lastUsed)
+                oldest = &entries[i];
+        }
+        if (slot && stats.bytes + size <= budget)
+            break;
+        evict(*oldest);
+        stats.evictions++;
+    }
+
+    slot->data = data;
+    slot->hash = hashPath(path);
+    strcpy(slot->path, path);
+    slot->size = size;
+    slot->lastUsed = ++useCounter;
+    stats.bytes += size;
+    stats.entries++;
+    return slot;
+}
+
+void FileCache::remove(const char *path)
+{
+    Entry *entry = lookup(path);
+    if (entry)
+        evict(*entry);
+}
+
+uint8_t FileCache::preload(const char *manifest)
+{
+    File list = SPIFFS.open(manifest, "r");
+    if (!list)
+        return 0;
+
+    uint8_t loaded = 0;
+    while (list.available())
+    {
+        String path = list.readStringUntil('\n');
+        path.trim();
+        if (path.length() == 0 || path[0] == '#')
+            continue;
+
+        File file = SPIFFS.open(path, "r");
+        if (file && add(path.c_str(), file))
+            loaded++;
+        else
+            Serial.printf("Web > Cache > Could not preload %s\n", path.c_str());
+        file.close();
+    }
+    list.close();
+    Serial.printf("Web > Cache > Preloaded %u files, %lu of %lu bytes\n",
+                  loaded, (unsigned long)stats.bytes, (unsigned long)getBudget());
+    return loaded;
+}
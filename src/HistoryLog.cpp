@@ -0,0 +1,219 @@
+// HistoryLog.cpp
+#include "HistoryLog.h"
+#include <time.h>
+
+static const time_t MIN_VALID_EPOCH = 1577836800; // 2020-01-01, anything older is an unset clock
+
+void HistoryLog::slotPath(uint8_t slot, char *path, size_t size)
+{
+    snprintf(path, size, "/log/%u.bin", (unsigned)slot);
+}
+
+bool HistoryLog::readHeader(uint8_t slot, HistorySegmentHeader &header)
+{
+    char path[24];
+    slotPath(slot, path, sizeof(path));
+    if (!SPIFFS.exists(path))
+        return false;
+
+    File file = SPIFFS.open(path, "r");
+    if (!file)
+        return false;
+    bool ok = file.read((uint8_t *)&header, sizeof(header)) == sizeof(header) && historyValid(header);
+    file.close();
+    return ok;
+}
+
+bool HistoryLog::begin()
+{
+    MonoTime start = monoNow();
+
+    // The head is the valid segment with the highest sequence
+    bool found = false;
+    HistorySegmentHeader header;
+    for (uint8_t slot = 0; slot < SEGMENT_COUNT; slot++)
+    {
+        if (readHeader(slot, header) && (!found || header.sequence > segmentSequence))
+        {
+            segmentSequence = header.sequence;
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        ready = startSegment(0);
+        Serial.printf("History > New log %s\n", ready ? "created" : "could not be created");
+        return ready;
+    }
+
+    // Only the tail of the head can be damaged by a power loss
+    char path[24];
+    slotPath(segmentSequence % SEGMENT_COUNT, path, sizeof(path));
+    File file = SPIFFS.open(path, "r");
+    size_t size = file ? file.size() : 0;
+    size_t payload = size > sizeof(HistorySegmentHeader) ? size - sizeof(HistorySegmentHeader) : 0;
+    segmentRecords = payload / sizeof(HistoryRecord);
+
+    bool clean = payload % sizeof(HistoryRecord) == 0;
+    if (clean && segmentRecords > 0)
+    {
+        HistoryRecord last;
+        file.seek(sizeof(HistorySegmentHeader) + (segmentRecords - 1) * sizeof(HistoryRecord));
+        clean = file.read((uint8_t *)&last, sizeof(last)) == sizeof(last) && historyValid(last);
+        if (clean)
+            recordSequence = last.sequence + 1;
+    }
+    file.close();
+
+    if (!clean || segmentRecords >= RECORDS_PER_SEGMENT)
+    {
+        Serial.printf("History > Segment %u %s, starting a new one\n", segmentSequence,
+                      clean ? "full" : "has a torn tail");
+        ready = startSegment(segmentSequence + 1);
+    }
+    else
+    {
+        ready = true;
+    }
+
+    Serial.printf("History > Head segment %u with %u records, recovered in %lu ms\n",
+                  segmentSequence, segmentRecords, (unsigned long)monoElapsedMs(start));
+    return ready;
+}
+
+bool HistoryLog::startSegment(uint32_t sequence)
+{
+    char path[24];
+    slotPath(sequence % SEGMENT_COUNT, path, sizeof(path));
+    if (SPIFFS.exists(path))
+        SPIFFS.remove(path); // Oldest segment, its space goes to the new one
+
+    HistorySegmentHeader header = {};
+    header.magic = HISTORY_MAGIC;
+    header.sequence = sequence;
+    header.version = HISTORY_VERSION;
+    header.recordSize = sizeof(HistoryRecord);
+    historySeal(header);
+
+    File file = SPIFFS.open(path, "w");
+    bool ok = file && file.write((const uint8_t *)&header, sizeof(header)) == sizeof(header);
+    file.close();
+    if (!ok)
+    {
+        stats.writeErrors++;
+        return false;
+    }
+
+    segmentSequence = sequence;
+    segmentRecords = 0;
+    stats.bytesWritten += sizeof(header);
+    return true;
+}
+
+void HistoryLog::append(uint8_t type, uint8_t index, int16_t v0, int16_t v1, int16_t v2)
+{
+    HistoryRecord &record = buffer[buffered];
+    time_t now = time(nullptr);
+    if (now >= MIN_VALID_EPOCH)
+    {
+        record.time = (uint32_t)now;
+        record.type = type;
+    }
+    else
+    {
+        record.time = monoUptimeSeconds();
+        record.type = type | HISTORY_TIME_UPTIME;
+    }
+    record.index = index;
+    record.sequence = recordSequence++;
+    record.value[0] = v0;
+    record.value[1] = v1;
+    record.value[2] = v2;
+    historySeal(record);
+
+    stats.recordsLogged++;
+    if (++buffered == RECORDS_PER_PAGE)
+        flush();
+}
+
+static int16_t clampInt16(float value)
+{
+    return (int16_t)constrain(lroundf(value), -32767L, 32767L);
+}
+
+void HistoryLog::logP1(float avgW, float minW, float maxW)
+{
+    append(HISTORY_P1, 0, clampInt16(avgW), clampInt16(minW), clampInt16(maxW));
+}
+
+void HistoryLog::logSocket(int index, bool state)
+{
+    append(HISTORY_SOCKET, index, state ? 1 : 0);
+}
+
+void HistoryLog::logSensors(float temperature, float humidity, float light)
+{
+    uint16_t lux = (uint16_t)constrain(lroundf(light), 0L, 65535L);
+    append(HISTORY_SENSORS, 0, clampInt16(temperature * 10), clampInt16(humidity * 10), (int16_t)lux);
+}
+
+void HistoryLog::logBoot(int resetReason)
+{
+    append(HISTORY_BOOT, 0, resetReason);
+}
+
+size_t HistoryLog::writeRecords(const HistoryRecord *records, size_t count)
+{
+    char path[24];
+    slotPath(segmentSequence % SEGMENT_COUNT, path, sizeof(path));
+    File file = SPIFFS.open(path, "a");
+    size_t bytes = count * sizeof(HistoryRecord);
+    size_t written = file ? file.write((const uint8_t *)records, bytes) : 0;
+    file.close();
+
+    stats.bytesWritten += written;
+    if (written != bytes)
+        stats.writeErrors++;
+    return written / sizeof(HistoryRecord);
+}
+
+void HistoryLog::flush()
+{
+    if (buffered == 0)
+        return;
+    if (!ready)
+    {
+        buffered = 0; // No log, nothing to keep the records for
+        return;
+    }
+
+    MonoTime start = monoNow();
+    size_t done = 0;
+    while (done < buffered)
+    {
+        if (segmentRecords >= RECORDS_PER_SEGMENT)
+        {
+            if (!startSegment(segmentSequence + 1))
+                break;
+            stats.rotations++;
+        }
+
+        size_t chunk = min(buffered - done, (size_t)(RECORDS_PER_SEGMENT - segmentRecords));
+        size_t written = writeRecords(buffer + done, chunk);
+        segmentRecords += written;
+        stats.recordsWritten += written;
+        done += written;
+        if (written != chunk)
+        {
+            // A partial record leaves a torn tail, move on to a clean segment
+            startSegment(segmentSequence + 1);
+            break;
+        }
+    }
+
+    buffered = 0;
+    stats.flushes++;
+    stats.lastFlushTime = monoElapsedMs(start);
+    stats.maxFlushTime = max(stats.maxFlushTime, stats.lastFlushTime);
+}
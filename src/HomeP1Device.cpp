@@ -1,7 +1,8 @@
 // HomeP1Device.cpp
 #include "HomeP1Device.h"
+#include "TraceLog.h"
 
-HomeP1Device::HomeP1Device(const char *ip) : baseUrl("http://" + String(ip)),
+HomeP1Device::HomeP1Device(const char *ip) : http(ip, 80, RESPONSE_BUFFER_SIZE),
                                              lastImportPower(0),
                                              lastExportPower(0),
                                              lastReadTime(0),
@@ -12,38 +13,96 @@ HomeP1Device::HomeP1Device(const char *ip) : baseUrl("http://" + String(ip)),
 #define max(a, b) (((a) > (b)) ? (a) : (b))
 #endif
 
-void HomeP1Device::update()
+bool HomeP1Device::update()
 {
-    if (millis() - lastReadTime >= READ_INTERVAL)
+    bool completed = false;
+    AsyncHttpClient::State state = http.poll();
+
+    if (state == AsyncHttpClient::DONE)
     {
         lastReadSuccess = getPowerData(lastImportPower, lastExportPower);
-        lastReadTime = millis();
+        http.reset();
+        completed = true;
+    }
+    else if (state == AsyncHttpClient::FAILED)
+    {
+        TRACE(P1_READ_FAILED, http.getError());
+        lastReadSuccess = false;
+        http.reset();
+        completed = true;
+    }
+
+    MonoTime now = monoNow();
+    if (!http.isBusy() && now - lastReadTime >= readInterval && http.start("GET", "/api/v1/data"))
+    {
+        lastReadTime = now;
     }
+    return completed;
 }
 
-bool HomeP1Device::getPowerData(float &importPower, float &exportPower)
+// Only the fields we read survive the filter, so the document holds just
+// FIELD_COUNT values whatever else the meter adds to its response.
+const JsonDocument &HomeP1Device::fieldFilter()
 {
-    http.begin(client, baseUrl + "/api/v1/data");
-    int httpCode = http.GET();
+    static StaticJsonDocument<JSON_OBJECT_SIZE(FIELD_COUNT)> filter;
+    if (filter.isNull())
+    {
+        filter["active_power_w"] = true;
+#if P1_PHASE_POWER
+        filter["active_power_l1_w"] = true;
+        filter["active_power_l2_w"] = true;
+        filter["active_power_l3_w"] = true;
+#endif
+#if P1_VOLTAGE
+        filter["active_voltage_l1_v"] = true;
+        filter["active_voltage_l2_v"] = true;
+        filter["active_voltage_l3_v"] = true;
+#endif
+#if P1_TOTALS
+        filter["total_power_import_kwh"] = true;
+        filter["total_power_export_kwh"] = true;
+#endif
+    }
+    return filter;
+}
 
-    if (httpCode == HTTP_CODE_OK)
+bool HomeP1Device::getPowerData(float &importPower, float &exportPower)
+{
+    if (http.getStatusCode() != 200)
     {
-        String payload = http.getString();
-        StaticJsonDocument<2048> doc;
-        DeserializationError error = deserializeJson(doc, payload);
+        return false;
+    }
+
+    // Parsed in place from the receive buffer: no copy, and the keys the
+    // filter drops are never stored
+    StaticJsonDocument<JSON_OBJECT_SIZE(FIELD_COUNT)> doc;
+    DeserializationError error = deserializeJson(doc, http.getBody(), http.getBodyLength(),
+                                                 DeserializationOption::Filter(fieldFilter()));
 
-        if (!error)
-        {
-            float power = doc["active_power_w"].as<float>();
-            Serial.printf("Received P1 power data: %.2f W\n", power);
-            importPower = max(power, 0);
-            exportPower = max(-power, 0);
-            http.end();
-            return true;
-        }
+    if (error || !doc["active_power_w"].is<float>())
+    {
+        return false;
     }
-    http.end();
-    return false;
+
+    float power = doc["active_power_w"].as<float>();
+    TRACE(P1_POWER, power);
+    importPower = max(power, 0);
+    exportPower = max(-power, 0);
+#if P1_PHASE_POWER
+    lastExtras.phasePower[0] = doc["active_power_l1_w"] | 0.0f;
+    lastExtras.phasePower[1] = doc["active_power_l2_w"] | 0.0f;
+    lastExtras.phasePower[2] = doc["active_power_l3_w"] | 0.0f;
+#endif
+#if P1_VOLTAGE
+    lastExtras.voltage[0] = doc["active_voltage_l1_v"] | 0.0f;
+    lastExtras.voltage[1] = doc["active_voltage_l2_v"] | 0.0f;
+    lastExtras.voltage[2] = doc["active_voltage_l3_v"] | 0.0f;
+#endif
+#if P1_TOTALS
+    lastExtras.totalImportKwh = doc["total_power_import_kwh"] | 0.0;
+    lastExtras.totalExportKwh = doc["total_power_export_kwh"] | 0.0;
+#endif
+    return true;
 }
 
 float HomeP1Device::getCurrentImport() const
@@ -1,198 +1,255 @@
 #include "HomeSocketDevice.h"
-
-HomeSocketDevice::HomeSocketDevice(const char *ip) : baseUrl("http://" + String(ip)),
-                                                     lastKnownState(false),
-                                                     lastReadTime(0),
-                                                     lastReadSuccess(false),
-                                                     consecutiveFailures(0),
-                                                     deviceIP(ip),
-                                                     lastLogTime(0)
+#include "TraceLog.h"
+
+HomeSocketDevice::HomeSocketDevice(uint8_t number, const char *ip) : http(ip, 80, RESPONSE_BUFFER_SIZE),
+                                                                     number(number),
+                                                                     lastKnownState(false),
+                                                                     stateKnown(false),
+                                                                     lastReadTime(0),
+                                                                     lastReadSuccess(false),
+                                                                     consecutiveFailures(0),
+                                                                     hasDesired(false),
+                                                                     desiredState(false),
+                                                                     writeNeeded(false),
+                                                                     verifyNeeded(false),
+                                                                     writeAttempts(0),
+                                                                     commandStart(0),
+                                                                     inFlight(REQUEST_NONE),
+                                                                     inFlightState(false),
+                                                                     lastLogTime(0),
+                                                                     offlineLogged(false)
 {
     Serial.printf("Initializing socket device at IP: %s\n", ip);
 }
 
-void HomeSocketDevice::update()
+bool HomeSocketDevice::update()
 {
-    unsigned long currentTime = millis();
+    bool completed = false;
+    AsyncHttpClient::State state = http.poll();
 
-    // Only try updating if enough time has passed since last attempt
-    if (currentTime - lastReadTime < READ_INTERVAL)
+    if (state == AsyncHttpClient::DONE || state == AsyncHttpClient::FAILED)
     {
-        return;
+        bool httpOk = (state == AsyncHttpClient::DONE && http.getStatusCode() == 200);
+        if (state == AsyncHttpClient::FAILED)
+        {
+            if (inFlight == REQUEST_WRITE)
+                TRACE(SOCKET_PUT_FAILED, number, http.getError());
+            else
+                TRACE(SOCKET_GET_FAILED, number, http.getError());
+        }
+        bool success = handleResponse(httpOk);
+        recordResult(success);
+        // A successful PUT tells nothing about the state yet, the verify GET does
+        completed = !success || inFlight != REQUEST_WRITE;
+        http.reset();
+        inFlight = REQUEST_NONE;
+    }
+
+    if (http.isBusy())
+    {
+        return completed;
     }
 
     // Calculate backoff time based on failures (max 60 seconds)
-    unsigned long backoffTime = min(consecutiveFailures * 5000UL, 60000UL);
-    if (currentTime - lastReadTime < backoffTime)
+    MonoTime backoffTime = monoMs(min(consecutiveFailures * 5000UL, 60000UL));
+    MonoTime currentTime = monoNow();
+    bool backedOff = currentTime - lastReadTime >= backoffTime;
+
+    // Commands go first, they don't wait for the poll interval
+    // start() only fails when no buffer is free, retried on the next pass
+    if (writeNeeded && backedOff &&
+        http.start("PUT", "/api/v1/state", desiredState ? "{\"power_on\":true}" : "{\"power_on\":false}"))
     {
-        return;
+        inFlight = REQUEST_WRITE;
+        inFlightState = desiredState;
+        writeNeeded = false;
+        writeAttempts++;
+        stats.writes++;
+        lastReadTime = currentTime;
+        return completed;
     }
 
-    // Regular status check
-    if (!getState())
+    if (verifyNeeded && backedOff && http.start("GET", "/api/v1/state"))
     {
-        consecutiveFailures++;
-        if (currentTime - lastLogTime >= 30000)
-        {
-            Serial.printf("PowerSocket > %s > Status > Offline (retry in %lu sec)\n",
-                          deviceIP.c_str(),
-                          backoffTime / 1000);
-            lastLogTime = currentTime;
-        }
+        inFlight = REQUEST_VERIFY;
+        verifyNeeded = false;
+        lastReadTime = currentTime;
+        return completed;
     }
-    else
+
+    if (!verifyNeeded && currentTime - lastReadTime >= max(readInterval, backoffTime) &&
+        http.start("GET", "/api/v1/state"))
+    {
+        inFlight = REQUEST_READ;
+        lastReadTime = currentTime;
+    }
+    return completed;
+}
+
+bool HomeSocketDevice::handleResponse(bool httpOk)
+{
+    if (inFlight == REQUEST_WRITE)
     {
-        if (consecutiveFailures > 0)
+        if (!httpOk)
         {
-            Serial.printf("PowerSocket > %s > Status > Back online\n", deviceIP.c_str());
-            lastLogTime = currentTime;
+            if (http.getState() == AsyncHttpClient::DONE) // Else traced as failed
+                TRACE(SOCKET_PUT_HTTP_ERROR, number, http.getStatusCode());
+            // Sent again after the backoff, unless it has been tried enough
+            if (writeAttempts >= MAX_WRITE_ATTEMPTS)
+                abandonCommand(true);
+            else if (inFlightState == desiredState)
+                writeNeeded = true;
+            return false;
         }
-        consecutiveFailures = 0;
+        TRACE(SOCKET_PUT, number, inFlightState);
+        // Changed its mind while this PUT was out: the new state is written
+        // next, there is nothing to verify until then
+        if (hasDesired && !writeNeeded)
+            verifyNeeded = true;
+        return true;
     }
 
-    lastReadTime = currentTime;
-}
+    if (!httpOk)
+    {
+        if (http.getState() == AsyncHttpClient::DONE)
+            TRACE(SOCKET_GET_HTTP_ERROR, number, http.getStatusCode());
+        lastReadSuccess = false;
+        if (inFlight == REQUEST_VERIFY)
+            verifyNeeded = true;
+        return false;
+    }
 
-bool HomeSocketDevice::makeHttpRequest(const String &endpoint, const String &method, const String &payload, String &response)
-{
-    if (WiFi.status() != WL_CONNECTED)
+    if (!parseState())
     {
+        if (inFlight == REQUEST_VERIFY)
+            verifyNeeded = true;
         return false;
     }
 
-    WiFiClient newClient;
-    HTTPClient http;
-    newClient.setTimeout(5000);
+    if (inFlight == REQUEST_VERIFY)
+        checkConfirmation();
+    return true;
+}
 
-    String fullUrl = baseUrl + "/api/v1/state";
+bool HomeSocketDevice::parseState()
+{
+    StaticJsonDocument<1024> doc;
+    DeserializationError error = deserializeJson(doc, http.getBody(), http.getBodyLength());
 
-    if (!http.begin(newClient, fullUrl))
+    if (error)
     {
+        TRACE(SOCKET_JSON_ERROR, number);
+        lastReadSuccess = false;
         return false;
     }
 
-    http.setTimeout(5000);
-    http.setReuse(false);
+    lastKnownState = doc["power_on"] | false;
+    stateKnown = true;
+    TRACE(SOCKET_STATE, number, lastKnownState);
+    lastReadSuccess = true;
+    return true;
+}
 
-    int httpCode;
-    if (method == "GET")
-    {
-        httpCode = http.GET();
-    }
-    else if (method == "PUT")
+// The GET after a PUT: done when the socket reports the desired state,
+// written again when it does not
+void HomeSocketDevice::checkConfirmation()
+{
+    if (!hasDesired || writeNeeded)
+        return;
+
+    if (lastKnownState == desiredState)
     {
-        http.addHeader("Content-Type", "application/json");
-        httpCode = http.PUT(payload);
+        uint32_t latency = monoElapsedMs(commandStart);
+        stats.confirmed++;
+        stats.lastLatencyMs = latency;
+        stats.latencySumMs += latency;
+        if (latency > stats.maxLatencyMs)
+            stats.maxLatencyMs = latency;
+        hasDesired = false;
+        TRACE(SOCKET_CONFIRMED, number, desiredState, (unsigned long)latency);
+        return;
     }
 
-    bool success = (httpCode == HTTP_CODE_OK);
-    if (success)
+    stats.mismatches++;
+    if (writeAttempts >= MAX_WRITE_ATTEMPTS)
     {
-        response = http.getString();
+        abandonCommand(false);
+        return;
     }
+    TRACE(SOCKET_WRITE_AGAIN, number, lastKnownState);
+    writeNeeded = true;
+}
 
-    http.end();
-    return success;
+void HomeSocketDevice::abandonCommand(bool writeFailed)
+{
+    if (writeFailed)
+        TRACE(SOCKET_PUT_GAVE_UP, number, desiredState);
+    else
+        TRACE(SOCKET_NOT_TAKEN, number, desiredState);
+    stats.abandoned++;
+    hasDesired = false;
+    writeNeeded = false;
+    verifyNeeded = false;
 }
 
-// for raw output enable below code
-// bool HomeSocketDevice::makeHttpRequest(const String &endpoint, const String &method, const String &payload, String &response)
-// {
-//     if (WiFi.status() != WL_CONNECTED)
-//     {
-//         Serial.printf("Power socket > No WiFi\n");
-//         return false;
-//     }
-
-//     WiFiClient newClient;
-//     HTTPClient http;
-//     newClient.setTimeout(5000);
-
-//     String fullUrl = baseUrl + "/api/v1/state";
-
-//     if (!http.begin(newClient, fullUrl))
-//     {
-//         Serial.printf("Power socket > %s > Connection failed\n", fullUrl.c_str());
-//         return false;
-//     }
-
-//     http.setTimeout(5000);
-//     http.setReuse(false);
-
-//     int httpCode;
-//     if (method == "GET")
-//     {
-//         httpCode = http.GET();
-//     }
-//     else if (method == "PUT")
-//     {
-//         http.addHeader("Content-Type", "application/json");
-//         httpCode = http.PUT(payload);
-//     }
-
-//     if (httpCode == HTTP_CODE_OK)
-//     {
-//         response = http.getString();
-//         Serial.printf("Power socket > %s > %d > %s\n", fullUrl.c_str(), httpCode, response.c_str());
-//     }
-//     else if (httpCode == -1)
-//     {
-//         Serial.printf("Power socket > %s > %d > disconnected\n", fullUrl.c_str(), httpCode);
-//     }
-//     else
-//     {
-//         Serial.printf("Power socket > %s > %d > HTTP error\n", fullUrl.c_str(), httpCode);
-//     }
-
-//     http.end();
-//     return (httpCode == HTTP_CODE_OK);
-// }
-
-bool HomeSocketDevice::getState()
+void HomeSocketDevice::recordResult(bool success)
 {
-    String response;
-    if (!makeHttpRequest("/api/v1/state", "GET", "", response))
+    MonoTime currentTime = monoNow();
+
+    if (!success)
     {
-        Serial.printf("PowerSocket > %s/api/v1/state > Get > HTTP error\n", deviceIP.c_str());
-        lastReadSuccess = false;
-        return false;
+        consecutiveFailures++;
+        if (currentTime - lastLogTime >= 30 * MONO_SECOND)
+        {
+            TRACE(SOCKET_OFFLINE, number, min(consecutiveFailures * 5000UL, 60000UL) / 1000);
+            lastLogTime = currentTime;
+            offlineLogged = true;
+        }
     }
-
-    StaticJsonDocument<1024> doc;
-    DeserializationError error = deserializeJson(doc, response);
-
-    if (error)
+    else
     {
-        Serial.printf("PowerSocket > %s/api/v1/state > Get > JSON error\n", deviceIP.c_str());
-        lastReadSuccess = false;
-        return false;
+        if (offlineLogged)
+        {
+            TRACE(SOCKET_ONLINE, number);
+            lastLogTime = currentTime;
+            offlineLogged = false;
+        }
+        consecutiveFailures = 0;
     }
-
-    lastKnownState = doc["power_on"] | false;
-    Serial.printf("PowerSocket > %s/api/v1/state > Get > is %s\n",
-                  deviceIP.c_str(),
-                  lastKnownState ? "on" : "off");
-    lastReadSuccess = true;
-    return true;
 }
 
 bool HomeSocketDevice::setState(bool state)
 {
-    StaticJsonDocument<200> doc;
-    doc["power_on"] = state;
-    String jsonString;
-    serializeJson(doc, jsonString);
+    stats.commands++;
 
-    String response;
-    if (!makeHttpRequest("/api/v1/state", "PUT", jsonString, response))
+    // Already on its way
+    if (hasDesired && desiredState == state)
     {
-        Serial.printf("PowerSocket > %s/api/v1/state > Put > HTTP error\n", deviceIP.c_str());
-        return false;
+        stats.coalesced++;
+        return true;
     }
 
-    lastKnownState = state;
-    Serial.printf("PowerSocket > %s/api/v1/state > Put > turn %s\n",
-                  deviceIP.c_str(),
-                  state ? "on" : "off");
+    // Already the confirmed state and nothing written since: drop the
+    // command, and any earlier one that has not gone out yet
+    if (inFlight != REQUEST_WRITE && !verifyNeeded && stateKnown && lastKnownState == state)
+    {
+        if (hasDesired && writeAttempts == 0)
+        {
+            hasDesired = false;
+            writeNeeded = false;
+        }
+        if (!hasDesired)
+        {
+            stats.coalesced++;
+            return true;
+        }
+    }
+
+    desiredState = state;
+    hasDesired = true;
+    writeNeeded = true;
+    verifyNeeded = false;
+    writeAttempts = 0;
+    commandStart = monoNow();
     return true;
-}
\ No newline at end of file
+}
@@ -0,0 +1,49 @@
+// HttpBufferPool.cpp
+#include "HttpBufferPool.h"
+
+HttpBufferPool::HttpBufferPool()
+{
+    for (uint8_t i = 0; i < COUNT; i++)
+    {
+        bool small = i < SMALL_COUNT;
+        buffers[i].response = small ? smallResponses[i] : largeResponses[i - SMALL_COUNT];
+        buffers[i].responseSize = small ? SMALL_SIZE : LARGE_SIZE;
+        buffers[i].inUse = false;
+    }
+}
+
+HttpBufferPool::Buffer *HttpBufferPool::acquire(size_t responseSize)
+{
+    for (uint8_t i = 0; i < COUNT; i++)
+    {
+        Buffer &buffer = buffers[i];
+        if (buffer.inUse || buffer.responseSize < responseSize)
+            continue;
+        buffer.inUse = true;
+        buffer.request[0] = '\0';
+        buffer.response[0] = '\0';
+        stats.acquired++;
+        stats.inUse++;
+        if (stats.inUse > stats.peakInUse)
+            stats.peakInUse = stats.inUse;
+        return &buffer;
+    }
+    stats.exhausted++;
+    return nullptr;
+}
+
+void HttpBufferPool::release(Buffer *buffer)
+{
+    if (buffer && buffer->inUse)
+    {
+        buffer->inUse = false;
+        stats.inUse--;
+    }
+}
+
+void HttpBufferPool::printReport() const
+{
+    Serial.printf("HTTP > buffers > %u of %u in use (peak %u), %lu requests, %lu postponed (none free)\n",
+                  stats.inUse, COUNT, stats.peakInUse,
+                  (unsigned long)stats.acquired, (unsigned long)stats.exhausted);
+}
@@ -0,0 +1,190 @@
+// HttpConnectionPool.cpp
+#include "HttpConnectionPool.h"
+#include "SocketRegistry.h"
+
+#include <errno.h>
+#if defined(ESP32)
+#include <lwip/sockets.h>
+#else
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+static_assert(HttpConnectionPool::MAX_HOSTS == SocketRegistry::MAX_SOCKETS + 1,
+              "A pool host for the P1 meter and every socket");
+
+static const MonoTime MINUTE = 60 * MONO_SECOND;
+static const uint32_t LATENCY_BOUNDS_MS[] = {5, 10, 25, 50, 100, 250, 500, 1000, 2500};
+
+HttpConnectionPool::HttpConnectionPool()
+{
+    for (uint8_t i = 0; i < MAX_HOSTS; i++)
+    {
+        hosts[i].latency.init(LATENCY_BOUNDS_MS, sizeof(LATENCY_BOUNDS_MS) / sizeof(LATENCY_BOUNDS_MS[0]));
+        hosts[i].idle = -1;
+    }
+}
+
+int HttpConnectionPool::addHost(const char *name, uint32_t address, uint16_t port)
+{
+    for (uint8_t i = 0; i < hostCount; i++)
+    {
+        if (hosts[i].address == address && hosts[i].port == port)
+            return i;
+    }
+    if (hostCount >= MAX_HOSTS)
+        return -1;
+
+    Host &host = hosts[hostCount];
+    host.minuteLatencyMaxMs = 0;
+    strncpy(host.name, name, sizeof(host.name) - 1);
+    host.name[sizeof(host.name) - 1] = '\0';
+    host.address = address;
+    host.port = port;
+    return hostCount++;
+}
+
+// An idle keep-alive connection has nothing to read; end of stream or
+// stray bytes mean the device closed it or it is out of step
+bool HttpConnectionPool::isAlive(int sock)
+{
+    char byte;
+    ssize_t received = recv(sock, &byte, 1, MSG_PEEK);
+    return received < 0 && (errno == EAGAIN || errno == EWOULDBLOCK);
+}
+
+void HttpConnectionPool::closeConnection(int sock)
+{
+    close(sock);
+}
+
+void HttpConnectionPool::closeIdle(Host &entry)
+{
+    closeConnection(entry.idle);
+    entry.idle = -1;
+    idleCount--;
+}
+
+int HttpConnectionPool::acquire(int host)
+{
+    if (host < 0)
+        return -1;
+
+    Host &entry = hosts[host];
+    if (entry.idle < 0)
+        return -1;
+    if (monoNow() - entry.idleSince >= IDLE_TIMEOUT || !isAlive(entry.idle))
+    {
+        closeIdle(entry);
+        return -1;
+    }
+    int sock = entry.idle;
+    entry.idle = -1;
+    idleCount--;
+    return sock;
+}
+
+void HttpConnectionPool::release(int host, int sock)
+{
+    if (host < 0)
+    {
+        closeConnection(sock);
+        return;
+    }
+
+    Host &entry = hosts[host];
+    if (entry.idle >= 0)
+        closeIdle(entry);
+    if (idleCount >= MAX_IDLE)
+    {
+        Host *oldest = nullptr;
+        for (uint8_t i = 0; i < hostCount; i++)
+        {
+            if (hosts[i].idle >= 0 && (!oldest || hosts[i].idleSince < oldest->idleSince))
+                oldest = &hosts[i];
+        }
+        closeIdle(*oldest);
+    }
+    entry.idle = sock;
+    entry.idleSince = monoNow();
+    idleCount++;
+}
+
+void HttpConnectionPool::recordConnect(int host)
+{
+    if (host >= 0)
+        hosts[host].total.connects++;
+}
+
+void HttpConnectionPool::recordRequest(int host, uint32_t latencyMs, bool reused)
+{
+    if (host < 0)
+        return;
+    Stats &total = hosts[host].total;
+    total.requests++;
+    if (reused)
+        total.reused++;
+    total.latencySumMs += latencyMs;
+    if (latencyMs > total.latencyMaxMs)
+        total.latencyMaxMs = latencyMs;
+    if (latencyMs > hosts[host].minuteLatencyMaxMs)
+        hosts[host].minuteLatencyMaxMs = latencyMs;
+    hosts[host].latency.record(latencyMs);
+}
+
+void HttpConnectionPool::recordFailure(int host)
+{
+    if (host >= 0)
+        hosts[host].total.failures++;
+}
+
+void HttpConnectionPool::recordReconnect(int host)
+{
+    if (host >= 0)
+        hosts[host].total.reconnects++;
+}
+
+void HttpConnectionPool::maintain()
+{
+    MonoTime now = monoNow();
+    for (uint8_t i = 0; i < hostCount; i++)
+    {
+        Host &entry = hosts[i];
+        if (entry.idle >= 0 && now - entry.idleSince >= IDLE_TIMEOUT)
+            closeIdle(entry);
+    }
+
+    if (minuteStart == 0)
+        minuteStart = now;
+    if (now - minuteStart < MINUTE)
+        return;
+    minuteStart = now;
+
+    for (uint8_t i = 0; i < hostCount; i++)
+    {
+        Host &entry = hosts[i];
+        MinuteStats &minute = entry.lastMinute;
+        minute.connects = entry.total.connects - entry.minuteStart.connects;
+        minute.requests = entry.total.requests - entry.minuteStart.requests;
+        minute.latencyAvgMs = minute.requests > 0
+                                  ? (entry.total.latencySumMs - entry.minuteStart.latencySumMs) / minute.requests
+                                  : 0;
+        minute.latencyMaxMs = entry.minuteLatencyMaxMs;
+        entry.minuteStart = entry.total;
+        entry.minuteLatencyMaxMs = 0;
+    }
+}
+
+void HttpConnectionPool::printReport() const
+{
+    for (uint8_t i = 0; i < hostCount; i++)
+    {
+        const Host &entry = hosts[i];
+        Serial.printf("HTTP > %s > last minute %lu connects, %lu requests, avg %lu ms, max %lu ms; "
+                      "total %lu connects for %lu requests (%lu reused, %lu failed)\n",
+                      entry.name, (unsigned long)entry.lastMinute.connects, (unsigned long)entry.lastMinute.requests,
+                      (unsigned long)entry.lastMinute.latencyAvgMs, (unsigned long)entry.lastMinute.latencyMaxMs,
+                      (unsigned long)entry.total.connects, (unsigned long)entry.total.requests,
+                      (unsigned long)entry.total.reused, (unsigned long)entry.total.failures);
+    }
+}
@@ -0,0 +1,253 @@
+// Metrics.cpp
+#include "Metrics.h"
+#include "GlobalVars.h"
+#include "HttpBufferPool.h"
+#include "FileCache.h"
+
+#include <WebServer.h>
+#include <stdarg.h>
+
+static const uint32_t LOOP_BOUNDS_US[] = {10, 50, 100, 500, 1000, 5000, 10000, 50000, 100000, 500000};
+static const uint32_t WEB_BOUNDS_US[] = {1000, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000, 2500000};
+
+void MetricsOutput::appendf(const char *format, ...)
+{
+    va_list args;
+    va_start(args, format);
+    va_list again;
+    va_copy(again, args);
+    int n = vsnprintf(buffer + length, BUFFER_SIZE - length, format, args);
+    if (n > 0 && length + (size_t)n >= BUFFER_SIZE)
+    {
+        // Did not fit: send what is there, the line again at the start
+        flush();
+        n = vsnprintf(buffer, BUFFER_SIZE, format, again);
+    }
+    va_end(again);
+    va_end(args);
+    if (n <= 0)
+        return;
+    size_t added = n;
+    if (added >= BUFFER_SIZE) // Longer than the buffer, cut
+        added = BUFFER_SIZE - 1;
+    length += added;
+}
+
+void MetricsOutput::flush()
+{
+    if (length == 0)
+        return;
+    server.sendContent(buffer, length);
+    length = 0;
+}
+
+// Starts a family, which goes out as one chunk when it fits the buffer
+static void header(MetricsOutput &out, const char *name, const char *type, const char *help)
+{
+    out.flush();
+    out.appendf("# HELP %s %s\n# TYPE %s %s\n", name, help, name, type);
+}
+
+void MetricsHistogram::write(MetricsOutput &out, const char *name, const char *labels, double scale) const
+{
+    const char *separator = labels[0] ? "," : "";
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < boundCount; i++)
+    {
+        cumulative += counts[i];
+        out.appendf("%s_bucket{%s%sle=\"%g\"} %lu\n", name, labels, separator, bounds[i] * scale,
+                    (unsigned long)cumulative);
+    }
+    out.appendf("%s_bucket{%s%sle=\"+Inf\"} %lu\n", name, labels, separator, (unsigned long)count);
+
+    // No braces at all without labels
+    char labelBlock[64] = "";
+    if (labels[0])
+        snprintf(labelBlock, sizeof(labelBlock), "{%s}", labels);
+    out.appendf("%s_sum%s %g\n", name, labelBlock, (double)sum * scale);
+    out.appendf("%s_count%s %lu\n", name, labelBlock, (unsigned long)count);
+}
+
+Metrics::Metrics()
+{
+    loopPass.init(LOOP_BOUNDS_US, sizeof(LOOP_BOUNDS_US) / sizeof(LOOP_BOUNDS_US[0]));
+    webRequest.init(WEB_BOUNDS_US, sizeof(WEB_BOUNDS_US) / sizeof(WEB_BOUNDS_US[0]));
+}
+
+int Metrics::addRoute(const char *label)
+{
+    for (uint8_t i = 0; i < routeCount; i++)
+    {
+        if (strncmp(routes[i].label, label, sizeof(routes[i].label) - 1) == 0)
+            return i;
+    }
+    if (routeCount >= MAX_ROUTES)
+        return -1;
+    Route &route = routes[routeCount];
+    strncpy(route.label, label, sizeof(route.label) - 1);
+    route.label[sizeof(route.label) - 1] = '\0';
+    route.requests = 0;
+    route.totalTime = 0;
+    return routeCount++;
+}
+
+void Metrics::recordWebRequest(int route, MonoTime elapsed)
+{
+    webRequest.record((uint32_t)elapsed);
+    if (route >= 0)
+    {
+        routes[route].requests++;
+        routes[route].totalTime += elapsed;
+    }
+}
+
+void Metrics::writeTasks(MetricsOutput &out) const
+{
+    int count = scheduler.getTaskCount();
+
+    header(out, "solar_task_runs_total", "counter", "Scheduler task runs");
+    for (int i = 0; i < count; i++)
+        out.appendf("solar_task_runs_total{task=\"%s\"} %lu\n", scheduler.getTaskName(i),
+                    scheduler.getStats(i).runs);
+
+    header(out, "solar_task_run_seconds_total", "counter", "Time spent in the task");
+    for (int i = 0; i < count; i++)
+        out.appendf("solar_task_run_seconds_total{task=\"%s\"} %g\n", scheduler.getTaskName(i),
+                    scheduler.getStats(i).totalRunTime / 1e6);
+
+    header(out, "solar_task_run_max_seconds", "gauge", "Longest run of the task");
+    for (int i = 0; i < count; i++)
+        out.appendf("solar_task_run_max_seconds{task=\"%s\"} %g\n", scheduler.getTaskName(i),
+                    scheduler.getStats(i).maxRunTime / 1e3);
+
+    header(out, "solar_task_overruns_total", "counter", "Runs over the task's time budget");
+    for (int i = 0; i < count; i++)
+        out.appendf("solar_task_overruns_total{task=\"%s\"} %lu\n", scheduler.getTaskName(i),
+                    scheduler.getStats(i).overruns);
+
+    header(out, "solar_task_lateness_max_seconds", "gauge", "Longest start delay after the due time");
+    for (int i = 0; i < count; i++)
+        out.appendf("solar_task_lateness_max_seconds{task=\"%s\"} %g\n", scheduler.getTaskName(i),
+                    scheduler.getStats(i).maxLateness / 1e3);
+}
+
+void Metrics::writeDevices(MetricsOutput &out) const
+{
+    int hosts = httpPool.getHostCount();
+    char labels[48];
+
+    header(out, "solar_device_request_seconds", "histogram", "HTTP request time per device, connect included");
+    for (int i = 0; i < hosts; i++)
+    {
+        snprintf(labels, sizeof(labels), "device=\"%s\"", httpPool.getName(i));
+        httpPool.getLatency(i).write(out, "solar_device_request_seconds", labels, 1e-3);
+    }
+
+    header(out, "solar_device_failures_total", "counter", "Failed HTTP requests per device");
+    for (int i = 0; i < hosts; i++)
+        out.appendf("solar_device_failures_total{device=\"%s\"} %lu\n", httpPool.getName(i),
+                    (unsigned long)httpPool.getStats(i).failures);
+
+    header(out, "solar_device_connects_total", "counter", "TCP connections opened per device");
+    for (int i = 0; i < hosts; i++)
+        out.appendf("solar_device_connects_total{device=\"%s\"} %lu\n", httpPool.getName(i),
+                    (unsigned long)httpPool.getStats(i).connects);
+
+    header(out, "solar_device_reconnects_total", "counter", "Kept connections found closed, request retried");
+    for (int i = 0; i < hosts; i++)
+        out.appendf("solar_device_reconnects_total{device=\"%s\"} %lu\n", httpPool.getName(i),
+                    (unsigned long)httpPool.getStats(i).reconnects);
+
+    const HttpBufferPool::Stats &buffers = httpBuffers.getStats();
+    header(out, "solar_http_buffers_postponed_total", "counter", "Device requests postponed, no buffer free");
+    out.appendf("solar_http_buffers_postponed_total %lu\n", (unsigned long)buffers.exhausted);
+
+    header(out, "solar_devicelink_dropped_total", "counter", "Items dropped on a full queue between the cores");
+    out.appendf("solar_devicelink_dropped_total{queue=\"measurements\"} %lu\n", deviceLink.getDroppedMeasurements());
+    out.appendf("solar_devicelink_dropped_total{queue=\"commands\"} %lu\n", deviceLink.getDroppedCommands());
+
+    uint8_t sockets = socketRegistry.getCount();
+    HomeSocketDevice *const *devices = socketRegistry.getDevices();
+    const DeviceLink::Snapshot &snapshot = deviceLink.getSnapshot();
+
+    header(out, "solar_socket_on", "gauge", "Socket state, the requested one while a command is pending");
+    for (uint8_t i = 0; i < sockets; i++)
+        out.appendf("solar_socket_on{socket=\"%s\"} %d\n", socketRegistry.getName(i), snapshot.isOn(i) ? 1 : 0);
+
+    header(out, "solar_socket_consecutive_failures", "gauge", "Failed socket requests in a row");
+    for (uint8_t i = 0; i < sockets; i++)
+    {
+        if (devices[i])
+            out.appendf("solar_socket_consecutive_failures{socket=\"%s\"} %d\n", socketRegistry.getName(i),
+                        devices[i]->getConsecutiveFailures());
+    }
+
+    header(out, "solar_socket_commands_confirmed_total", "counter", "Socket commands confirmed by a read");
+    for (uint8_t i = 0; i < sockets; i++)
+    {
+        if (devices[i])
+            out.appendf("solar_socket_commands_confirmed_total{socket=\"%s\"} %lu\n", socketRegistry.getName(i),
+                        (unsigned long)devices[i]->getCommandStats().confirmed);
+    }
+
+    header(out, "solar_socket_command_confirm_seconds_total", "counter", "Command to confirmation time, summed");
+    for (uint8_t i = 0; i < sockets; i++)
+    {
+        if (devices[i])
+            out.appendf("solar_socket_command_confirm_seconds_total{socket=\"%s\"} %g\n", socketRegistry.getName(i),
+                        devices[i]->getCommandStats().latencySumMs / 1e3);
+    }
+}
+
+void Metrics::writeWeb(MetricsOutput &out) const
+{
+    header(out, "solar_web_request_seconds", "histogram", "Web request time, response sent included");
+    webRequest.write(out, "solar_web_request_seconds", "", 1e-6);
+
+    header(out, "solar_web_requests_total", "counter", "Web requests per route");
+    for (uint8_t i = 0; i < routeCount; i++)
+        out.appendf("solar_web_requests_total{route=\"%s\"} %lu\n", routes[i].label,
+                    (unsigned long)routes[i].requests);
+
+    header(out, "solar_web_request_seconds_total", "counter", "Web request time per route, summed");
+    for (uint8_t i = 0; i < routeCount; i++)
+        out.appendf("solar_web_request_seconds_total{route=\"%s\"} %g\n", routes[i].label,
+                    routes[i].totalTime / 1e6);
+
+    const FileCache::Stats &cache = fileCache.getStats();
+    header(out, "solar_web_cache_requests_total", "counter", "Static file lookups in the RAM cache");
+    out.appendf("solar_web_cache_requests_total{result=\"hit\"} %lu\n", (unsigned long)cache.hits);
+    out.appendf("solar_web_cache_requests_total{result=\"miss\"} %lu\n", (unsigned long)cache.misses);
+
+    header(out, "solar_web_cache_evictions_total", "counter", "Cached files dropped to make room");
+    out.appendf("solar_web_cache_evictions_total %lu\n", (unsigned long)cache.evictions);
+
+    header(out, "solar_web_cache_skipped_total", "counter", "Files streamed from SPIFFS, over the cache budget");
+    out.appendf("solar_web_cache_skipped_total %lu\n", (unsigned long)cache.skipped);
+
+    header(out, "solar_web_cache_bytes", "gauge", "Bytes cached, and the budget at the current free heap");
+    out.appendf("solar_web_cache_bytes{kind=\"used\"} %lu\n", (unsigned long)cache.bytes);
+    out.appendf("solar_web_cache_bytes{kind=\"budget\"} %lu\n", (unsigned long)fileCache.getBudget());
+}
+
+void Metrics::write(WebServer &server) const
+{
+    MetricsOutput out(server);
+
+    header(out, "solar_uptime_seconds", "gauge", "Time since boot");
+    out.appendf("solar_uptime_seconds %lu\n", (unsigned long)monoUptimeSeconds());
+
+    header(out, "solar_heap_free_bytes", "gauge", "Free heap");
+    out.appendf("solar_heap_free_bytes %lu\n", (unsigned long)ESP.getFreeHeap());
+    header(out, "solar_heap_largest_free_block_bytes", "gauge", "Largest block that can be allocated");
+    out.appendf("solar_heap_largest_free_block_bytes %lu\n", (unsigned long)ESP.getMaxAllocHeap());
+    header(out, "solar_heap_min_free_bytes", "gauge", "Lowest free heap since boot");
+    out.appendf("solar_heap_min_free_bytes %lu\n", (unsigned long)ESP.getMinFreeHeap());
+
+    header(out, "solar_loop_pass_seconds", "histogram", "Time of one loop() pass");
+    loopPass.write(out, "solar_loop_pass_seconds", "", 1e-6);
+
+    writeTasks(out);
+    writeDevices(out);
+    writeWeb(out);
+}
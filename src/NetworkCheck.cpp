@@ -11,7 +11,7 @@ NetworkCheck::NetworkCheck(const char *ip) : deviceIP(ip),
 
 bool NetworkCheck::isDevicePresent()
 {
-    unsigned long currentTime = millis();
+    MonoTime currentTime = monoNow();
     if (currentTime - lastCheckTime < CHECK_INTERVAL)
     {
         return lastKnownState;
@@ -0,0 +1,174 @@
+// PollController.cpp
+#include "PollController.h"
+#include "RulesEngine.h"
+
+PollController::PollController()
+{
+    for (int i = 0; i < SocketRegistry::MAX_SOCKETS; i++)
+    {
+        socketInterval[i] = SOCKET_ACTIVE_MS;
+        socketReason[i] = REASON_NORMAL;
+    }
+}
+
+const char *PollController::reasonName(Reason reason)
+{
+    switch (reason)
+    {
+    case REASON_THRESHOLD:
+        return "threshold";
+    case REASON_COMMAND:
+        return "command";
+    case REASON_STEADY:
+        return "steady";
+    case REASON_DARK:
+        return "dark";
+    case REASON_ACTIVE:
+        return "active";
+    case REASON_IDLE:
+        return "idle";
+    default:
+        return "normal";
+    }
+}
+
+bool PollController::recentCommand(int index, MonoTime now) const
+{
+    MonoTime command = deviceLink.getLastCommand(index);
+    return command != 0 && now - command < COMMAND_WINDOW;
+}
+
+void PollController::planP1(MonoTime now)
+{
+    const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+
+    // Steady: every new sample within STEADY_W of where the run started
+    if (devices.p1Connected && devices.p1UpdateTime != lastSampleTime)
+    {
+        lastSampleTime = devices.p1UpdateTime;
+        float net = devices.importPower - devices.exportPower;
+        if (fabsf(net - steadyPower) <= STEADY_W)
+        {
+            if (steadySamples < 1000)
+                steadySamples++;
+        }
+        else
+        {
+            steadyPower = net;
+            steadySamples = 0;
+        }
+    }
+
+    bool commanded = false;
+    bool hasSurplus = false;
+    bool surplusOn = false;
+    for (uint8_t i = 0; i < socketRegistry.getCount(); i++)
+    {
+        commanded |= recentCommand(i, now);
+        if (socketRegistry.getLogic(i) == SocketRegistry::LOGIC_SURPLUS)
+        {
+            hasSurplus = true;
+            surplusOn |= devices.isOn(i);
+        }
+    }
+
+    float exportPower = devices.exportPower;
+    bool nearThreshold = fabsf(exportPower - config.power_on_threshold) < THRESHOLD_BAND_W ||
+                         fabsf(exportPower - config.power_off_threshold) < THRESHOLD_BAND_W;
+
+    // Without a light sensor, night is 22:00 - 6:00
+    const TimeContext &time = timeSync.now();
+    bool dark = sensors.hasBH1750() ? sensors.getLightLevel() < DARK_LUX
+                                    : time.valid && (time.hour >= 22 || time.hour < 6);
+
+    if (commanded)
+    {
+        p1Interval = FAST_MS;
+        p1Reason = REASON_COMMAND;
+    }
+    else if (hasSurplus && nearThreshold)
+    {
+        p1Interval = FAST_MS;
+        p1Reason = REASON_THRESHOLD;
+    }
+    else if (dark && exportPower <= 0 && !surplusOn)
+    {
+        p1Interval = IDLE_MS;
+        p1Reason = REASON_DARK;
+    }
+    else if (steadySamples >= STEADY_SAMPLES)
+    {
+        // Doubles every STEADY_SAMPLES samples up to the maximum
+        p1Interval = P1_NORMAL_MS;
+        for (uint16_t n = steadySamples; n >= STEADY_SAMPLES && p1Interval < P1_STEADY_MAX_MS; n -= STEADY_SAMPLES)
+        {
+            p1Interval *= 2;
+        }
+        p1Reason = REASON_STEADY;
+    }
+    else
+    {
+        p1Interval = P1_NORMAL_MS;
+        p1Reason = REASON_NORMAL;
+    }
+}
+
+void PollController::planSocket(int index, MonoTime now)
+{
+    bool automatic = socketRegistry.getLogic(index) != SocketRegistry::LOGIC_NONE || rules.controlsSocket(index + 1);
+
+    if (recentCommand(index, now))
+    {
+        socketInterval[index] = FAST_MS;
+        socketReason[index] = REASON_COMMAND;
+    }
+    else if (automatic && deviceLink.getSnapshot().isOn(index))
+    {
+        socketInterval[index] = SOCKET_ACTIVE_MS;
+        socketReason[index] = REASON_ACTIVE;
+    }
+    else
+    {
+        socketInterval[index] = IDLE_MS;
+        socketReason[index] = REASON_IDLE;
+    }
+}
+
+// Stretches every interval by the same factor when the plan is over budget
+void PollController::applyBudget(uint8_t socketCount)
+{
+    uint32_t planned = 60000 / p1Interval;
+    for (uint8_t i = 0; i < socketCount; i++)
+    {
+        planned += 60000 / socketInterval[i];
+    }
+
+    stretch = 100;
+    if (planned > budget)
+    {
+        stretch = (uint16_t)((planned * 100 + budget - 1) / budget);
+        p1Interval = p1Interval * stretch / 100;
+        planned = 60000 / p1Interval;
+        for (uint8_t i = 0; i < socketCount; i++)
+        {
+            socketInterval[i] = socketInterval[i] * stretch / 100;
+            planned += 60000 / socketInterval[i];
+        }
+    }
+    plannedPerMinute = planned;
+}
+
+void PollController::update()
+{
+    MonoTime now = monoNow();
+    uint8_t count = socketRegistry.getCount();
+
+    planP1(now);
+    for (uint8_t i = 0; i < count; i++)
+    {
+        planSocket(i, now);
+    }
+    applyBudget(count);
+
+    deviceLink.setPollIntervals(p1Interval, socketInterval);
+}
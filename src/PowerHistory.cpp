@@ -0,0 +1,171 @@
+// PowerHistory.cpp
+#include "PowerHistory.h"
+
+static_assert(sizeof(PowerHistory) < 28 * 1024, "PowerHistory exceeds its RAM budget");
+
+PowerHistory::PowerHistory()
+{
+    tiers[SECONDS] = {1, SECOND_SLOTS, seconds, seconds, seconds, false, 0, 0, 0, 0, 0};
+    tiers[MINUTES] = {60, MINUTE_SLOTS, minuteMin, minuteAvg, minuteMax, false, 0, 0, 0, 0, 0};
+    tiers[QUARTERS] = {900, QUARTER_SLOTS, quarterMin, quarterAvg, quarterMax, false, 0, 0, 0, 0, 0};
+    clear();
+}
+
+void PowerHistory::clear()
+{
+    for (int t = 0; t < TIER_COUNT; t++)
+    {
+        TierState &tier = tiers[t];
+        for (uint16_t i = 0; i < tier.slots; i++)
+        {
+            tier.minW[i] = NO_DATA;
+            tier.avgW[i] = NO_DATA;
+            tier.maxW[i] = NO_DATA;
+        }
+        tier.started = false;
+        tier.lastBucket = 0;
+        tier.sum = 0;
+        tier.count = 0;
+    }
+}
+
+const char *PowerHistory::getTierName(Tier tier)
+{
+    switch (tier)
+    {
+    case SECONDS:
+        return "seconds";
+    case MINUTES:
+        return "minutes";
+    case QUARTERS:
+        return "quarters";
+    default:
+        return "?";
+    }
+}
+
+void PowerHistory::add(uint32_t now, float watts)
+{
+    // NO_DATA is reserved, so the range is one short on the negative side
+    long rounded = lroundf(watts);
+    int16_t value = (int16_t)constrain(rounded, -INT16_MAX, INT16_MAX);
+
+    for (int t = 0; t < TIER_COUNT; t++)
+    {
+        addToTier(tiers[t], now, value);
+    }
+}
+
+void PowerHistory::addToTier(TierState &tier, uint32_t now, int16_t watts)
+{
+    uint32_t bucket = now / tier.resolution;
+
+    if (!tier.started)
+    {
+        tier.started = true;
+        tier.lastBucket = bucket;
+        tier.count = 0;
+    }
+    else if (bucket != tier.lastBucket)
+    {
+        if (bucket < tier.lastBucket)
+            return; // Clock went backwards, keep what we have
+
+        // Buckets without samples since the last one are cleared, not left
+        // holding values from a full ring ago
+        uint32_t skipped = min(bucket - tier.lastBucket, (uint32_t)tier.slots);
+        for (uint32_t i = 1; i <= skipped; i++)
+        {
+            uint16_t slot = (tier.lastBucket + i) % tier.slots;
+            tier.minW[slot] = NO_DATA;
+            tier.avgW[slot] = NO_DATA;
+            tier.maxW[slot] = NO_DATA;
+        }
+        tier.lastBucket = bucket;
+        tier.count = 0;
+    }
+
+    if (tier.count == 0)
+    {
+        tier.sum = 0;
+        tier.low = watts;
+        tier.high = watts;
+    }
+    tier.sum += watts;
+    tier.count++;
+    tier.low = min(tier.low, watts);
+    tier.high = max(tier.high, watts);
+
+    // The open bucket is kept up to date so queries include it. avg is
+    // written last: in the SECONDS tier the three fields share one array.
+    uint16_t slot = bucket % tier.slots;
+    tier.minW[slot] = tier.low;
+    tier.maxW[slot] = tier.high;
+    tier.avgW[slot] = (int16_t)(tier.sum / tier.count);
+}
+
+bool PowerHistory::inRange(const TierState &tier, uint32_t bucket) const
+{
+    return tier.started && bucket <= tier.lastBucket && tier.lastBucket - bucket < tier.slots;
+}
+
+size_t PowerHistory::getSeries(Tier tier, uint32_t now, size_t count,
+                               int16_t *minOut, int16_t *avgOut, int16_t *maxOut) const
+{
+    const TierState &state = tiers[tier];
+    count = min(count, (size_t)state.slots);
+    uint32_t newest = now / state.resolution;
+    count = min(count, (size_t)newest + 1);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        uint32_t bucket = newest - (count - 1 - i);
+        bool valid = inRange(state, bucket);
+        uint16_t slot = bucket % state.slots;
+        if (minOut)
+            minOut[i] = valid ? state.minW[slot] : NO_DATA;
+        if (avgOut)
+            avgOut[i] = valid ? state.avgW[slot] : NO_DATA;
+        if (maxOut)
+            maxOut[i] = valid ? state.maxW[slot] : NO_DATA;
+    }
+    return count;
+}
+
+PowerHistory::Aggregate PowerHistory::aggregate(uint32_t now, uint32_t seconds) const
+{
+    Aggregate result = {0, 0, 0, 0};
+    if (seconds == 0)
+        return result;
+
+    int t = SECONDS;
+    while (t < TIER_COUNT - 1 && (uint32_t)tiers[t].resolution * tiers[t].slots < seconds)
+        t++;
+    const TierState &tier = tiers[t];
+
+    uint32_t newest = now / tier.resolution;
+    uint32_t buckets = min((seconds + tier.resolution - 1) / tier.resolution, (uint32_t)tier.slots);
+    buckets = min(buckets, newest + 1);
+
+    int16_t low = INT16_MAX;
+    int16_t high = -INT16_MAX;
+    int32_t sum = 0;
+    for (uint32_t bucket = newest + 1 - buckets; bucket <= newest; bucket++)
+    {
+        uint16_t slot = bucket % tier.slots;
+        if (!inRange(tier, bucket) || tier.avgW[slot] == NO_DATA)
+            continue;
+        low = min(low, tier.minW[slot]);
+        high = max(high, tier.maxW[slot]);
+        sum += tier.avgW[slot];
+        result.buckets++;
+    }
+
+    if (result.buckets > 0)
+    {
+        result.minW = low;
+        result.maxW = high;
+        result.avgW = (float)sum / result.buckets;
+    }
+    return result;
+}
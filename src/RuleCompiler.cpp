@@ -0,0 +1,798 @@
+// RuleCompiler.cpp
+#include "RuleProgram.h"
+#include "DeviceLink.h"
+
+#include <algorithm>
+
+const RuleFunctionInfo RULE_FUNCTIONS[] = {
+    {"after", RULE_FN_AFTER, 1},
+    {"isafter", RULE_FN_AFTER, 1},
+    {"turnonafter", RULE_FN_AFTER, 1},
+    {"before", RULE_FN_BEFORE, 1},
+    {"isbefore", RULE_FN_BEFORE, 1},
+    {"turnonbefore", RULE_FN_BEFORE, 1},
+    {"turnoffafter", RULE_FN_BEFORE, 1}, // True until the time, like the C++ version
+    {"between", RULE_FN_BETWEEN, 2},
+    {"turnoninbetween", RULE_FN_BETWEEN, 2},
+    {"isweekday", RULE_FN_WEEKDAY, 1},
+    {"weekday", RULE_FN_WEEKDAY, 1},
+    {"lightabove", RULE_FN_LIGHT_ABOVE, 1},
+    {"lightsensorabove", RULE_FN_LIGHT_ABOVE, 1},
+    {"lightbelow", RULE_FN_LIGHT_BELOW, 1},
+    {"lightsensorbelow", RULE_FN_LIGHT_BELOW, 1},
+    {"exportabove", RULE_FN_EXPORT_ABOVE, 1},
+    {"solarabove", RULE_FN_EXPORT_ABOVE, 1},
+    {"solarcelabove", RULE_FN_EXPORT_ABOVE, 1},
+    {"exportbelow", RULE_FN_EXPORT_BELOW, 1},
+    {"solarbelow", RULE_FN_EXPORT_BELOW, 1},
+    {"solarcelbelow", RULE_FN_EXPORT_BELOW, 1},
+    {"importabove", RULE_FN_IMPORT_ABOVE, 1},
+    {"importbelow", RULE_FN_IMPORT_BELOW, 1},
+    {"avgexportabove", RULE_FN_AVG_EXPORT_ABOVE, 2},
+    {"pingfound", RULE_FN_PING_FOUND, 0},
+    {"pingnotfound", RULE_FN_PING_NOT_FOUND, 0},
+    {"ison", RULE_FN_IS_ON, 1},
+    {"isoff", RULE_FN_IS_OFF, 1},
+    {"onfor", RULE_FN_ON_FOR, 2},
+    {"hasbeenonfor", RULE_FN_ON_FOR, 2},
+    {"offfor", RULE_FN_OFF_FOR, 2},
+    {"hasbeenofffor", RULE_FN_OFF_FOR, 2},
+    {"turnuntil", RULE_FN_TURN_UNTIL, 3},
+    {"latch", RULE_FN_TURN_UNTIL, 3},
+    {"delay", RULE_FN_DELAY, 2},
+    {"oneshot", RULE_FN_ONE_SHOT, 3},
+    {"retrigger", RULE_FN_RETRIGGER, 3},
+    {"offdelay", RULE_FN_RETRIGGER, 3},
+    {"minon", RULE_FN_MIN_ON, 3},
+    {"minoff", RULE_FN_MIN_OFF, 3},
+};
+const size_t RULE_FUNCTION_COUNT = sizeof(RULE_FUNCTIONS) / sizeof(RULE_FUNCTIONS[0]);
+
+// Rough guide: 1 = a compare against the clock, 2 = a cached reading, more
+// for anything that walks the history or touches the network.
+const uint8_t RULE_FUNCTION_COSTS[RULE_FN_COUNT] = {
+    1,                          // RULE_FN_AFTER
+    1,                          // RULE_FN_BEFORE
+    1,                          // RULE_FN_BETWEEN
+    1,                          // RULE_FN_WEEKDAY
+    2,                          // RULE_FN_LIGHT_ABOVE
+    2,                          // RULE_FN_LIGHT_BELOW
+    2,                          // RULE_FN_EXPORT_ABOVE
+    2,                          // RULE_FN_EXPORT_BELOW
+    2,                          // RULE_FN_IMPORT_ABOVE
+    2,                          // RULE_FN_IMPORT_BELOW
+    8,                          // RULE_FN_AVG_EXPORT_ABOVE
+    100,                        // RULE_FN_PING_FOUND, blocks for up to a second
+    100,                        // RULE_FN_PING_NOT_FOUND
+    2,                          // RULE_FN_IS_ON
+    2,                          // RULE_FN_IS_OFF
+    2,                          // RULE_FN_ON_FOR
+    2,                          // RULE_FN_OFF_FOR
+    1 | RULE_COST_STATEFUL,     // RULE_FN_TURN_UNTIL
+    1 | RULE_COST_STATEFUL,     // RULE_FN_DELAY
+    1 | RULE_COST_STATEFUL,     // RULE_FN_ONE_SHOT
+    1 | RULE_COST_STATEFUL,     // RULE_FN_RETRIGGER
+    1 | RULE_COST_STATEFUL,     // RULE_FN_MIN_ON
+    1 | RULE_COST_STATEFUL,     // RULE_FN_MIN_OFF
+};
+
+const uint8_t RULE_FUNCTION_INPUTS[RULE_FN_COUNT] = {
+    RULE_INPUT_CLOCK,                           // RULE_FN_AFTER
+    RULE_INPUT_CLOCK,                           // RULE_FN_BEFORE
+    RULE_INPUT_CLOCK,                           // RULE_FN_BETWEEN
+    RULE_INPUT_CLOCK,                           // RULE_FN_WEEKDAY
+    RULE_INPUT_LIGHT,                           // RULE_FN_LIGHT_ABOVE
+    RULE_INPUT_LIGHT,                           // RULE_FN_LIGHT_BELOW
+    RULE_INPUT_POWER,                           // RULE_FN_EXPORT_ABOVE
+    RULE_INPUT_POWER,                           // RULE_FN_EXPORT_BELOW
+    RULE_INPUT_POWER,                           // RULE_FN_IMPORT_ABOVE
+    RULE_INPUT_POWER,                           // RULE_FN_IMPORT_BELOW
+    RULE_INPUT_POWER | RULE_INPUT_SECONDS,      // RULE_FN_AVG_EXPORT_ABOVE, the window moves
+    RULE_INPUT_PRESENCE,                        // RULE_FN_PING_FOUND
+    RULE_INPUT_PRESENCE,                        // RULE_FN_PING_NOT_FOUND
+    RULE_INPUT_SOCKETS,                         // RULE_FN_IS_ON
+    RULE_INPUT_SOCKETS,                         // RULE_FN_IS_OFF
+    RULE_INPUT_SOCKETS | RULE_INPUT_SECONDS,    // RULE_FN_ON_FOR
+    RULE_INPUT_SOCKETS | RULE_INPUT_SECONDS,    // RULE_FN_OFF_FOR
+    0,                                          // RULE_FN_TURN_UNTIL, only its arguments
+    RULE_INPUT_TIMERS,                          // RULE_FN_DELAY
+    RULE_INPUT_TIMERS,                          // RULE_FN_ONE_SHOT
+    RULE_INPUT_TIMERS,                          // RULE_FN_RETRIGGER
+    RULE_INPUT_TIMERS,                          // RULE_FN_MIN_ON
+    RULE_INPUT_TIMERS,                          // RULE_FN_MIN_OFF
+};
+
+static RuleTimerType timerTypeOf(uint8_t function)
+{
+    switch (function)
+    {
+    case RULE_FN_TURN_UNTIL:
+        return TIMER_LATCH;
+    case RULE_FN_DELAY:
+    case RULE_FN_ONE_SHOT:
+        return TIMER_ONE_SHOT;
+    case RULE_FN_RETRIGGER:
+        return TIMER_RETRIGGER;
+    case RULE_FN_MIN_ON:
+        return TIMER_MIN_ON;
+    case RULE_FN_MIN_OFF:
+        return TIMER_MIN_OFF;
+    default:
+        return TIMER_UNUSED;
+    }
+}
+
+struct RuleConstant
+{
+    const char *name;
+    long value;
+};
+
+static const RuleConstant RULE_CONSTANTS[] = {
+    {"sun", 0x01},
+    {"mon", 0x02},
+    {"tue", 0x04},
+    {"wed", 0x08},
+    {"thu", 0x10},
+    {"fri", 0x20},
+    {"sat", 0x40},
+    {"weekdays", 0x3E},
+    {"weekend", 0x41},
+    {"everyday", 0x7F},
+    {"true", 1},
+    {"false", 0},
+};
+
+static bool isIdentChar(char c)
+{
+    return isalnum((unsigned char)c) || c == '_';
+}
+
+void RuleCompiler::fail(const char *message)
+{
+    if (failed)
+        return;
+    failed = true;
+    errorLine = line;
+    if (tokenLength > 0 && tokenLength < 24)
+        snprintf(error, sizeof(error), "line %u: %s near '%.*s'", line, message, (int)tokenLength, tokenStart);
+    else
+        snprintf(error, sizeof(error), "line %u: %s", line, message);
+}
+
+bool RuleCompiler::lexNumber()
+{
+    long value = 0;
+    int base = 10;
+    if (pos[0] == '0' && pos + 1 < end && (pos[1] == 'x' || pos[1] == 'X' || pos[1] == 'b' || pos[1] == 'B'))
+    {
+        base = (pos[1] == 'x' || pos[1] == 'X') ? 16 : 2;
+        pos += 2;
+    }
+
+    const char *digits = pos;
+    while (pos < end && isxdigit((unsigned char)*pos))
+    {
+        int digit = isdigit((unsigned char)*pos) ? *pos - '0' : tolower(*pos) - 'a' + 10;
+        if (digit >= base || value > 100000)
+            return false;
+        value = value * base + digit;
+        pos++;
+    }
+    if (pos == digits)
+        return false;
+
+    // HH:MM becomes the minute of the day
+    if (base == 10 && pos < end && *pos == ':')
+    {
+        pos++;
+        if (end - pos < 2 || !isdigit((unsigned char)pos[0]) || !isdigit((unsigned char)pos[1]))
+            return false;
+        long minutes = (pos[0] - '0') * 10 + (pos[1] - '0');
+        pos += 2;
+        if (value > 23 || minutes > 59)
+            return false;
+        value = value * 60 + minutes;
+    }
+    // 90s, 5m, 2h: a duration in seconds
+    else if (base == 10 && pos < end && (*pos == 's' || *pos == 'm' || *pos == 'h') &&
+             (pos + 1 >= end || !isIdentChar(pos[1])))
+    {
+        value *= *pos == 'h' ? 3600 : (*pos == 'm' ? 60 : 1);
+        pos++;
+    }
+
+    if (pos < end && isIdentChar(*pos))
+        return false;
+    tokenValue = value;
+    return true;
+}
+
+void RuleCompiler::next()
+{
+    while (pos < end)
+    {
+        char c = *pos;
+        if (c == '#' || (c == '/' && pos + 1 < end && pos[1] == '/'))
+        {
+            while (pos < end && *pos != '\n')
+                pos++;
+        }
+        else if (c == '\n' && parenDepth == 0)
+        {
+            break;
+        }
+        else if (isspace((unsigned char)c))
+        {
+            if (c == '\n')
+                line++;
+            pos++;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    tokenStart = pos;
+    tokenLength = 0;
+    if (pos >= end)
+    {
+        token = TOK_END;
+        return;
+    }
+
+    char c = *pos;
+    if (isdigit((unsigned char)c))
+    {
+        token = lexNumber() ? TOK_NUMBER : TOK_ERROR;
+        while (pos < end && (isIdentChar(*pos) || *pos == ':'))
+            pos++; // Swallow the rest of a bad literal for the message
+    }
+    else if (isalpha((unsigned char)c) || c == '_')
+    {
+        while (pos < end && isIdentChar(*pos))
+            pos++;
+        token = TOK_IDENT;
+    }
+    else
+    {
+        pos++;
+        switch (c)
+        {
+        case '\n':
+        case ';':
+            token = TOK_NEWLINE;
+            if (c == '\n')
+                line++;
+            break;
+        case '(':
+            parenDepth++;
+            token = TOK_LPAREN;
+            break;
+        case ')':
+            parenDepth = max(parenDepth - 1, 0);
+            token = TOK_RPAREN;
+            break;
+        case ',':
+            token = TOK_COMMA;
+            break;
+        case '=':
+            token = TOK_ASSIGN;
+            break;
+        case '*':
+        case '&':
+            token = TOK_AND;
+            break;
+        case '+':
+        case '|':
+            token = TOK_OR;
+            break;
+        case '!':
+            token = TOK_NOT;
+            break;
+        default:
+            token = TOK_ERROR;
+        }
+    }
+    tokenLength = pos - tokenStart;
+    if (token == TOK_NEWLINE)
+        tokenLength = 0;
+}
+
+bool RuleCompiler::identIs(const char *name) const
+{
+    if (token != TOK_IDENT || strlen(name) != tokenLength)
+        return false;
+    for (size_t i = 0; i < tokenLength; i++)
+    {
+        if (tolower((unsigned char)tokenStart[i]) != name[i])
+            return false;
+    }
+    return true;
+}
+
+bool RuleCompiler::expect(Token expected, const char *what)
+{
+    if (token != expected)
+    {
+        char message[40];
+        snprintf(message, sizeof(message), "expected %s", what);
+        fail(message);
+        return false;
+    }
+    next();
+    return true;
+}
+
+void RuleCompiler::emit(uint8_t byte)
+{
+    if (program->codeLength >= RuleProgram::MAX_CODE)
+    {
+        fail("rules too long");
+        return;
+    }
+    program->code[program->codeLength++] = byte;
+}
+
+void RuleCompiler::emitPush(long value)
+{
+    if (value < INT16_MIN || value > INT16_MAX)
+    {
+        fail("number out of range");
+        return;
+    }
+    emitOp(RULE_OP_PUSH, 0, 1);
+    emit((uint16_t)value & 0xFF);
+    emit((uint16_t)value >> 8);
+}
+
+void RuleCompiler::emitOp(uint8_t op, int pops, int pushes)
+{
+    depth += pushes - pops;
+    if (depth > RuleProgram::STACK_DEPTH)
+        fail("expression too deep");
+    emit(op);
+}
+
+bool RuleCompiler::compile(const char *source, size_t length, RuleProgram &output)
+{
+    pos = source;
+    end = source + length;
+    line = 1;
+    parenDepth = 0;
+    program = &output;
+    program->codeLength = 0;
+    program->ruleCount = 0;
+    for (uint8_t i = 0; i < RuleTimers::MAX_TIMERS; i++)
+    {
+        program->timerTypes[i] = TIMER_UNUSED;
+        program->timerNames[i][0] = '\0';
+    }
+    failed = false;
+    error[0] = '\0';
+    errorLine = 0;
+
+    next();
+    while (!failed && token != TOK_END)
+    {
+        if (token == TOK_NEWLINE)
+        {
+            next();
+            continue;
+        }
+        parseRule();
+        if (!failed && token != TOK_NEWLINE && token != TOK_END)
+            fail("expected end of rule");
+    }
+    return !failed;
+}
+
+// turnOn(n) = expression  |  turnOff(n) = expression
+void RuleCompiler::parseRule()
+{
+    if (program->ruleCount >= RuleProgram::MAX_RULES)
+    {
+        fail("too many rules");
+        return;
+    }
+
+    Rule &rule = program->rules[program->ruleCount];
+    rule.line = line;
+    if (identIs("turnon"))
+        rule.turnOn = 1;
+    else if (identIs("turnoff"))
+        rule.turnOn = 0;
+    else
+    {
+        fail("expected turnOn(n) or turnOff(n)");
+        return;
+    }
+    next();
+
+    if (!expect(TOK_LPAREN, "'('"))
+        return;
+    if (token != TOK_NUMBER || tokenValue < 1 || tokenValue > DeviceLink::MAX_SOCKETS)
+    {
+        fail("expected a socket number");
+        return;
+    }
+    rule.socket = tokenValue;
+    next();
+    if (!expect(TOK_RPAREN, "')'") || !expect(TOK_ASSIGN, "'='"))
+        return;
+
+    rule.start = program->codeLength;
+    depth = 0;
+    inputs = 0;
+    parseOr();
+    if (failed)
+        return;
+    rule.length = program->codeLength - rule.start;
+    rule.inputs = inputs;
+    program->ruleCount++;
+}
+
+void RuleCompiler::insertCode(uint16_t at, const uint8_t *bytes, uint16_t count)
+{
+    if (program->codeLength + count > RuleProgram::MAX_CODE)
+    {
+        fail("rules too long");
+        return;
+    }
+    memmove(program->code + at + count, program->code + at, program->codeLength - at);
+    memcpy(program->code + at, bytes, count);
+    program->codeLength += count;
+}
+
+// Terms that must run every time go first, in source order
+bool RuleCompiler::runsBefore(const Term &a, const Term &b)
+{
+    if (a.stateful != b.stateful)
+        return a.stateful;
+    return !a.stateful && a.cost < b.cost;
+}
+
+// Turns the terms of an AND/OR chain, which sit back to back at the end of
+// the code, into short-circuit code. The terms are sorted with runsBefore and
+// moved into that order. Stateful terms are combined with the eager op so
+// each of them runs on every pass; every other term gets a jump in front
+// that skips the rest of the chain once the outcome is known:
+//
+//   a & b & c  ->  a JUMP_IF_FALSE(end) b JUMP_IF_FALSE(end) c BOOL end:
+RuleCompiler::Term RuleCompiler::makeChain(uint8_t op, Term *terms, uint8_t count)
+{
+    Term chain = {terms[0].start, 0, 0, false};
+    for (uint8_t i = 0; i < count; i++)
+    {
+        chain.cost += terms[i].cost;
+        chain.stateful |= terms[i].stateful;
+    }
+
+    std::stable_sort(terms, terms + count, runsBefore);
+
+    uint8_t *code = program->code;
+    uint16_t at = chain.start;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        Term &term = terms[i];
+        std::rotate(code + at, code + term.start, code + term.start + term.length);
+        for (uint8_t j = i + 1; j < count; j++)
+        {
+            if (terms[j].start < term.start)
+                terms[j].start += term.length;
+        }
+        term.start = at;
+        at += term.length;
+    }
+
+    uint8_t jump[3] = {(uint8_t)(op == RULE_OP_AND ? RULE_OP_JUMP_IF_FALSE : RULE_OP_JUMP_IF_TRUE), 0, 0};
+    uint16_t jumps[MAX_TERMS];
+    uint8_t jumpCount = 0;
+    uint16_t shift = 0;
+    for (uint8_t i = 1; i < count && !failed; i++)
+    {
+        if (terms[i].stateful)
+        {
+            insertCode(terms[i].start + terms[i].length + shift, &op, 1);
+            shift += 1;
+        }
+        else
+        {
+            jumps[jumpCount++] = terms[i].start + shift;
+            insertCode(terms[i].start + shift, jump, sizeof(jump));
+            shift += sizeof(jump);
+        }
+    }
+
+    if (jumpCount > 0)
+    {
+        uint8_t normalize = RULE_OP_BOOL;
+        insertCode(program->codeLength, &normalize, 1);
+    }
+    if (failed)
+        return chain;
+
+    for (uint8_t i = 0; i < jumpCount; i++)
+    {
+        uint16_t offset = program->codeLength - (jumps[i] + sizeof(jump));
+        code[jumps[i] + 1] = offset & 0xFF;
+        code[jumps[i] + 2] = offset >> 8;
+    }
+    chain.length = program->codeLength - chain.start;
+    return chain;
+}
+
+RuleCompiler::Term RuleCompiler::parseOr()
+{
+    Term terms[MAX_TERMS];
+    uint8_t count = 0;
+    terms[count++] = parseAnd();
+    while (!failed && token == TOK_OR)
+    {
+        next();
+        if (count == MAX_TERMS)
+        {
+            fail("too many terms in one chain");
+            break;
+        }
+        terms[count++] = parseAnd();
+        depth--; // The chain only ever keeps one value on the stack
+    }
+    return count == 1 || failed ? terms[0] : makeChain(RULE_OP_OR, terms, count);
+}
+
+RuleCompiler::Term RuleCompiler::parseAnd()
+{
+    Term terms[MAX_TERMS];
+    uint8_t count = 0;
+    terms[count++] = parseUnary();
+    while (!failed && token == TOK_AND)
+    {
+        next();
+        if (count == MAX_TERMS)
+        {
+            fail("too many terms in one chain");
+            break;
+        }
+        terms[count++] = parseUnary();
+        depth--;
+    }
+    return count == 1 || failed ? terms[0] : makeChain(RULE_OP_AND, terms, count);
+}
+
+RuleCompiler::Term RuleCompiler::parseUnary()
+{
+    if (token == TOK_NOT)
+    {
+        uint16_t start = program->codeLength;
+        next();
+        Term term = parseUnary();
+        emitOp(RULE_OP_NOT, 1, 1);
+        term.start = start;
+        term.length = program->codeLength - start;
+        return term;
+    }
+    return parsePrimary();
+}
+
+bool RuleCompiler::constantValue(long &value) const
+{
+    for (const RuleConstant &constant : RULE_CONSTANTS)
+    {
+        if (identIs(constant.name))
+        {
+            value = constant.value;
+            return true;
+        }
+    }
+    return false;
+}
+
+RuleCompiler::Term RuleCompiler::parsePrimary()
+{
+    Term term = {program->codeLength, 0, 0, false};
+    if (failed)
+        return term;
+
+    if (token == TOK_NUMBER)
+    {
+        emitPush(tokenValue);
+        next();
+        term.length = program->codeLength - term.start;
+        return term;
+    }
+    if (token == TOK_LPAREN)
+    {
+        if (parenDepth > MAX_NESTING)
+        {
+            fail("too many nested parentheses");
+            return term;
+        }
+        next();
+        term = parseOr();
+        expect(TOK_RPAREN, "')'");
+        return term;
+    }
+    if (token != TOK_IDENT)
+    {
+        fail(token == TOK_ERROR ? "bad literal" : "expected a value");
+        return term;
+    }
+
+    long value;
+    if (constantValue(value))
+    {
+        emitPush(value);
+        next();
+        term.length = program->codeLength - term.start;
+        return term;
+    }
+
+    // and(a, b, ...), or(a, b, ...), not(a): the function spelling of * + !
+    if (identIs("and") || identIs("or") || identIs("not"))
+    {
+        uint8_t op = identIs("and") ? RULE_OP_AND : (identIs("or") ? RULE_OP_OR : RULE_OP_NOT);
+        next();
+        if (!expect(TOK_LPAREN, "'('"))
+            return term;
+        Term terms[MAX_TERMS];
+        uint8_t count = 0;
+        while (!failed)
+        {
+            if (count == MAX_TERMS)
+            {
+                fail("too many terms in one chain");
+                break;
+            }
+            terms[count++] = parseOr();
+            if (count > 1)
+                depth--;
+            if (token != TOK_COMMA)
+                break;
+            next();
+        }
+        if (op == RULE_OP_NOT)
+        {
+            if (count != 1)
+                fail("not() takes one argument");
+            emitOp(RULE_OP_NOT, 1, 1);
+            term.cost = terms[0].cost;
+            term.stateful = terms[0].stateful;
+        }
+        else if (count < 2)
+        {
+            fail("and()/or() need two or more arguments");
+        }
+        else if (!failed)
+        {
+            term = makeChain(op, terms, count);
+        }
+        expect(TOK_RPAREN, "')'");
+        term.length = program->codeLength - term.start;
+        return term;
+    }
+
+    for (size_t i = 0; i < RULE_FUNCTION_COUNT; i++)
+    {
+        if (identIs(RULE_FUNCTIONS[i].name))
+            return parseCall(RULE_FUNCTIONS[i]);
+    }
+    fail("unknown function");
+    return term;
+}
+
+RuleCompiler::Term RuleCompiler::parseCall(const RuleFunctionInfo &info)
+{
+    uint8_t cost = RULE_FUNCTION_COSTS[info.function];
+    Term term = {program->codeLength, 0, (uint16_t)(cost & ~RULE_COST_STATEFUL), (cost & RULE_COST_STATEFUL) != 0};
+
+    next();
+    int args = 0;
+    RuleTimerType timerType = timerTypeOf(info.function);
+    if (token == TOK_LPAREN)
+    {
+        next();
+        if (timerType != TIMER_UNUSED && token != TOK_RPAREN)
+        {
+            if (!parseTimerSlot(timerType))
+                return term;
+            args++;
+            if (token == TOK_COMMA)
+                next();
+        }
+        while (!failed && token != TOK_RPAREN)
+        {
+            Term arg = parseOr();
+            term.cost += arg.cost;
+            term.stateful |= arg.stateful;
+            args++;
+            if (token != TOK_COMMA)
+                break;
+            next();
+        }
+        if (!expect(TOK_RPAREN, "')'"))
+            return term;
+    }
+
+    if (args != info.args)
+    {
+        char message[48];
+        snprintf(message, sizeof(message), "%s() takes %u argument%s", info.name, info.args,
+                 info.args == 1 ? "" : "s");
+        fail(message);
+        return term;
+    }
+    inputs |= RULE_FUNCTION_INPUTS[info.function];
+    emitOp(RULE_OP_CALL, args, 1);
+    emit(info.function);
+    emit(args);
+    term.length = program->codeLength - term.start;
+    return term;
+}
+
+// Timer slot argument: a number, or a name that gets a free slot
+bool RuleCompiler::parseTimerSlot(RuleTimerType type)
+{
+    int slot = -1;
+    if (token == TOK_NUMBER)
+    {
+        if (tokenValue >= RuleTimers::MAX_TIMERS)
+        {
+            fail("timer slot must be 0-31");
+            return false;
+        }
+        slot = tokenValue;
+        if (program->timerNames[slot][0] != '\0')
+        {
+            fail("timer slot already named");
+            return false;
+        }
+    }
+    else if (token == TOK_IDENT)
+    {
+        if (tokenLength >= RuleProgram::MAX_TIMER_NAME)
+        {
+            fail("timer name too long");
+            return false;
+        }
+        for (int i = RuleTimers::MAX_TIMERS - 1; i >= 0 && slot < 0; i--)
+        {
+            if (identIs(program->timerNames[i]))
+                slot = i;
+        }
+        for (int i = RuleTimers::MAX_TIMERS - 1; i >= 0 && slot < 0; i--)
+        {
+            if (program->timerTypes[i] == TIMER_UNUSED)
+            {
+                slot = i;
+                for (size_t c = 0; c < tokenLength; c++)
+                    program->timerNames[i][c] = tolower((unsigned char)tokenStart[c]);
+                program->timerNames[i][tokenLength] = '\0';
+            }
+        }
+        if (slot < 0)
+        {
+            fail("no free timer slot");
+            return false;
+        }
+    }
+    else
+    {
+        fail("expected a timer slot or name");
+        return false;
+    }
+
+    if (program->timerTypes[slot] != TIMER_UNUSED && program->timerTypes[slot] != type)
+    {
+        char message[48];
+        snprintf(message, sizeof(message), "timer used as %s and %s", RuleTimers::typeName(program->timerTypes[slot]),
+                 RuleTimers::typeName(type));
+        fail(message);
+        return false;
+    }
+    program->timerTypes[slot] = type;
+    emitPush(slot);
+    next();
+    return true;
+}
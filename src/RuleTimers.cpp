@@ -0,0 +1,259 @@
+// RuleTimers.cpp
+#include "RuleTimers.h"
+#include "TraceLog.h"
+
+void RuleTimers::reset()
+{
+    for (uint8_t i = 0; i < MAX_TIMERS; i++)
+    {
+        timers[i] = {TIMER_UNUSED, false, false, false, 0, 0, NONE, NONE, NONE};
+    }
+    memset(heads, NONE, sizeof(heads));
+}
+
+void RuleTimers::configure(int slot, RuleTimerType type)
+{
+    if (slot < 0 || slot >= MAX_TIMERS || timers[slot].type == type)
+        return;
+    Timer &timer = timers[slot];
+    if (timer.running)
+        unlink(slot);
+    timer = {type, false, false, false, 0, 0, NONE, NONE, NONE};
+}
+
+// Level 0 holds the timers that run out in the current block of 64 ticks,
+// level 1 those in the current block of 4096, level 2 the rest. A timer
+// moves down a level when its block comes up (cascade).
+void RuleTimers::insert(uint8_t id)
+{
+    Timer &timer = timers[id];
+    uint32_t expiry = timer.expiry;
+    uint8_t bucket;
+    if ((expiry >> BUCKET_BITS) == (currentTick >> BUCKET_BITS))
+        bucket = expiry & (BUCKETS - 1);
+    else if ((expiry >> (2 * BUCKET_BITS)) == (currentTick >> (2 * BUCKET_BITS)))
+        bucket = BUCKETS + ((expiry >> BUCKET_BITS) & (BUCKETS - 1));
+    else
+        bucket = 2 * BUCKETS + ((expiry >> (2 * BUCKET_BITS)) & (BUCKETS - 1));
+
+    timer.bucket = bucket;
+    timer.prev = NONE;
+    timer.next = heads[bucket];
+    if (timer.next != NONE)
+        timers[timer.next].prev = id;
+    heads[bucket] = id;
+    timer.running = true;
+}
+
+void RuleTimers::unlink(uint8_t id)
+{
+    Timer &timer = timers[id];
+    if (timer.prev != NONE)
+        timers[timer.prev].next = timer.next;
+    else
+        heads[timer.bucket] = timer.next;
+    if (timer.next != NONE)
+        timers[timer.next].prev = timer.prev;
+    timer.next = timer.prev = timer.bucket = NONE;
+    timer.running = false;
+}
+
+void RuleTimers::start(uint8_t id, uint32_t seconds)
+{
+    if (timers[id].running)
+        unlink(id);
+    if (seconds == 0)
+    {
+        expire(id);
+        return;
+    }
+    timers[id].expiry = currentTick + (seconds < MAX_TICKS ? seconds : MAX_TICKS);
+    insert(id);
+}
+
+void RuleTimers::cascade(uint8_t level)
+{
+    uint8_t bucket = level * BUCKETS + ((currentTick >> (level * BUCKET_BITS)) & (BUCKETS - 1));
+    uint8_t id = heads[bucket];
+    heads[bucket] = NONE;
+    while (id != NONE)
+    {
+        uint8_t next = timers[id].next;
+        insert(id);
+        id = next;
+    }
+}
+
+void RuleTimers::expire(uint8_t id)
+{
+    Timer &timer = timers[id];
+    timer.running = false;
+    changed = true;
+    if (timer.type == TIMER_ONE_SHOT)
+        timer.fired = true;
+    else if (timer.type == TIMER_RETRIGGER)
+        timer.output = false;
+    // Min-on/min-off only stop holding; the next call follows the input again
+}
+
+bool RuleTimers::advance(MonoTime now)
+{
+    uint32_t target = (uint32_t)(now / MONO_SECOND);
+    if (!started)
+    {
+        currentTick = target;
+        started = true;
+        return true;
+    }
+
+    while (currentTick != target)
+    {
+        currentTick++;
+        if ((currentTick & (BUCKETS - 1)) == 0)
+        {
+            if (((currentTick >> BUCKET_BITS) & (BUCKETS - 1)) == 0)
+                cascade(2);
+            cascade(1);
+        }
+
+        uint8_t bucket = currentTick & (BUCKETS - 1);
+        uint8_t id = heads[bucket];
+        heads[bucket] = NONE;
+        while (id != NONE)
+        {
+            Timer &timer = timers[id];
+            uint8_t next = timer.next;
+            timer.next = timer.prev = timer.bucket = NONE;
+            if (timer.expiry == currentTick)
+                expire(id);
+            else
+                insert(id); // Parked a level up past a block boundary, not due yet
+            id = next;
+        }
+    }
+
+    bool result = changed;
+    changed = false;
+    return result;
+}
+
+RuleTimers::Timer *RuleTimers::use(int slot, RuleTimerType type, int seconds)
+{
+    if (slot < 0 || slot >= MAX_TIMERS)
+    {
+        TRACE(RULE_BAD_TIMER, slot);
+        return nullptr;
+    }
+    configure(slot, type);
+    timers[slot].period = max(seconds, 0);
+    return &timers[slot];
+}
+
+int RuleTimers::latch(int slot, int set, int clear)
+{
+    Timer *timer = use(slot, TIMER_LATCH, 0);
+    if (!timer)
+        return 0;
+    if (!timer->output && set > 0)
+        timer->output = true;
+    else if (timer->output && clear > 0)
+        timer->output = false;
+    return timer->output ? 1 : 0;
+}
+
+int RuleTimers::oneShot(int slot, int trigger, int seconds)
+{
+    Timer *timer = use(slot, TIMER_ONE_SHOT, seconds);
+    if (!timer)
+        return 0;
+    if (!timer->fired && trigger > 0 && !timer->running)
+        start(slot, timer->period);
+    if (timer->fired)
+    {
+        // True for this pass only, so the rule has to run again on the next
+        timer->fired = false;
+        changed = true;
+        return 1;
+    }
+    return 0;
+}
+
+int RuleTimers::retrigger(int slot, int input, int seconds)
+{
+    Timer *timer = use(slot, TIMER_RETRIGGER, seconds);
+    if (!timer)
+        return 0;
+    if (input > 0)
+    {
+        timer->output = true;
+        start(slot, timer->period);
+        return 1;
+    }
+    return timer->output ? 1 : 0;
+}
+
+int RuleTimers::minOn(int slot, int input, int seconds)
+{
+    Timer *timer = use(slot, TIMER_MIN_ON, seconds);
+    if (!timer)
+        return 0;
+    if (input > 0 && !timer->output)
+    {
+        timer->output = true;
+        start(slot, timer->period);
+    }
+    else if (input <= 0 && timer->output && !timer->running)
+    {
+        timer->output = false;
+    }
+    return timer->output ? 1 : 0;
+}
+
+int RuleTimers::minOff(int slot, int input, int seconds)
+{
+    Timer *timer = use(slot, TIMER_MIN_OFF, seconds);
+    if (!timer)
+        return 0;
+    if (input <= 0 && timer->output)
+    {
+        timer->output = false;
+        start(slot, timer->period);
+    }
+    else if (input > 0 && !timer->output && !timer->running)
+    {
+        timer->output = true;
+    }
+    return timer->output ? 1 : 0;
+}
+
+bool RuleTimers::getInfo(int slot, Info &info) const
+{
+    if (slot < 0 || slot >= MAX_TIMERS || timers[slot].type == TIMER_UNUSED)
+        return false;
+    const Timer &timer = timers[slot];
+    info.type = timer.type;
+    info.output = timer.output || timer.fired;
+    info.running = timer.running;
+    info.period = timer.period;
+    info.remaining = timer.running ? timer.expiry - currentTick : 0;
+    return true;
+}
+
+const char *RuleTimers::typeName(RuleTimerType type)
+{
+    switch (type)
+    {
+    case TIMER_LATCH:
+        return "latch";
+    case TIMER_ONE_SHOT:
+        return "oneShot";
+    case TIMER_RETRIGGER:
+        return "retrigger";
+    case TIMER_MIN_ON:
+        return "minOn";
+    case TIMER_MIN_OFF:
+        return "minOff";
+    default:
+        return "unused";
+    }
+}
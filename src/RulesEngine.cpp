@@ -1,264 +1,455 @@
 // SimpleRuleEngine.cpp
 #include "RulesEngine.h"
 
-HomeSocketDevice *SimpleRuleEngine::getSocket(int socket_number)
+bool SimpleRuleEngine::hasSocket(int socket_number)
 {
     if (socket_number < 1 || socket_number > MAX_SOCKETS)
     {
-        Serial.printf("Invalid socket number: %d\n", socket_number);
-        return nullptr;
+        TRACE(RULE_BAD_SOCKET, socket_number);
+        return false;
     }
-    return sockets[socket_number - 1];
+    return deviceLink.hasSocket(socket_number - 1);
 }
 
-int SimpleRuleEngine::TurnUntil(int memoryIndex, int turnOnCondition, int turnOffCondition)
+bool SimpleRuleEngine::socketIsOn(int socket_number)
+{
+    return deviceLink.getSnapshot().isOn(socket_number - 1);
+}
+
+bool SimpleRuleEngine::loadRules(const char *path)
 {
-    if (memoryIndex < 0 || memoryIndex >= MEMORY_SLOTS)
+    if (!SPIFFS.exists(path))
     {
-        Serial.printf("Memory slot %d out of range!\n", memoryIndex);
-        return 0;
+        Serial.printf("Rules > %s not found, no rules active\n", path);
+        program.ruleCount = 0;
+        return false;
     }
 
-    if (!memory[memoryIndex] && turnOnCondition)
+    File file = SPIFFS.open(path, "r");
+    size_t size = file ? file.size() : 0;
+    if (!file || size > MAX_RULES_SIZE)
     {
-        memory[memoryIndex] = true;
+        Serial.printf("Rules > Cannot read %s (%lu bytes, max %lu)\n", path, (unsigned long)size,
+                      (unsigned long)MAX_RULES_SIZE);
+        return false;
     }
-    else if (memory[memoryIndex] && turnOffCondition)
+
+    // Only needed while compiling, the bytecode is all that is kept
+    char *text = new char[size + 1];
+    size_t length = file.read((uint8_t *)text, size);
+    file.close();
+    bool ok = compileRules(text, length);
+    delete[] text;
+    return ok;
+}
+
+bool SimpleRuleEngine::compileRules(const char *text, size_t length)
+{
+    // Compile into a scratch program, so a bad file keeps the old rules
+    RuleProgram *compiled = new RuleProgram();
+    RuleCompiler compiler;
+    bool ok = compiler.compile(text, length, *compiled);
+    if (ok)
     {
-        memory[memoryIndex] = false;
+        program = *compiled;
+        lastError[0] = '\0';
+        changedInputs = RULE_INPUT_ALL;
+        // Timers keep running across a reload unless their slot changed kind
+        for (int i = 0; i < RuleTimers::MAX_TIMERS; i++)
+        {
+            timers.configure(i, program.timerTypes[i]);
+        }
+        Serial.printf("Rules > %u rules compiled to %u bytes\n", program.ruleCount, program.codeLength);
     }
+    else
+    {
+        strncpy(lastError, compiler.getError(), sizeof(lastError) - 1);
+        lastError[sizeof(lastError) - 1] = '\0';
+        Serial.printf("Rules > %s\n", lastError);
+    }
+    delete compiled;
+    return ok;
+}
 
-    return memory[memoryIndex] ? 1 : 0;
+bool SimpleRuleEngine::controlsSocket(int socket_number) const
+{
+    for (uint8_t i = 0; i < program.ruleCount; i++)
+    {
+        if (program.rules[i].socket == socket_number)
+            return true;
+    }
+    return false;
+}
+
+void SimpleRuleEngine::evaluate()
+{
+    if (program.ruleCount == 0)
+        return;
+
+    const TimeContext &time = timeSync.now();
+    if (time.minuteOfDay != lastMinuteOfDay || time.weekday != lastWeekday)
+    {
+        lastMinuteOfDay = time.minuteOfDay;
+        lastWeekday = time.weekday;
+        changedInputs |= RULE_INPUT_CLOCK;
+    }
+    if (timers.advance(monoNow()))
+        changedInputs |= RULE_INPUT_TIMERS;
+
+    // Rules whose inputs did not change keep their last result. Taken before
+    // the rules run, so switching a socket below counts for the next pass.
+    uint8_t changed = changedInputs | RULE_INPUT_SECONDS;
+    changedInputs = 0;
+    if (changed & RULE_INPUT_LIGHT)
+        updateLightLevel();
+
+    for (uint8_t i = 0; i < program.ruleCount; i++)
+    {
+        const Rule &rule = program.rules[i];
+        if ((rule.inputs & changed) || trace || changed == RULE_INPUT_ALL)
+        {
+            results[i] = run(rule);
+            rulesRun++;
+        }
+        else
+        {
+            rulesSkipped++;
+        }
+        if (rule.turnOn)
+            turnOn(rule.socket, results[i]);
+        else
+            turnOff(rule.socket, results[i]);
+    }
+}
+
+// Stack machine over the compiled code. The compiler has checked arity,
+// stack depth and jump targets, so there are no checks here beyond the
+// opcode itself.
+int SimpleRuleEngine::run(const Rule &rule)
+{
+    int16_t stack[RuleProgram::STACK_DEPTH];
+    int sp = 0;
+    const uint8_t *pc = program.code + rule.start;
+    const uint8_t *end = pc + rule.length;
+
+    while (pc < end)
+    {
+        switch (*pc++)
+        {
+        case RULE_OP_PUSH:
+            stack[sp++] = (int16_t)(pc[0] | (pc[1] << 8));
+            pc += 2;
+            break;
+        case RULE_OP_CALL:
+        {
+            uint8_t function = pc[0];
+            uint8_t args = pc[1];
+            pc += 2;
+            sp -= args;
+            stack[sp] = callFunction(function, stack + sp);
+            sp++;
+            break;
+        }
+        case RULE_OP_AND:
+            sp--;
+            stack[sp - 1] = AND(stack[sp - 1], stack[sp]);
+            break;
+        case RULE_OP_OR:
+            sp--;
+            stack[sp - 1] = OR(stack[sp - 1], stack[sp]);
+            break;
+        case RULE_OP_NOT:
+            stack[sp - 1] = NOT(stack[sp - 1]);
+            break;
+        case RULE_OP_JUMP_IF_FALSE:
+        case RULE_OP_JUMP_IF_TRUE:
+        {
+            bool onTrue = pc[-1] == RULE_OP_JUMP_IF_TRUE;
+            uint16_t offset = pc[0] | (pc[1] << 8);
+            pc += 2;
+            if ((stack[sp - 1] > 0) == onTrue)
+            {
+                stack[sp - 1] = onTrue ? 1 : 0;
+                pc += offset;
+                if (trace)
+                    TRACE(RULE_SHORT_CIRCUIT, stack[sp - 1]);
+            }
+            else
+            {
+                sp--;
+            }
+            break;
+        }
+        case RULE_OP_BOOL:
+            stack[sp - 1] = stack[sp - 1] > 0 ? 1 : 0;
+            break;
+        default:
+            TRACE(RULE_BAD_OPCODE, rule.line);
+            return 0;
+        }
+    }
+    return sp > 0 ? stack[sp - 1] : 0;
+}
+
+int SimpleRuleEngine::callFunction(uint8_t function, const int16_t *args)
+{
+    switch (function)
+    {
+    case RULE_FN_AFTER:
+        return after(args[0]);
+    case RULE_FN_BEFORE:
+        return before(args[0]);
+    case RULE_FN_BETWEEN:
+        return between(args[0], args[1]);
+    case RULE_FN_WEEKDAY:
+        return isWeekday(args[0]);
+    case RULE_FN_LIGHT_ABOVE:
+        return lightSensorAbove(args[0]);
+    case RULE_FN_LIGHT_BELOW:
+        return lightSensorBelow(args[0]);
+    case RULE_FN_EXPORT_ABOVE:
+        return exportAbove(args[0]);
+    case RULE_FN_EXPORT_BELOW:
+        return exportBelow(args[0]);
+    case RULE_FN_IMPORT_ABOVE:
+        return importAbove(args[0]);
+    case RULE_FN_IMPORT_BELOW:
+        return importBelow(args[0]);
+    case RULE_FN_AVG_EXPORT_ABOVE:
+        return avgExportAbove(args[0], args[1]);
+    case RULE_FN_PING_FOUND:
+        return pingFound();
+    case RULE_FN_PING_NOT_FOUND:
+        return pingNotFound();
+    case RULE_FN_IS_ON:
+        return isOn(args[0]);
+    case RULE_FN_IS_OFF:
+        return isOff(args[0]);
+    case RULE_FN_ON_FOR:
+        return hasBeenOnFor(args[0], args[1]);
+    case RULE_FN_OFF_FOR:
+        return hasBeenOffFor(args[0], args[1]);
+    case RULE_FN_TURN_UNTIL:
+        return TurnUntil(args[0], args[1], args[2]);
+    case RULE_FN_DELAY:
+        return Delay(args[0], args[1]);
+    case RULE_FN_ONE_SHOT:
+        return oneShot(args[0], args[1], args[2]);
+    case RULE_FN_RETRIGGER:
+        return retrigger(args[0], args[1], args[2]);
+    case RULE_FN_MIN_ON:
+        return minOn(args[0], args[1], args[2]);
+    case RULE_FN_MIN_OFF:
+        return minOff(args[0], args[1], args[2]);
+    default:
+        return 0;
+    }
+}
+
+int SimpleRuleEngine::parseTime(const char *timeStr)
+{
+    if (!timeStr)
+        return -1;
+
+    int hour = 0;
+    int digits = 0;
+    while (isdigit((unsigned char)*timeStr) && digits < 2)
+    {
+        hour = hour * 10 + (*timeStr++ - '0');
+        digits++;
+    }
+    if (digits == 0 || *timeStr++ != ':' || !isdigit((unsigned char)timeStr[0]) ||
+        !isdigit((unsigned char)timeStr[1]) || timeStr[2] != '\0')
+        return -1;
+
+    int minute = (timeStr[0] - '0') * 10 + (timeStr[1] - '0');
+    if (hour > 23 || minute > 59)
+        return -1;
+    return hour * 60 + minute;
+}
+
+int SimpleRuleEngine::TurnUntil(int memoryIndex, int turnOnCondition, int turnOffCondition)
+{
+    return timers.latch(memoryIndex, turnOnCondition, turnOffCondition);
 }
 
 void SimpleRuleEngine::updateLightLevel()
 {
     current_lux = sensors.getLightLevel();
-    Serial.printf("Current light level: %.1f lux\n", current_lux);
+    if (trace)
+        TRACE(RULE_LIGHT_LEVEL, current_lux);
 }
 
 int SimpleRuleEngine::lightSensorAbove(int lux_value)
 {
     int result = (current_lux > lux_value) ? 1 : 0;
-    Serial.printf("Light > %d lux: %s\n", lux_value, result ? "true" : "false");
+    if (trace)
+        TRACE(RULE_LIGHT_ABOVE, lux_value, result);
     return result;
 }
 
 int SimpleRuleEngine::lightSensorBelow(int lux_value)
 {
     int result = (current_lux < lux_value) ? 1 : 0;
-    Serial.printf("Light < %d lux: %s\n", lux_value, result ? "true" : "false");
+    if (trace)
+        TRACE(RULE_LIGHT_BELOW, lux_value, result);
     return result;
 }
 
-int SimpleRuleEngine::after(const char *timeStr)
+int SimpleRuleEngine::exportAbove(int watts)
 {
-    int hour, minute;
-    sscanf(timeStr, "%d:%d", &hour, &minute);
-
-    int currentHour, currentMinute;
-    timeSync.getCurrentHourMinute(currentHour, currentMinute);
-
-    int currentMins = currentHour * 60 + currentMinute;
-    int targetMins = hour * 60 + minute;
+    const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+    return (devices.p1Connected && devices.exportPower > watts) ? 1 : 0;
+}
 
-    int result = (currentMins >= targetMins) ? 1 : 0;
-    Serial.printf("After %s: %s\n", timeStr, result ? "true" : "false");
-    return result;
+int SimpleRuleEngine::exportBelow(int watts)
+{
+    const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+    return (devices.p1Connected && devices.exportPower < watts) ? 1 : 0;
 }
 
-int SimpleRuleEngine::before(const char *timeStr)
+int SimpleRuleEngine::importAbove(int watts)
 {
-    int hour, minute;
-    sscanf(timeStr, "%d:%d", &hour, &minute);
+    const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+    return (devices.p1Connected && devices.importPower > watts) ? 1 : 0;
+}
 
-    int currentHour, currentMinute;
-    timeSync.getCurrentHourMinute(currentHour, currentMinute);
+int SimpleRuleEngine::importBelow(int watts)
+{
+    const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+    return (devices.p1Connected && devices.importPower < watts) ? 1 : 0;
+}
 
-    int currentMins = currentHour * 60 + currentMinute;
-    int targetMins = hour * 60 + minute;
+int SimpleRuleEngine::avgExportAbove(int watts, int minutes)
+{
+    if (minutes <= 0)
+        return 0;
+    PowerHistory::Aggregate recent = powerHistory.aggregate(monoUptimeSeconds(), minutes * 60UL);
+    return (recent.buckets > 0 && -recent.avgW > watts) ? 1 : 0;
+}
 
-    int result = (currentMins < targetMins) ? 1 : 0;
-    Serial.printf("Before %s: %s\n", timeStr, result ? "true" : "false");
-    return result;
+int SimpleRuleEngine::after(const char *timeStr)
+{
+    return after(parseTime(timeStr));
 }
 
-int SimpleRuleEngine::OR(int func1, int func2)
+int SimpleRuleEngine::before(const char *timeStr)
 {
-    int result = ((func1 > 0) || (func2 > 0)) ? 1 : 0;
-    Serial.printf("OR operation: %d OR %d = %d\n", func1, func2, result);
-    return result;
+    return before(parseTime(timeStr));
 }
 
-int SimpleRuleEngine::AND(int func1, int func2)
+int SimpleRuleEngine::after(int minuteOfDay)
 {
-    int result = ((func1 > 0) && (func2 > 0)) ? 1 : 0;
-    Serial.printf("AND operation: %d AND %d = %d\n", func1, func2, result);
+    if (minuteOfDay < 0)
+        return 0;
+
+    int currentMins = timeSync.now().minuteOfDay;
+
+    int result = (currentMins >= minuteOfDay) ? 1 : 0;
+    if (trace)
+        TRACE(RULE_AFTER, minuteOfDay / 60, minuteOfDay % 60, result);
     return result;
 }
 
-int SimpleRuleEngine::NOT(int func)
+int SimpleRuleEngine::before(int minuteOfDay)
 {
-    int result = (func <= 0) ? 1 : 0;
-    Serial.printf("NOT operation: NOT %d = %d\n", func, result);
+    if (minuteOfDay < 0)
+        return 0;
+
+    int currentMins = timeSync.now().minuteOfDay;
+
+    int result = (currentMins < minuteOfDay) ? 1 : 0;
+    if (trace)
+        TRACE(RULE_BEFORE, minuteOfDay / 60, minuteOfDay % 60, result);
     return result;
 }
 
-int SimpleRuleEngine::turnOnInbetween(const char *startTime, const char *endTime)
+int SimpleRuleEngine::between(int startMinute, int endMinute)
 {
-    int currentHour, currentMinute;
-    timeSync.getCurrentHourMinute(currentHour, currentMinute);
-    int currentMinutes = currentHour * 60 + currentMinute;
-
-    // Parse start time
-    int startHours, startMinutes;
-    sscanf(startTime, "%d:%d", &startHours, &startMinutes);
-    int startTotalMinutes = startHours * 60 + startMinutes;
+    if (startMinute < 0 || endMinute < 0)
+        return 0;
 
-    // Parse end time
-    int endHours, endMinutes;
-    sscanf(endTime, "%d:%d", &endHours, &endMinutes);
-    int endTotalMinutes = endHours * 60 + endMinutes;
+    int currentMinutes = timeSync.now().minuteOfDay;
 
     int result;
     // Handle cases where the period crosses midnight
-    if (startTotalMinutes <= endTotalMinutes)
+    if (startMinute <= endMinute)
     {
         // Normal case (e.g., 21:00 to 23:00)
-        result = (currentMinutes >= startTotalMinutes && currentMinutes < endTotalMinutes) ? 1 : 0;
+        result = (currentMinutes >= startMinute && currentMinutes < endMinute) ? 1 : 0;
     }
     else
     {
         // Crosses midnight (e.g., 23:00 to 06:00)
-        result = (currentMinutes >= startTotalMinutes || currentMinutes < endTotalMinutes) ? 1 : 0;
+        result = (currentMinutes >= startMinute || currentMinutes < endMinute) ? 1 : 0;
     }
 
-    Serial.printf("Time between %s and %s: %s\n", startTime, endTime, result ? "true" : "false");
+    if (trace)
+        TRACE(RULE_BETWEEN, startMinute / 60, startMinute % 60, endMinute / 60, endMinute % 60, result);
     return result;
 }
 
-int SimpleRuleEngine::turnOnBefore(const char *timeStr)
+int SimpleRuleEngine::OR(int func1, int func2)
 {
-    int currentHour, currentMinute;
-    timeSync.getCurrentHourMinute(currentHour, currentMinute);
-    int currentMinutes = currentHour * 60 + currentMinute;
-
-    // Parse input time string (format: "HH:MM")
-    int hours, minutes;
-    sscanf(timeStr, "%d:%d", &hours, &minutes);
-    int targetMinutes = hours * 60 + minutes;
-
-    int result = (currentMinutes < targetMinutes) ? 1 : 0;
-    Serial.printf("Turn on before %s: %s\n", timeStr, result ? "true" : "false");
+    int result = ((func1 > 0) || (func2 > 0)) ? 1 : 0;
+    if (trace)
+        TRACE(RULE_OR, func1, func2, result);
     return result;
 }
 
-int SimpleRuleEngine::turnOnAfter(const char *startTime)
+int SimpleRuleEngine::AND(int func1, int func2)
 {
-    int currentHour, currentMinute;
-    timeSync.getCurrentHourMinute(currentHour, currentMinute);
-    int currentMinutes = currentHour * 60 + currentMinute;
-
-    // Parse start time
-    int startHours, startMinutes;
-    sscanf(startTime, "%d:%d", &startHours, &startMinutes);
-    int startTotalMinutes = startHours * 60 + startMinutes;
-
-    int result = (currentMinutes >= startTotalMinutes) ? 1 : 0;
-    Serial.printf("Turn on after %s: %s\n", startTime, result ? "true" : "false");
+    int result = ((func1 > 0) && (func2 > 0)) ? 1 : 0;
+    if (trace)
+        TRACE(RULE_AND, func1, func2, result);
     return result;
 }
 
-int SimpleRuleEngine::turnOffAfter(const char *startTime)
+int SimpleRuleEngine::NOT(int func)
 {
-    int currentHour, currentMinute;
-    timeSync.getCurrentHourMinute(currentHour, currentMinute);
-    int currentMinutes = currentHour * 60 + currentMinute;
-
-    // Parse start time
-    int startHours, startMinutes;
-    sscanf(startTime, "%d:%d", &startHours, &startMinutes);
-    int startTotalMinutes = startHours * 60 + startMinutes;
-
-    int result = (currentMinutes < startTotalMinutes) ? 1 : 0; // Return 1 BEFORE the time, 0 after
-    Serial.printf("Turn off after %s: %s\n", startTime, result ? "true" : "false");
+    int result = (func <= 0) ? 1 : 0;
+    if (trace)
+        TRACE(RULE_NOT, func, result);
     return result;
 }
 
-int SimpleRuleEngine::isWeekday(uint8_t dayPattern)
+int SimpleRuleEngine::turnOnInbetween(const char *startTime, const char *endTime)
 {
-    int currentHour, currentMinute;
-    timeSync.getCurrentHourMinute(currentHour, currentMinute);
-
-    // Get current weekday (0 = Sunday, 1 = Monday, ..., 6 = Saturday)
-    time_t now;
-    time(&now);
-    struct tm timeinfo;
-    localtime_r(&now, &timeinfo);
-    int today = timeinfo.tm_wday; // 0-6, Sunday=0
-
-    // Convert weekday to our bit pattern (1 << 0 for Sunday, 1 << 1 for Monday, etc)
-    uint8_t todayBit = (1 << today);
+    return between(parseTime(startTime), parseTime(endTime));
+}
 
-    int result = (dayPattern & todayBit) ? 1 : 0;
-    Serial.printf("Day check (pattern: 0x%02X): %s\n", dayPattern, result ? "true" : "false");
-    return result;
+int SimpleRuleEngine::turnOnBefore(const char *timeStr)
+{
+    return before(parseTime(timeStr));
 }
 
-int SimpleRuleEngine::setMem(int slot, unsigned long value)
+int SimpleRuleEngine::turnOnAfter(const char *startTime)
 {
-    if (slot < 0 || slot >= MEMORY_SLOTS)
-    {
-        Serial.printf("Memory slot %d out of range!\n", slot);
-        return 0;
-    }
+    return after(parseTime(startTime));
+}
 
-    memory[slot] = value;
-    Serial.printf("Set memory slot %d to %lu\n", slot, value);
-    return 1;
+int SimpleRuleEngine::turnOffAfter(const char *startTime)
+{
+    return before(parseTime(startTime)); // Return 1 BEFORE the time, 0 after
 }
 
-int SimpleRuleEngine::readMem(int slot)
+int SimpleRuleEngine::isWeekday(uint8_t dayPattern)
 {
-    if (slot < 0 || slot >= MEMORY_SLOTS)
-    {
-        Serial.printf("Memory slot %d out of range!\n", slot);
-        return 0;
-    }
+    // Bit pattern as in the day constants: 1 << 0 for Sunday, 1 << 1 for Monday, etc
+    uint8_t todayBit = timeSync.now().weekdayBit;
 
-    unsigned long value = memory[slot];
-    Serial.printf("Read memory slot %d: %lu\n", slot, value);
-    return value;
+    int result = (dayPattern & todayBit) ? 1 : 0;
+    if (trace)
+        TRACE(RULE_WEEKDAY, dayPattern, result);
+    return result;
 }
 
 int SimpleRuleEngine::Delay(int memSlot, int triggerFunction)
 {
-    unsigned long currentMillis = millis();
-
-    // If trigger function is true and timer isn't running
-    if (triggerFunction && readMem(memSlot) == 0)
-    {
-        setMem(memSlot, currentMillis);
-        Serial.printf("Starting delay in slot %d\n", memSlot);
-        return 0;
-    }
-
-    // If timer is running
-    if (readMem(memSlot) > 0)
-    {
-        const unsigned long DELAY_PERIOD = 5 * 60 * 1000; // 5 minutes in milliseconds
-
-        if (currentMillis - readMem(memSlot) >= DELAY_PERIOD)
-        {
-            setMem(memSlot, 0); // Reset timer
-            Serial.printf("Delay completed in slot %d\n", memSlot);
-            return 1;
-        }
-        Serial.printf("Delay still running in slot %d\n", memSlot);
-        return 0;
-    }
-
-    return 0;
+    int result = timers.oneShot(memSlot, triggerFunction, DELAY_SECONDS);
+    if (trace && result)
+        TRACE(RULE_DELAY_DONE, memSlot);
+    return result;
 }
 
 int SimpleRuleEngine::pingFound()
@@ -266,28 +457,30 @@ int SimpleRuleEngine::pingFound()
     if (phoneCheck)
     {
         int result = phoneCheck->isDevicePresent() ? 1 : 0;
-        Serial.printf("Phone present: %s\n", result ? "true" : "false");
+        if (trace)
+            TRACE(RULE_PHONE_PRESENT, result);
         return result;
     }
-    Serial.println("Phone check not configured");
+    if (trace)
+        TRACE(RULE_NO_PHONE_CHECK);
     return 0;
 }
 
 int SimpleRuleEngine::pingNotFound()
 {
     int result = 1 - pingFound();
-    Serial.printf("Phone absent: %s\n", result ? "true" : "false");
+    if (trace)
+        TRACE(RULE_PHONE_ABSENT, result);
     return result;
 }
 
 int SimpleRuleEngine::isOn(int socket_number)
 {
-    HomeSocketDevice *socket = getSocket(socket_number);
-    if (!socket)
+    if (!hasSocket(socket_number))
         return 0;
 
     updateSocketDuration(socket_number);
-    return socket->getCurrentState() ? 1 : 0;
+    return socketIsOn(socket_number) ? 1 : 0;
 }
 
 int SimpleRuleEngine::isOff(int socket_number)
@@ -303,114 +496,92 @@ void SimpleRuleEngine::updateSocketDuration(int socket_number)
     int idx = socket_number - 1;
     SocketState &state = socketStates[idx];
 
-    // Get current time
-    int currentHour, currentMinute;
-    timeSync.getCurrentHourMinute(currentHour, currentMinute);
-
     // If state changed, update timestamps
-    HomeSocketDevice *socket = getSocket(socket_number);
-    if (socket && socket->getCurrentState() != state.currentState)
+    if (hasSocket(socket_number) && socketIsOn(socket_number) != state.currentState)
     {
-        state.currentState = socket->getCurrentState();
-        state.lastStateChange = millis();
-        state.lastChangeHour = currentHour;
-        state.lastChangeMinute = currentMinute;
-        state.stateChangeProcessed = false;
-
-        Serial.printf("Socket %d state changed to: %s at %02d:%02d\n",
-                      socket_number, state.currentState ? "ON" : "OFF",
-                      currentHour, currentMinute);
+        const TimeContext &time = timeSync.now();
+
+        state.currentState = socketIsOn(socket_number);
+        state.lastStateChange = monoNow();
+        state.lastChangeHour = time.hour;
+        state.lastChangeMinute = time.minute;
+
+        TRACE(RULE_SOCKET_CHANGED, socket_number, state.currentState, time.hour, time.minute);
     }
 }
 
 void SimpleRuleEngine::turnOn(int socket_number, int condition)
 {
-    Serial.printf("\nEvaluating ON rule for socket %d\n", socket_number);
-    Serial.printf("Condition result: %s\n", condition ? "true" : "false");
+    if (trace)
+        TRACE(RULE_EVAL_ON, socket_number, condition);
 
-    HomeSocketDevice *socket = getSocket(socket_number);
-    if (!socket)
+    if (!hasSocket(socket_number))
         return;
 
-    int idx = socket_number - 1;
-    SocketState &state = socketStates[idx];
-
-    // Only turn on if not already on and condition is true
-    if (condition && (!socket->getCurrentState() || !state.stateChangeProcessed))
+    // Only turn on if not already on (or being switched on) and condition is true.
+    // Min on/off times and a max-on force-off hold it back, tried again next pass.
+    if (condition && !socketIsOn(socket_number) && canChangeState(socket_number - 1, true))
     {
-        Serial.printf("→ Turning ON socket %d\n", socket_number);
-        socket->setState(true);
-        state.stateChangeProcessed = true;
-    }
-    else
-    {
-        Serial.printf("→ No action for socket %d\n", socket_number);
+        TRACE(RULE_TURN_ON, socket_number);
+        if (deviceLink.requestSocketState(socket_number - 1, true))
+            socketRegistry.markChanged(socket_number - 1, monoNow());
+        inputChanged(RULE_INPUT_SOCKETS);
     }
 
     updateSocketDuration(socket_number);
-    Serial.println("----------------------------------------");
 }
 
 void SimpleRuleEngine::turnOff(int socket_number, int condition)
 {
-    Serial.printf("\nEvaluating OFF rule for socket %d\n", socket_number);
-    Serial.printf("Condition result: %s\n", condition ? "true" : "false");
+    if (trace)
+        TRACE(RULE_EVAL_OFF, socket_number, condition);
 
-    HomeSocketDevice *socket = getSocket(socket_number);
-    if (!socket)
+    if (!hasSocket(socket_number))
         return;
 
-    int idx = socket_number - 1;
-    SocketState &state = socketStates[idx];
-
-    // Only turn off if not already off and condition is true
-    if (condition && (socket->getCurrentState() || !state.stateChangeProcessed))
+    // Only turn off if not already off (or being switched off) and condition is true.
+    // Min on/off times and a max-on force-off hold it back, tried again next pass.
+    if (condition && socketIsOn(socket_number) && canChangeState(socket_number - 1, false))
     {
-        Serial.printf("→ Turning OFF socket %d\n", socket_number);
-        socket->setState(false);
-        state.stateChangeProcessed = true;
-    }
-    else
-    {
-        Serial.printf("→ No action for socket %d\n", socket_number);
+        TRACE(RULE_TURN_OFF, socket_number);
+        if (deviceLink.requestSocketState(socket_number - 1, false))
+            socketRegistry.markChanged(socket_number - 1, monoNow());
+        inputChanged(RULE_INPUT_SOCKETS);
     }
 
     updateSocketDuration(socket_number);
-    Serial.println("----------------------------------------");
 }
 
 int SimpleRuleEngine::hasBeenOnFor(int socket_number, int minutes)
 {
-    HomeSocketDevice *socket = getSocket(socket_number);
-    if (!socket || !socket->getCurrentState())
+    if (!hasSocket(socket_number) || !socketIsOn(socket_number))
         return 0;
 
     int idx = socket_number - 1;
     SocketState &state = socketStates[idx];
 
-    unsigned long duration = (millis() - state.lastStateChange) / (60 * 1000);
+    long duration = (long)((monoNow() - state.lastStateChange) / MONO_MINUTE);
     int result = (duration >= minutes) ? 1 : 0;
 
-    Serial.printf("Socket %d has been ON for %lu minutes (target: %d): %s\n",
-                  socket_number, duration, minutes, result ? "true" : "false");
+    if (trace)
+        TRACE(RULE_ON_FOR, socket_number, duration, minutes, result);
 
     return result;
 }
 
 int SimpleRuleEngine::hasBeenOffFor(int socket_number, int minutes)
 {
-    HomeSocketDevice *socket = getSocket(socket_number);
-    if (!socket || socket->getCurrentState())
+    if (!hasSocket(socket_number) || socketIsOn(socket_number))
         return 0;
 
     int idx = socket_number - 1;
     SocketState &state = socketStates[idx];
 
-    unsigned long duration = (millis() - state.lastStateChange) / (60 * 1000);
+    long duration = (long)((monoNow() - state.lastStateChange) / MONO_MINUTE);
     int result = (duration >= minutes) ? 1 : 0;
 
-    Serial.printf("Socket %d has been OFF for %lu minutes (target: %d): %s\n",
-                  socket_number, duration, minutes, result ? "true" : "false");
+    if (trace)
+        TRACE(RULE_OFF_FOR, socket_number, duration, minutes, result);
 
     return result;
-}
\ No newline at end of file
+}
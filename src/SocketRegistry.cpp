@@ -0,0 +1,142 @@
+// SocketRegistry.cpp
+#include "SocketRegistry.h"
+
+static bool isAddress(const char *address)
+{
+    return address && address[0] && strcmp(address, "0") != 0 && strcmp(address, "null") != 0;
+}
+
+int SocketRegistry::parseTime(const char *text)
+{
+    int hour, minute;
+    if (!text || sscanf(text, "%d:%d", &hour, &minute) != 2 || hour < 0 || hour > 23 || minute < 0 || minute > 59)
+        return -1;
+    return hour * 60 + minute;
+}
+
+SocketRegistry::Logic SocketRegistry::parseLogic(const char *text)
+{
+    if (text && strcmp(text, "surplus") == 0)
+        return LOGIC_SURPLUS;
+    if (text && strcmp(text, "evening") == 0)
+        return LOGIC_EVENING;
+    return LOGIC_NONE;
+}
+
+const char *SocketRegistry::logicName(Logic type)
+{
+    switch (type)
+    {
+    case LOGIC_SURPLUS:
+        return "surplus";
+    case LOGIC_EVENING:
+        return "evening";
+    default:
+        return "none";
+    }
+}
+
+bool SocketRegistry::add(const char *address, const char *name, Logic type, uint16_t after, uint16_t lux)
+{
+    if (count >= MAX_SOCKETS)
+    {
+        Serial.printf("Sockets > More than %u sockets, %s ignored\n", MAX_SOCKETS, address);
+        return false;
+    }
+    addresses[count] = address;
+    if (name && name[0])
+        strncpy(names[count], name, MAX_NAME - 1);
+    else
+        snprintf(names[count], MAX_NAME, "Socket %u", count + 1);
+    names[count][MAX_NAME - 1] = '\0';
+    logic[count] = type;
+    afterMinute[count] = after;
+    darkLux[count] = lux;
+    count++;
+    return true;
+}
+
+void SocketRegistry::load(JsonObjectConst config)
+{
+    count = 0;
+    JsonArrayConst list = config["sockets"];
+    if (!list.isNull())
+    {
+        for (JsonObjectConst entry : list)
+        {
+            const char *address = entry["ip"];
+            if (!isAddress(address))
+                continue;
+            int after = parseTime(entry["after"] | "00:00");
+            add(address, entry["name"], parseLogic(entry["logic"]), after < 0 ? 0 : after, entry["lux"] | 50);
+        }
+        return;
+    }
+
+    // Legacy config: three fixed sockets
+    const char *legacy[] = {config["socket_1"], config["socket_2"], config["socket_3"]};
+    if (isAddress(legacy[0]))
+        add(legacy[0], nullptr, LOGIC_SURPLUS, 0, 0);
+    if (isAddress(legacy[1]))
+        add(legacy[1], nullptr, LOGIC_EVENING, 17 * 60 + 45, 75);
+    if (isAddress(legacy[2]))
+        add(legacy[2], nullptr, LOGIC_EVENING, 17 * 60 + 30, 50);
+}
+
+void SocketRegistry::createDevices()
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (devices[i])
+            continue;
+        devices[i] = new HomeSocketDevice(i + 1, addresses[i].c_str());
+        Serial.printf("Socket %u (%s, %s) initialized at: %s\n", i + 1, names[i], logicName(logic[i]),
+                      addresses[i].c_str());
+    }
+}
+
+void SocketRegistry::resetTimes(MonoTime now)
+{
+    for (uint8_t i = 0; i < MAX_SOCKETS; i++)
+    {
+        lastChange[i] = now;
+    }
+    forcedOff = 0;
+}
+
+bool SocketRegistry::canChange(int index, bool newState, MonoTime now, MonoTime minOnTime, MonoTime minOffTime)
+{
+    MonoTime timeSinceChange = now - lastChange[index];
+    uint32_t bit = 1UL << index;
+
+    if (newState)
+    { // Turning ON
+        if ((forcedOff & bit) && timeSinceChange < minOffTime)
+            return false;
+        forcedOff &= ~bit;
+    }
+    else
+    { // Turning OFF
+        if (timeSinceChange < minOnTime)
+            return false;
+    }
+    return true;
+}
+
+uint32_t SocketRegistry::expireMaxOnTime(uint32_t onMask, MonoTime now, MonoTime maxOnTime)
+{
+    uint32_t expired = 0;
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (now - lastChange[i] > maxOnTime)
+            expired |= 1UL << i;
+    }
+    expired &= onMask;
+
+    forcedOff |= expired;
+    for (uint32_t bits = expired; bits; bits &= bits - 1)
+    {
+        lastChange[__builtin_ctz(bits)] = now;
+    }
+    return expired;
+}
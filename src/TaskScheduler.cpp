@@ -0,0 +1,135 @@
+// TaskScheduler.cpp
+#include "TaskScheduler.h"
+#include "TraceLog.h"
+
+bool TaskScheduler::runsBefore(uint8_t a, uint8_t b) const
+{
+    if (tasks[a].nextDue != tasks[b].nextDue)
+        return tasks[a].nextDue < tasks[b].nextDue;
+    return tasks[a].priority < tasks[b].priority;
+}
+
+void TaskScheduler::siftUp(int pos)
+{
+    while (pos > 0)
+    {
+        int parent = (pos - 1) / 2;
+        if (!runsBefore(heap[pos], heap[parent]))
+            break;
+        uint8_t tmp = heap[pos];
+        heap[pos] = heap[parent];
+        heap[parent] = tmp;
+        pos = parent;
+    }
+}
+
+void TaskScheduler::siftDown(int pos)
+{
+    while (true)
+    {
+        int left = pos * 2 + 1;
+        int right = left + 1;
+        int best = pos;
+
+        if (left < taskCount && runsBefore(heap[left], heap[best]))
+            best = left;
+        if (right < taskCount && runsBefore(heap[right], heap[best]))
+            best = right;
+        if (best == pos)
+            break;
+
+        uint8_t tmp = heap[pos];
+        heap[pos] = heap[best];
+        heap[best] = tmp;
+        pos = best;
+    }
+}
+
+int TaskScheduler::addTask(const char *name, TaskCallback callback, unsigned long period,
+                           uint8_t priority, unsigned long budget, unsigned long firstDelay)
+{
+    if (taskCount >= MAX_TASKS || callback == nullptr)
+    {
+        Serial.printf("Scheduler > Cannot add task %s\n", name);
+        return -1;
+    }
+
+    int id = taskCount;
+    Task &task = tasks[id];
+    task.name = name;
+    task.callback = callback;
+    task.period = monoMs(period);
+    task.priority = priority;
+    task.budget = monoMs(budget);
+    task.nextDue = monoNow() + monoMs(firstDelay);
+    task.stats = {0, 0, 0, 0, 0, 0, 0, 0};
+
+    heap[taskCount] = id;
+    taskCount++;
+    siftUp(taskCount - 1);
+    return id;
+}
+
+bool TaskScheduler::runNext()
+{
+    if (taskCount == 0)
+        return false;
+
+    Task &task = tasks[heap[0]];
+    MonoTime start = monoNow();
+    if (start < task.nextDue)
+        return false;
+
+    unsigned long lateness = (start - task.nextDue) / MONO_MS;
+    task.callback();
+    MonoTime elapsed = monoNow() - start;
+    unsigned long runTime = elapsed / MONO_MS;
+
+    TaskStats &stats = task.stats;
+    stats.runs++;
+    stats.lastLateness = lateness;
+    stats.totalLateness += lateness;
+    if (lateness > stats.maxLateness)
+        stats.maxLateness = lateness;
+    stats.lastRunTime = runTime;
+    stats.totalRunTime += elapsed;
+    if (runTime > stats.maxRunTime)
+        stats.maxRunTime = runTime;
+    if (elapsed > task.budget)
+    {
+        stats.overruns++;
+        TRACE(SCHED_OVERRUN, heap[0], runTime, (unsigned long)(task.budget / MONO_MS));
+    }
+
+    // Stay on the period grid, but skip slots that were missed entirely
+    task.nextDue += task.period;
+    if (start >= task.nextDue)
+    {
+        task.nextDue = start + task.period;
+    }
+
+    siftDown(0);
+    return true;
+}
+
+unsigned long TaskScheduler::timeUntilNext() const
+{
+    if (taskCount == 0)
+        return 0;
+
+    MonoTime diff = tasks[heap[0]].nextDue - monoNow();
+    return diff > 0 ? (unsigned long)(diff / MONO_MS) : 0;
+}
+
+void TaskScheduler::printReport() const
+{
+    for (int i = 0; i < taskCount; i++)
+    {
+        const Task &task = tasks[i];
+        const TaskStats &stats = task.stats;
+        unsigned long avgLateness = stats.runs ? (unsigned long)(stats.totalLateness / stats.runs) : 0;
+        Serial.printf("Scheduler > %-8s > runs %lu, late avg %lu ms / max %lu ms, run max %lu ms, overruns %lu\n",
+                      task.name, stats.runs, avgLateness, stats.maxLateness,
+                      stats.maxRunTime, stats.overruns);
+    }
+}
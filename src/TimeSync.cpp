@@ -1,161 +1,256 @@
 // TimeSync.cpp
 #include "TimeSync.h"
 
+#include <sys/time.h>
+
 bool TimeSync::begin()
 {
     if (WiFi.status() != WL_CONNECTED)
     {
-        Serial.println("WiFi not connected - cannot sync time");
+        Serial.println("WiFi not connected - time sync starts once it is");
         return false;
     }
+    update();
+    return true;
+}
 
-    // Configure NTP with Dutch servers
-    configTime(gmtOffset_sec, daylightOffset_sec, ntpServer, ntpServer2, ntpServer3);
-
-    Serial.println("Attempting to sync with Dutch NTP servers...");
+void TimeSync::startSntp()
+{
+    // Rotate the server order on every retry, in case the first one is down
+    const char *servers[] = {ntpServer, ntpServer2, ntpServer3};
+    int first = attempts % 3;
+    configTzTime(TIME_ZONE_POSIX, servers[first], servers[(first + 1) % 3], servers[(first + 2) % 3]);
+    stateSince = monotonicMs();
+    state = SYNCING;
+}
 
-    time_t now = 0;
-    struct tm timeinfo = {0};
-    int retry = 0;
-    const int retry_count = 20;  // Number of retries
-    const int retry_delay = 500; // ms between retries
+// Takes the system clock (kept by SNTP) as the new reference
+void TimeSync::anchor()
+{
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    epochOffsetMs = (int64_t)tv.tv_sec * 1000 + tv.tv_usec / 1000 - monotonicMs();
+    nextAnchor = tv.tv_sec + ANCHOR_INTERVAL;
+}
 
-    while (!getLocalTime(&timeinfo) && ++retry < retry_count)
+void TimeSync::update()
+{
+    switch (state)
     {
-        Serial.printf("NTP Sync attempt %d/%d\n", retry, retry_count);
-        if (retry == 5)
+    case WAITING_FOR_WIFI:
+        if (WiFi.status() != WL_CONNECTED)
+            return;
+        Serial.printf("Time > Syncing with %s (%s, %s)\n", ntpServer, ntpServer2, ntpServer3);
+        startSntp();
+        break;
+
+    case SYNCING:
+        if (time(nullptr) >= MIN_VALID_EPOCH)
+        {
+            anchor();
+            state = SYNCED;
+            attempts = 0;
+            retryDelay = FIRST_RETRY_MS;
+            tick();
+            Serial.printf("✓ Time synchronized successfully!\n");
+            Serial.printf("Current time: %04u-%02u-%02u %02u:%02u:%02u\n", current.year, current.month, current.day,
+                          current.hour, current.minute, current.second);
+            Serial.printf("Timezone: %s\n", current.dst ? "CEST (UTC+2)" : "CET (UTC+1)");
+        }
+        else if (monotonicMs() - stateSince >= retryDelay)
         {
-            Serial.println("Initial NTP servers not responding, trying backup servers...");
+            attempts++;
+            Serial.printf("Time > No NTP answer after %lu s (attempt %u), restarting SNTP\n",
+                          (unsigned long)(retryDelay / 1000), attempts);
+            if (attempts == 1)
+            {
+                Serial.printf("Time > WiFi status %d, SSID %s, IP %s; check that UDP port 123 and DNS work\n",
+                              WiFi.status(), WiFi.SSID().c_str(), WiFi.localIP().toString().c_str());
+            }
+            retryDelay = min(retryDelay * 2, MAX_RETRY_MS);
+            startSntp();
         }
-        delay(retry_delay);
+        break;
+
+    case SYNCED:
+        // Keeps running on the monotonic clock if WiFi or NTP goes away
+        if (epoch() >= nextAnchor && time(nullptr) >= MIN_VALID_EPOCH)
+            anchor();
+        break;
     }
+}
+
+time_t TimeSync::epoch() const
+{
+    if (state != SYNCED)
+        return 0;
+    return (time_t)((monotonicMs() + epochOffsetMs) / 1000);
+}
 
-    if (getLocalTime(&timeinfo))
+// Howard Hinnant's days_from_civil: days since 1970-01-01 for a proleptic
+// Gregorian date, integer arithmetic only
+int32_t TimeSync::daysFromCivil(int year, unsigned month, unsigned day)
+{
+    year -= month <= 2;
+    int32_t era = (year >= 0 ? year : year - 399) / 400;
+    unsigned yearOfEra = (unsigned)(year - era * 400);
+    unsigned dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + (int32_t)dayOfEra - 719468;
+}
+
+void TimeSync::civilFromDays(int32_t days, int &year, unsigned &month, unsigned &day)
+{
+    days += 719468;
+    int32_t era = (days >= 0 ? days : days - 146096) / 146097;
+    unsigned dayOfEra = (unsigned)(days - era * 146097);
+    unsigned yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;
+    unsigned dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);
+    unsigned monthPart = (5 * dayOfYear + 2) / 153;
+    day = dayOfYear - (153 * monthPart + 2) / 5 + 1;
+    month = monthPart < 10 ? monthPart + 3 : monthPart - 9;
+    year = (int)yearOfEra + era * 400 + (month <= 2);
+}
+
+// ISO 8601 week: weeks start on Monday and week 1 holds the first Thursday.
+// yearDay is 0-based, weekday 0 = Sunday (as in struct tm).
+uint8_t TimeSync::isoWeek(int year, int yearDay, int weekday)
+{
+    int isoWeekday = weekday == 0 ? 7 : weekday;
+    int week = (yearDay + 1 - isoWeekday + 10) / 7;
+
+    // A year has 53 weeks when it starts on a Thursday, or on a Wednesday
+    // in a leap year
+    auto weeksIn = [](int y)
     {
-        char time_str[25];
-        strftime(time_str, sizeof(time_str), "%Y-%m-%d %H:%M:%S", &timeinfo);
-        Serial.println("✓ Time synchronized successfully!");
-        Serial.printf("Current time: %s\n", time_str);
-        Serial.printf("Timezone: UTC+%d\n", (gmtOffset_sec + daylightOffset_sec) / 3600);
-        timeInitialized = true;
-        return true;
-    }
-    else
+        auto p = [](int y)
+        { return (y + y / 4 - y / 100 + y / 400) % 7; };
+        return (p(y) == 4 || p(y - 1) == 3) ? 53 : 52;
+    };
+
+    if (week < 1)
+        return weeksIn(year - 1);
+    if (week > weeksIn(year))
+        return 1;
+    return week;
+}
+
+void TimeSync::tick()
+{
+    time_t now = epoch();
+    if (now == current.epoch)
+        return;
+
+    if (now == 0)
     {
-        Serial.println("× Failed to sync time after multiple attempts");
-        Serial.println("Diagnostic information:");
-        Serial.printf("WiFi status: %d\n", WiFi.status());
-        Serial.printf("WiFi SSID: %s\n", WiFi.SSID().c_str());
-        Serial.printf("WiFi IP: %s\n", WiFi.localIP().toString().c_str());
-        Serial.println("Please check:");
-        Serial.println("1. WiFi connection is stable");
-        Serial.println("2. NTP ports (123 UDP) aren't blocked");
-        Serial.println("3. DNS resolution is working");
+        // Not synchronised yet: keep the 12:00 default and match no weekday
         timeInitialized = false;
-        return false;
+        current.valid = false;
+        current.weekdayBit = 0;
+        return;
     }
+
+    bool dst;
+    int64_t local = (int64_t)now + timeZoneOffset(now, dst);
+    int32_t days = (int32_t)(local / 86400);
+    int32_t secondOfDay = (int32_t)(local - (int64_t)days * 86400);
+
+    int year;
+    unsigned month, day;
+    civilFromDays(days, year, month, day);
+
+    current.epoch = now;
+    current.hour = secondOfDay / 3600;
+    current.minute = secondOfDay / 60 % 60;
+    current.second = secondOfDay % 60;
+    current.minuteOfDay = secondOfDay / 60;
+    current.weekday = (days + 4) % 7; // 1970-01-01 was a Thursday
+    current.weekdayBit = 1 << current.weekday;
+    current.isoWeek = isoWeek(year, days - daysFromCivil(year, 1, 1), current.weekday);
+    current.day = day;
+    current.month = month;
+    current.year = year;
+    current.dst = dst;
+    current.valid = true;
+    timeInitialized = true;
 }
 
 void TimeSync::getCurrentHourMinute(int &hour, int &minute)
 {
-    struct tm timeinfo;
-    if (getLocalTime(&timeinfo))
-    {
-        hour = timeinfo.tm_hour;
-        minute = timeinfo.tm_min;
-        Serial.printf("Current time: %02d:%02d\n", hour, minute);
-    }
-    else
-    {
-        hour = 12;
-        minute = 0;
-        Serial.println("⚠ Could not get current time, using default (12:00)");
-        timeInitialized = false; // Mark time as not synchronized
-    }
+    hour = current.hour;
+    minute = current.minute;
 }
 
 String TimeSync::getCurrentTime()
 {
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo))
-    {
-        Serial.println("⚠ Failed to obtain time");
-        timeInitialized = false; // Mark time as not synchronized
+    if (!current.valid)
         return "Time not set";
-    }
 
-    char timeString[9];
-    strftime(timeString, 9, "%H:%M:%S", &timeinfo);
+    char timeString[12]; // Room for any uint8_t field, "hh:mm:ss" in practice
+    snprintf(timeString, sizeof(timeString), "%02u:%02u:%02u", current.hour, current.minute, current.second);
     return String(timeString);
 }
 
 bool TimeSync::isTimeBetween(const char *startTime, const char *endTime)
 {
-    struct tm timeinfo;
-    if (!getLocalTime(&timeinfo))
-    {
-        Serial.println("⚠ Failed to get time for comparison");
-        timeInitialized = false; // Mark time as not synchronized
+    if (!current.valid)
         return false;
-    }
-
-    int currentMinutes = timeinfo.tm_hour * 60 + timeinfo.tm_min;
 
     // Parse start time (format "HH:MM")
-    int startHour, startMin;
+    int startHour = 0, startMin = 0;
     sscanf(startTime, "%d:%d", &startHour, &startMin);
     int startMinutes = startHour * 60 + startMin;
 
     // Parse end time
-    int endHour, endMin;
+    int endHour = 0, endMin = 0;
     sscanf(endTime, "%d:%d", &endHour, &endMin);
     int endMinutes = endHour * 60 + endMin;
 
-    // Debug time information
-    Serial.printf("Time check - Current: %02d:%02d (%d min), ",
-                  timeinfo.tm_hour, timeinfo.tm_min, currentMinutes);
-    Serial.printf("Start: %02d:%02d (%d min), ",
-                  startHour, startMin, startMinutes);
-    Serial.printf("End: %02d:%02d (%d min)\n",
-                  endHour, endMin, endMinutes);
-
+    int currentMinutes = current.minuteOfDay;
     if (endMinutes < startMinutes)
     { // Handles overnight periods
-        bool isInRange = currentMinutes >= startMinutes || currentMinutes <= endMinutes;
-        Serial.printf("Overnight period check: %s\n", isInRange ? "true" : "false");
-        return isInRange;
+        return currentMinutes >= startMinutes || currentMinutes <= endMinutes;
     }
-
-    bool isInRange = currentMinutes >= startMinutes && currentMinutes <= endMinutes;
-    Serial.printf("Same-day period check: %s\n", isInRange ? "true" : "false");
-    return isInRange;
+    return currentMinutes >= startMinutes && currentMinutes <= endMinutes;
 }
 
 int TimeSync::getCurrentMinutes()
 {
-    int hour, minute;
-    getCurrentHourMinute(hour, minute);
-    return hour * 60 + minute;
+    return current.minuteOfDay;
+}
+
+int TimeSync::getDayOfWeek()
+{
+    return current.weekday;
+}
+
+int TimeSync::getWeekNumber()
+{
+    return current.isoWeek;
+}
+
+int TimeSync::getMonth()
+{
+    return current.month;
+}
+
+int TimeSync::getYear()
+{
+    return current.year;
 }
 
 TimeSync::TimeData TimeSync::getTime()
 {
     TimeData t = {0};
-    struct tm timeinfo;
-
-    if (getLocalTime(&timeinfo))
+    if (current.valid)
     {
-        t.year = timeinfo.tm_year + 1900;
-        t.month = timeinfo.tm_mon + 1;
+        t.year = current.year;
+        t.month = current.month;
         // Convert to 1-7 where Monday=1 and Sunday=7
-        t.dayOfWeek = timeinfo.tm_wday == 0 ? 7 : timeinfo.tm_wday;
-        t.hour = timeinfo.tm_hour;
-        t.minute = timeinfo.tm_min;
-        t.weekNum = ((timeinfo.tm_yday + 7 - timeinfo.tm_wday) / 7) + 1;
-    }
-    else
-    {
-        Serial.println("Failed to get time");
+        t.dayOfWeek = current.weekday == 0 ? 7 : current.weekday;
+        t.hour = current.hour;
+        t.minute = current.minute;
+        t.weekNum = current.isoWeek;
     }
     return t;
-}
\ No newline at end of file
+}
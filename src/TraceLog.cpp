@@ -0,0 +1,63 @@
+// TraceLog.cpp
+#include "TraceLog.h"
+
+static const uint32_t SLOT_BUSY = UINT32_MAX;
+static const size_t LINE_LENGTH = 120; // Longest printed line, with time and level
+
+void TraceLog::write(uint16_t event, uint8_t level, const uint32_t *args, uint8_t count)
+{
+    uint32_t sequence = head.fetch_add(1, std::memory_order_relaxed);
+    Slot &slot = slots[sequence & (CAPACITY - 1)];
+
+    slot.sequence.store(SLOT_BUSY, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.record.time = (uint32_t)(monoNow() / MONO_MS);
+    slot.record.sequence = sequence;
+    slot.record.event = event;
+    slot.record.level = level;
+    slot.record.argCount = count;
+    memcpy(slot.record.args, args, count * sizeof(uint32_t));
+    slot.sequence.store(sequence, std::memory_order_release);
+}
+
+bool TraceLog::read(uint32_t sequence, TraceRecord &record) const
+{
+    const Slot &slot = slots[sequence & (CAPACITY - 1)];
+    if (slot.sequence.load(std::memory_order_acquire) != sequence)
+        return false;
+    record = slot.record;
+    std::atomic_thread_fence(std::memory_order_acquire);
+    return slot.sequence.load(std::memory_order_relaxed) == sequence;
+}
+
+void TraceLog::drainToSerial(uint8_t maxRecords)
+{
+    uint32_t end = getHead();
+    if (end - serialCursor > CAPACITY)
+    {
+        lost += end - serialCursor - CAPACITY;
+        serialCursor = end - CAPACITY;
+    }
+
+    char line[LINE_LENGTH];
+    TraceRecord record;
+    while (maxRecords > 0 && serialCursor != end && Serial.availableForWrite() >= (int)LINE_LENGTH)
+    {
+        if (!read(serialCursor, record))
+        {
+            // Still being written: try again next time. Overwritten: skip it.
+            if ((int32_t)(getHead() - serialCursor) <= (int32_t)CAPACITY)
+                break;
+            lost++;
+            serialCursor++;
+            continue;
+        }
+        serialCursor++;
+        maxRecords--;
+
+        int prefix = snprintf(line, sizeof(line), "%lu.%03lu %c ", (unsigned long)(record.time / 1000),
+                              (unsigned long)(record.time % 1000), traceLevelLetter(record.level));
+        traceFormat(record, line + prefix, sizeof(line) - prefix);
+        Serial.println(line);
+    }
+}
@@ -1,5 +1,9 @@
 // WebServer.cpp
 #include "WebInterface.h"
+#include "RulesEngine.h"
+#include "PollController.h"
+#include "Metrics.h"
+#include "WebAssets.h"
 
 String WebInterface::getContentType(const String &path)
 {
@@ -16,66 +20,214 @@ String WebInterface::getContentType(const String &path)
     return "text/plain";
 }
 
-bool WebInterface::serveFromCache(const String &path)
+// The gzipped copy built into the firmware (include/WebAssets.h), written
+// straight from flash. A browser that still has it gets a 304.
+bool WebInterface::serveAsset(const String &path)
 {
-    for (int i = 0; i < MAX_CACHED_FILES; i++)
+    const WebAsset *asset = nullptr;
+    for (size_t i = 0; i < WEB_ASSET_COUNT && !asset; i++)
     {
-        if (cachedFiles[i].path == path && cachedFiles[i].data != nullptr)
+        if (path == WEB_ASSETS[i].path)
+            asset = &WEB_ASSETS[i];
+    }
+    // A client without gzip gets the SPIFFS copy
+    if (!asset || server.header("Accept-Encoding").indexOf("gzip") < 0)
+        return false;
+
+    server.sendHeader("ETag", asset->etag);
+    server.sendHeader("Cache-Control", "no-cache"); // Always revalidated, so a new build shows at once
+    if (server.header("If-None-Match").indexOf(asset->etag) >= 0)
+    {
+        TRACE(WEB_NOT_MODIFIED, asset->size);
+        server.send(304);
+        return true;
+    }
+
+    server.sendHeader("Content-Encoding", "gzip");
+    server.setContentLength(asset->size);
+    server.send(200, asset->contentType, "");
+    size_t sent = server.client().write(asset->data, asset->size);
+    if (sent != asset->size)
+        TRACE(WEB_SHORT, sent, asset->size);
+    else
+        TRACE(WEB_ASSET, sent);
+    return true;
+}
+
+void WebInterface::serveCached(const String &path, const FileCache::Entry &entry)
+{
+    TRACE(WEB_CACHE_HIT, entry.size);
+    String contentType = getContentType(path);
+    server.sendHeader("Cache-Control", "no-cache");
+    server.setContentLength(entry.size);
+    server.send(200, contentType, "");
+    server.client().write(entry.data, entry.size);
+}
+
+void WebInterface::updateCache()
+{
+    const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+    cached.import_power = devices.importPower;
+    cached.export_power = devices.exportPower;
+    cached.temperature = sensors.getTemperature();
+    cached.humidity = sensors.getHumidity();
+    cached.light = sensors.getLightLevel();
+    cached.p1_extras = devices.p1Extras;
+
+    cached.socket_count = socketRegistry.getCount();
+    cached.socket_states = devices.socketOn;
+    for (int i = 0; i < cached.socket_count; i++)
+    {
+        cached.socket_durations[i] = monoElapsedMs(socketRegistry.getLastChange(i));
+    }
+}
+
+// server.on() with the request counted and timed for /metrics; routes
+// given the same label share one counter
+void WebInterface::on(const String &uri, HTTPMethod method, WebServer::THandlerFunction handler, const char *label)
+{
+    int route = metrics.addRoute(label ? label : uri.c_str());
+    server.on(uri, method, [handler, route]()
+              {
+        MonoTime start = monoNow();
+        handler();
+        metrics.recordWebRequest(route, monoNow() - start); });
+}
+
+void WebInterface::fillData(JsonDocument &doc)
+{
+    doc["import_power"] = cached.import_power;
+    doc["export_power"] = cached.export_power;
+    doc["temperature"] = cached.temperature;
+    doc["humidity"] = cached.humidity;
+    doc["light"] = cached.light;
+#if P1_PHASE_POWER
+    JsonArray phasePower = doc.createNestedArray("phase_power");
+    for (int i = 0; i < 3; i++)
+        phasePower.add(cached.p1_extras.phasePower[i]);
+#endif
+#if P1_VOLTAGE
+    JsonArray voltage = doc.createNestedArray("voltage");
+    for (int i = 0; i < 3; i++)
+        voltage.add(cached.p1_extras.voltage[i]);
+#endif
+#if P1_TOTALS
+    doc["total_import_kwh"] = cached.p1_extras.totalImportKwh;
+    doc["total_export_kwh"] = cached.p1_extras.totalExportKwh;
+#endif
+
+    JsonArray switches = doc.createNestedArray("switches");
+    for (int i = 0; i < cached.socket_count; i++)
+    {
+        SocketRegistry::Logic logic = socketRegistry.getLogic(i);
+        JsonObject sw = switches.createNestedObject();
+        sw["name"] = socketRegistry.getName(i);
+        sw["state"] = (bool)((cached.socket_states >> i) & 1);
+        sw["duration"] = String(cached.socket_durations[i] / 1000) + "s";
+        sw["logic"] = SocketRegistry::logicName(logic);
+        if (logic == SocketRegistry::LOGIC_EVENING)
         {
-            Serial.printf("Web > Serving %s from RAM cache\n", path.c_str());
-            server.sendHeader("Content-Type", getContentType(path));
-            server.sendHeader("Content-Length", String(cachedFiles[i].size));
-            server.sendHeader("Cache-Control", "no-cache");
-            server.send(200, getContentType(path), "");
-            server.client().write(cachedFiles[i].data, cachedFiles[i].size);
-            return true;
+            sw["after"] = socketRegistry.getAfterMinute(i);
+            sw["lux"] = socketRegistry.getDarkLux(i);
         }
     }
-    return false;
 }
 
-void WebInterface::cacheFile(const String &path, File &file)
+// Sends the event stream clients what changed since the last push,
+// serialised once for all of them. Durations are not sent on every tick:
+// the page counts them up itself from the last state change.
+void WebInterface::pushChanges()
 {
-    static int cacheIndex = 0;
+    if (events.getClientCount() == 0)
+    {
+        pushed = cached;
+        return;
+    }
 
-    if (cachedFiles[cacheIndex].data != nullptr)
+    if (cached.socket_count != pushed.socket_count)
     {
-        delete[] cachedFiles[cacheIndex].data;
-        cachedFiles[cacheIndex].data = nullptr;
+        DynamicJsonDocument doc(DATA_DOC_SIZE);
+        fillData(doc);
+        String data;
+        serializeJson(doc, data);
+        events.broadcast("full", data.c_str(), data.length());
+        pushed = cached;
+        return;
     }
 
-    size_t fileSize = file.size();
-    cachedFiles[cacheIndex].data = new uint8_t[fileSize];
-    if (cachedFiles[cacheIndex].data)
+    DynamicJsonDocument doc(JSON_OBJECT_SIZE(10) + JSON_ARRAY_SIZE(SocketRegistry::MAX_SOCKETS) +
+                            SocketRegistry::MAX_SOCKETS * JSON_OBJECT_SIZE(3) + 64);
+    if (cached.import_power != pushed.import_power)
+        doc["import_power"] = cached.import_power;
+    if (cached.export_power != pushed.export_power)
+        doc["export_power"] = cached.export_power;
+    if (cached.temperature != pushed.temperature)
+        doc["temperature"] = cached.temperature;
+    if (cached.humidity != pushed.humidity)
+        doc["humidity"] = cached.humidity;
+    if (cached.light != pushed.light)
+        doc["light"] = cached.light;
+#if P1_PHASE_POWER || P1_VOLTAGE || P1_TOTALS
+    if (memcmp(&cached.p1_extras, &pushed.p1_extras, sizeof(cached.p1_extras)) != 0)
     {
-        file.read(cachedFiles[cacheIndex].data, fileSize);
-        cachedFiles[cacheIndex].path = path;
-        cachedFiles[cacheIndex].size = fileSize;
-        Serial.printf("Web > Cached %s in RAM (%u bytes)\n", path.c_str(), fileSize);
+#if P1_PHASE_POWER
+        JsonArray phasePower = doc.createNestedArray("phase_power");
+        for (int i = 0; i < 3; i++)
+            phasePower.add(cached.p1_extras.phasePower[i]);
+#endif
+#if P1_VOLTAGE
+        JsonArray voltage = doc.createNestedArray("voltage");
+        for (int i = 0; i < 3; i++)
+            voltage.add(cached.p1_extras.voltage[i]);
+#endif
+#if P1_TOTALS
+        doc["total_import_kwh"] = cached.p1_extras.totalImportKwh;
+        doc["total_export_kwh"] = cached.p1_extras.totalExportKwh;
+#endif
+    }
+#endif
 
-        cacheIndex = (cacheIndex + 1) % MAX_CACHED_FILES;
+    uint32_t changed = cached.socket_states ^ pushed.socket_states;
+    if (changed)
+    {
+        JsonArray switches = doc.createNestedArray("switches");
+        for (int i = 0; i < cached.socket_count; i++)
+        {
+            if (!((changed >> i) & 1))
+                continue;
+            JsonObject sw = switches.createNestedObject();
+            sw["index"] = i;
+            sw["state"] = (bool)((cached.socket_states >> i) & 1);
+            sw["duration"] = cached.socket_durations[i] / 1000;
+        }
     }
+
+    pushed = cached;
+    if (doc.size() == 0)
+        return;
+
+    String data;
+    serializeJson(doc, data);
+    events.broadcast("delta", data.c_str(), data.length());
 }
 
-void WebInterface::updateCache()
+void WebInterface::handleEvents()
 {
-    if (p1Meter)
+    int slot = events.add(server.client());
+    if (slot < 0)
     {
-        cached.import_power = p1Meter->getCurrentImport();
-        cached.export_power = p1Meter->getCurrentExport();
+        server.send(503, "text/plain", "Too many event streams");
+        return;
     }
-    cached.temperature = sensors.getTemperature();
-    cached.humidity = sensors.getHumidity();
-    cached.light = sensors.getLightLevel();
 
-    cached.socket_states[0] = socket1 ? socket1->getCurrentState() : false;
-    cached.socket_states[1] = socket2 ? socket2->getCurrentState() : false;
-    cached.socket_states[2] = socket3 ? socket3->getCurrentState() : false;
+    DynamicJsonDocument doc(DATA_DOC_SIZE);
+    fillData(doc);
+    String data;
+    serializeJson(doc, data);
+    events.sendTo(slot, "full", data.c_str(), data.length());
 
-    for (int i = 0; i < 3; i++)
-    {
-        cached.socket_durations[i] = millis() - lastStateChangeTime[i];
-    }
+    // The stream keeps its own copy of the connection
+    server.client().stop();
 }
 
 void WebInterface::begin()
@@ -90,49 +242,87 @@ void WebInterface::begin()
 
     Serial.printf("Total space: %d bytes\n", SPIFFS.totalBytes());
     Serial.printf("Used space: %d bytes\n", SPIFFS.usedBytes());
+    fileCache.preload(PRELOAD_FILE);
 
     // Serve the main page at root URL
-    server.on("/", HTTP_GET, [this]()
-              { serveFile("/data/index.html"); });
+    on("/", HTTP_GET, [this]()
+       {
+        if (!serveAsset("/index.html") && !serveFile("/data/index.html"))
+            server.send(404, "text/plain", "Not found"); });
 
     // API endpoint for getting data
-    server.on("/data", HTTP_GET, [this]()
-              {
+    on("/data", HTTP_GET, [this]()
+       {
         server.sendHeader("Content-Type", "application/json");
         server.sendHeader("Access-Control-Allow-Origin", "*");
 
-        StaticJsonDocument<2048> doc;
-        doc["import_power"] = cached.import_power;
-        doc["export_power"] = cached.export_power;
-        doc["temperature"] = cached.temperature;
-        doc["humidity"] = cached.humidity;
-        doc["light"] = cached.light;
-
-        JsonArray switches = doc.createNestedArray("switches");
-        for(int i = 0; i < 3; i++) {
-            JsonObject sw = switches.createNestedObject();
-            sw["state"] = cached.socket_states[i];
-            sw["duration"] = String(cached.socket_durations[i]/1000) + "s";
-        }
+        DynamicJsonDocument doc(DATA_DOC_SIZE);
+        fillData(doc);
 
         String response;
         serializeJson(doc, response);
         server.send(200, "application/json", response); });
 
-    // API endpoints for controlling switches
-    server.on("/switch/1", HTTP_POST, [this]()
-              { handleSwitch(1); });
-    server.on("/switch/2", HTTP_POST, [this]()
-              { handleSwitch(2); });
-    server.on("/switch/3", HTTP_POST, [this]()
-              { handleSwitch(3); });
+    // The same data pushed as server-sent events: "full" on connect, then
+    // "delta" with only what changed
+    on("/events", HTTP_GET, [this]()
+       { handleEvents(); });
+
+    // API endpoints for controlling switches, /switch/1 .. /switch/<count>
+    for (int i = 1; i <= socketRegistry.getCount(); i++)
+    {
+        on("/switch/" + String(i), HTTP_POST, [this, i]()
+           { handleSwitch(i); }, "/switch");
+    }
+
+    // Power history: /history?tier=minutes&count=60, /history/summary?seconds=600
+    on("/history", HTTP_GET, [this]()
+       { handleHistory(); });
+    on("/history/summary", HTTP_GET, [this]()
+       { handleHistorySummary(); });
+
+    // Flash log status; the segments themselves download as /log/<slot>.bin
+    on("/log", HTTP_GET, [this]()
+       { handleLogStatus(); });
+
+    // Rule text: GET returns it, POST compiles, stores and activates new rules
+    on("/rules", HTTP_GET, [this]()
+       { handleGetRules(); });
+    on("/rules", HTTP_POST, [this]()
+       { handlePostRules(); });
+    on("/timers", HTTP_GET, [this]()
+       { handleTimers(); });
+
+    // Binary trace ring, decode with tools/trace/trace_decode
+    on("/trace", HTTP_GET, [this]()
+       { handleTrace(); });
+
+    // Keep-alive connections to the devices: connects and latency per host
+    on("/connections", HTTP_GET, [this]()
+       { handleConnections(); });
+    // Current poll interval of every device and why, against the budget
+    on("/polling", HTTP_GET, [this]()
+       { handlePolling(); });
+    // Socket commands: desired against confirmed state, coalescing and latency
+    on("/commands", HTTP_GET, [this]()
+       { handleCommands(); });
+    // Prometheus text format: loop and task times, heap, device and web latency
+    on("/metrics", HTTP_GET, [this]()
+       { handleMetrics(); });
 
     // Handle any other static files
-    server.onNotFound([this]()
+    int staticRoute = metrics.addRoute("static");
+    server.onNotFound([this, staticRoute]()
                       {
-        if (!serveFile(server.uri())) {
+        MonoTime start = monoNow();
+        if (!serveAsset(server.uri()) && !serveFile(server.uri())) {
             server.send(404, "text/plain", "Not found");
-        } });
+        }
+        metrics.recordWebRequest(staticRoute, monoNow() - start); });
+
+    // The only request headers the handlers read
+    static const char *headerKeys[] = {"Accept-Encoding", "If-None-Match"};
+    server.collectHeaders(headerKeys, sizeof(headerKeys) / sizeof(headerKeys[0]));
 
     server.begin();
     Serial.println("Web server started on IP: " + WiFi.localIP().toString());
@@ -140,9 +330,9 @@ void WebInterface::begin()
 
 void WebInterface::update()
 {
-    static unsigned long lastWebUpdate = 0;
-    static unsigned long lastClientCheck = 0;
-    unsigned long now = millis();
+    static MonoTime lastWebUpdate = 0;
+    static MonoTime lastClientCheck = 0;
+    MonoTime now = monoNow();
 
     // Handle web clients first
     server.handleClient();
@@ -153,34 +343,38 @@ void WebInterface::update()
         lastWebUpdate = now; // Reset timeout if we have an active client
         lastClientCheck = now;
     }
-    else if (now - lastClientCheck >= 1000)
+    else if (now - lastClientCheck >= MONO_SECOND)
     { // Check connection status every second
         lastClientCheck = now;
         if (WiFi.status() == WL_CONNECTED)
         {
-            Serial.printf("Web > Status: No active clients (uptime: %lus)\n",
-                          (now - lastWebUpdate) / 1000);
+            TRACE(WEB_IDLE, (unsigned long)((now - lastWebUpdate) / MONO_SECOND));
         }
     }
 
-    // Only reset if really needed (increase to 2 minutes)
-    if (now - lastWebUpdate > 120000)
+    // Only reset if really needed (increase to 2 minutes). A dashboard on
+    // the event stream makes no requests, an open stream counts as activity.
+    if (now - lastWebUpdate > 2 * MONO_MINUTE)
     { // 2 minutes
-        Serial.println("Web > Watchdog: Server inactive, attempting reset");
-        server.close();
-        delay(100); // Give it time to close
-        server.begin();
-        Serial.println("Web > Server reset complete");
+        if (events.getClientCount() == 0)
+        {
+            // Straight back up, a sleep here would stall the whole loop
+            server.close();
+            server.begin();
+            TRACE(WEB_WATCHDOG);
+        }
         lastWebUpdate = now;
     }
 
     // Update cache periodically
-    static unsigned long lastCacheUpdate = 0;
-    if (now - lastCacheUpdate >= 1000)
+    static MonoTime lastCacheUpdate = 0;
+    if (now - lastCacheUpdate >= MONO_SECOND)
     {
         updateCache();
+        pushChanges();
         lastCacheUpdate = now;
     }
+    events.ping();
 
     // WiFi check
     if (now - lastCheck >= CHECK_INTERVAL)
@@ -188,7 +382,7 @@ void WebInterface::update()
         lastCheck = now;
         if (WiFi.status() != WL_CONNECTED)
         {
-            Serial.println("Web > WiFi connection lost - attempting reconnect");
+            TRACE(WEB_WIFI_LOST);
             WiFi.reconnect();
         }
     }
@@ -198,8 +392,6 @@ void WebInterface::update()
 
 bool WebInterface::serveFile(const String &path)
 {
-    Serial.printf("Web > Attempting to serve: %s\n", path.c_str());
-
     if (!buffer)
     {
         Serial.println("Web > Error: Buffer not allocated!");
@@ -207,9 +399,10 @@ bool WebInterface::serveFile(const String &path)
     }
 
     // Try cache first
-    if (serveFromCache(path))
+    const FileCache::Entry *entry = fileCache.find(path.c_str());
+    if (entry)
     {
-        Serial.println("Web > Served from cache successfully");
+        serveCached(path, *entry);
         return true;
     }
 
@@ -220,8 +413,18 @@ bool WebInterface::serveFile(const String &path)
         return false;
     }
 
+    // Read once into the cache when it fits (log segments change and are large)
+    entry = path.startsWith("/log/") ? nullptr : fileCache.add(path.c_str(), file);
+    if (entry)
+    {
+        file.close();
+        serveCached(path, *entry);
+        return true;
+    }
+    file.seek(0);
+
     size_t fileSize = file.size();
-    Serial.printf("Web > Serving file from SPIFFS: %s (%u bytes)\n", path.c_str(), fileSize);
+    TRACE(WEB_FILE, fileSize);
 
     String contentType = getContentType(path);
     server.sendHeader("Content-Type", contentType);
@@ -236,7 +439,7 @@ bool WebInterface::serveFile(const String &path)
     {
         if (!server.client().connected())
         {
-            Serial.println("Web > Error: Client disconnected during transfer");
+            TRACE(WEB_DISCONNECTED, totalBytesSent, fileSize);
             file.close();
             return false;
         }
@@ -244,14 +447,14 @@ bool WebInterface::serveFile(const String &path)
         size_t bytesRead = file.read(buffer, min(BUFFER_SIZE, fileSize - totalBytesSent));
         if (bytesRead == 0)
         {
-            Serial.println("Web > Error: Failed to read file");
+            TRACE(WEB_READ_FAILED, totalBytesSent, fileSize);
             break;
         }
 
         size_t bytesWritten = server.client().write(buffer, bytesRead);
         if (bytesWritten != bytesRead)
         {
-            Serial.printf("Web > Warning: Partial write %u/%u bytes\n", bytesWritten, bytesRead);
+            TRACE(WEB_PARTIAL_WRITE, bytesWritten, bytesRead);
             delay(50);
             continue;
         }
@@ -259,7 +462,7 @@ bool WebInterface::serveFile(const String &path)
         totalBytesSent += bytesWritten;
         if (totalBytesSent % (BUFFER_SIZE * 4) == 0)
         {
-            Serial.printf("Web > Progress: %u/%u bytes sent\n", totalBytesSent, fileSize);
+            TRACE(WEB_PROGRESS, totalBytesSent, fileSize);
         }
         delay(1);
         yield();
@@ -269,23 +472,311 @@ bool WebInterface::serveFile(const String &path)
 
     if (totalBytesSent == fileSize)
     {
-        Serial.println("Web > File served successfully");
-        // Try to cache the file for next time
-        file = SPIFFS.open(path, "r");
-        if (file)
-        {
-            cacheFile(path, file);
-            file.close();
-        }
+        TRACE(WEB_SERVED, fileSize);
         return true;
     }
     else
     {
-        Serial.printf("Web > Error: Only sent %u/%u bytes\n", totalBytesSent, fileSize);
+        TRACE(WEB_SHORT, totalBytesSent, fileSize);
         return false;
     }
 }
 
+static void addHistoryValues(JsonArray array, const int16_t *values, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        if (values[i] == PowerHistory::NO_DATA)
+            array.add(nullptr);
+        else
+            array.add(values[i]);
+    }
+}
+
+void WebInterface::handleHistory()
+{
+    PowerHistory::Tier tier = PowerHistory::MINUTES;
+    String tierName = server.arg("tier");
+    if (tierName == "seconds")
+        tier = PowerHistory::SECONDS;
+    else if (tierName == "quarters")
+        tier = PowerHistory::QUARTERS;
+
+    size_t count = server.hasArg("count") ? server.arg("count").toInt() : 60;
+    count = constrain(count, (size_t)1, MAX_HISTORY_POINTS);
+
+    int16_t minW[MAX_HISTORY_POINTS];
+    int16_t avgW[MAX_HISTORY_POINTS];
+    int16_t maxW[MAX_HISTORY_POINTS];
+    uint32_t now = monoUptimeSeconds();
+    count = powerHistory.getSeries(tier, now, count, minW, avgW, maxW);
+
+    // Values are net watts, oldest first, null where there was no P1 data
+    DynamicJsonDocument doc(JSON_OBJECT_SIZE(5) + 3 * JSON_ARRAY_SIZE(MAX_HISTORY_POINTS));
+    doc["tier"] = PowerHistory::getTierName(tier);
+    doc["resolution"] = powerHistory.getResolution(tier);
+    if (tier == PowerHistory::SECONDS)
+    {
+        addHistoryValues(doc.createNestedArray("avg"), avgW, count);
+    }
+    else
+    {
+        addHistoryValues(doc.createNestedArray("min"), minW, count);
+        addHistoryValues(doc.createNestedArray("avg"), avgW, count);
+        addHistoryValues(doc.createNestedArray("max"), maxW, count);
+    }
+
+    String response;
+    serializeJson(doc, response);
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.send(200, "application/json", response);
+}
+
+void WebInterface::handleHistorySummary()
+{
+    uint32_t seconds = server.hasArg("seconds") ? server.arg("seconds").toInt() : 600;
+    PowerHistory::Aggregate result = powerHistory.aggregate(monoUptimeSeconds(), seconds);
+
+    StaticJsonDocument<JSON_OBJECT_SIZE(5)> doc;
+    doc["seconds"] = seconds;
+    doc["buckets"] = result.buckets;
+    if (result.buckets > 0)
+    {
+        doc["min"] = result.minW;
+        doc["avg"] = result.avgW;
+        doc["max"] = result.maxW;
+    }
+
+    String response;
+    serializeJson(doc, response);
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.send(200, "application/json", response);
+}
+
+void WebInterface::handleLogStatus()
+{
+    const HistoryLog::Stats &stats = historyLog.getStats();
+    StaticJsonDocument<JSON_OBJECT_SIZE(12)> doc;
+    doc["ready"] = historyLog.isReady();
+    doc["segment"] = historyLog.getSegmentSequence();
+    doc["segment_slot"] = historyLog.getSegmentSequence() % HistoryLog::SEGMENT_COUNT;
+    doc["segment_records"] = historyLog.getSegmentRecords();
+    doc["buffered"] = historyLog.getBuffered();
+    doc["records_logged"] = stats.recordsLogged;
+    doc["records_written"] = stats.recordsWritten;
+    doc["bytes_written"] = stats.bytesWritten;
+    doc["rotations"] = stats.rotations;
+    doc["write_errors"] = stats.writeErrors;
+    doc["max_flush_ms"] = stats.maxFlushTime;
+
+    String response;
+    serializeJson(doc, response);
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.send(200, "application/json", response);
+}
+
+void WebInterface::handleGetRules()
+{
+    File file = SPIFFS.open(RULES_FILE, "r");
+    String text = file ? file.readString() : String();
+    file.close();
+    server.send(200, "text/plain", text);
+}
+
+void WebInterface::handlePostRules()
+{
+    String text = server.arg("plain");
+    if (text.length() > SimpleRuleEngine::MAX_RULES_SIZE)
+    {
+        server.send(413, "text/plain", "Rules too large");
+        return;
+    }
+
+    StaticJsonDocument<JSON_OBJECT_SIZE(4)> doc;
+    bool ok = rules.compileRules(text.c_str(), text.length());
+    if (ok)
+    {
+        File file = SPIFFS.open(RULES_FILE, "w");
+        ok = file && file.print(text) == text.length();
+        file.close();
+        fileCache.remove(RULES_FILE);
+        if (!ok)
+            doc["error"] = "compiled, but could not be saved";
+    }
+    else
+    {
+        doc["error"] = rules.getLastError();
+    }
+    doc["ok"] = ok;
+    doc["rules"] = rules.getRuleCount();
+    doc["code_bytes"] = rules.getCodeSize();
+
+    String response;
+    serializeJson(doc, response);
+    server.send(ok ? 200 : 400, "application/json", response);
+}
+
+void WebInterface::handleTimers()
+{
+    DynamicJsonDocument doc(JSON_ARRAY_SIZE(RuleTimers::MAX_TIMERS) +
+                            RuleTimers::MAX_TIMERS * JSON_OBJECT_SIZE(7));
+    JsonArray list = doc.to<JsonArray>();
+    RuleTimers::Info info;
+    for (int slot = 0; slot < RuleTimers::MAX_TIMERS; slot++)
+    {
+        if (!rules.getTimers().getInfo(slot, info))
+            continue;
+        JsonObject timer = list.createNestedObject();
+        timer["slot"] = slot;
+        timer["name"] = rules.getTimerName(slot);
+        timer["type"] = RuleTimers::typeName(info.type);
+        timer["output"] = info.output;
+        timer["running"] = info.running;
+        timer["period_s"] = info.period;
+        timer["remaining_s"] = info.remaining;
+    }
+
+    String response;
+    serializeJson(doc, response);
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.send(200, "application/json", response);
+}
+
+void WebInterface::handleTrace()
+{
+    TraceDumpHeader header = {TRACE_MAGIC, TRACE_VERSION, sizeof(TraceRecord), 0, traceLog.getLost()};
+    TraceRecord *records = new TraceRecord[TraceLog::CAPACITY];
+    uint32_t end = traceLog.getHead();
+    uint32_t sequence = end > TraceLog::CAPACITY ? end - TraceLog::CAPACITY : 0;
+    for (; sequence != end; sequence++)
+    {
+        if (traceLog.read(sequence, records[header.count]))
+            header.count++;
+    }
+
+    size_t size = header.count * sizeof(TraceRecord);
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.setContentLength(sizeof(header) + size);
+    server.send(200, "application/octet-stream", "");
+    server.client().write((const uint8_t *)&header, sizeof(header));
+    server.client().write((const uint8_t *)records, size);
+    delete[] records;
+}
+
+void WebInterface::handleConnections()
+{
+    DynamicJsonDocument doc(JSON_ARRAY_SIZE(HttpConnectionPool::MAX_HOSTS) +
+                            HttpConnectionPool::MAX_HOSTS * (JSON_OBJECT_SIZE(12)));
+    JsonArray list = doc.to<JsonArray>();
+    for (int i = 0; i < httpPool.getHostCount(); i++)
+    {
+        const HttpConnectionPool::Stats &total = httpPool.getStats(i);
+        const HttpConnectionPool::MinuteStats &minute = httpPool.getLastMinute(i);
+        JsonObject host = list.createNestedObject();
+        host["host"] = httpPool.getName(i);
+        host["idle"] = httpPool.getIdleCount(i);
+        host["connects_per_min"] = minute.connects;
+        host["requests_per_min"] = minute.requests;
+        host["latency_avg_ms"] = minute.latencyAvgMs;
+        host["latency_max_ms"] = minute.latencyMaxMs;
+        host["connects"] = total.connects;
+        host["requests"] = total.requests;
+        host["reused"] = total.reused;
+        host["reconnects"] = total.reconnects;
+        host["failures"] = total.failures;
+        host["latency_max_all_ms"] = total.latencyMaxMs;
+    }
+
+    String response;
+    serializeJson(doc, response);
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.send(200, "application/json", response);
+}
+
+void WebInterface::handlePolling()
+{
+    uint8_t count = socketRegistry.getCount();
+    DynamicJsonDocument doc(JSON_OBJECT_SIZE(6) + JSON_OBJECT_SIZE(3) + JSON_ARRAY_SIZE(SocketRegistry::MAX_SOCKETS) +
+                            SocketRegistry::MAX_SOCKETS * JSON_OBJECT_SIZE(4));
+    doc["budget_per_min"] = pollController.getBudget();
+    doc["planned_per_min"] = pollController.getPlannedPerMinute();
+    doc["stretch_pct"] = pollController.getStretch();
+
+    // What was actually sent in the last full minute
+    uint32_t sent = 0;
+    for (int i = 0; i < httpPool.getHostCount(); i++)
+    {
+        sent += httpPool.getLastMinute(i).requests;
+    }
+    doc["requests_last_min"] = sent;
+
+    JsonObject p1 = doc.createNestedObject("p1");
+    p1["interval_ms"] = pollController.getP1Interval();
+    p1["per_min"] = 60000 / pollController.getP1Interval();
+    p1["reason"] = PollController::reasonName(pollController.getP1Reason());
+
+    JsonArray list = doc.createNestedArray("sockets");
+    for (int i = 0; i < count; i++)
+    {
+        JsonObject socket = list.createNestedObject();
+        socket["name"] = socketRegistry.getName(i);
+        socket["interval_ms"] = pollController.getSocketInterval(i);
+        socket["per_min"] = 60000 / pollController.getSocketInterval(i);
+        socket["reason"] = PollController::reasonName(pollController.getSocketReason(i));
+    }
+
+    String response;
+    serializeJson(doc, response);
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.send(200, "application/json", response);
+}
+
+void WebInterface::handleCommands()
+{
+    uint8_t count = socketRegistry.getCount();
+    HomeSocketDevice *const *devices = socketRegistry.getDevices();
+    const DeviceLink::Snapshot &snapshot = deviceLink.getSnapshot();
+    DynamicJsonDocument doc(JSON_OBJECT_SIZE(1) + JSON_ARRAY_SIZE(SocketRegistry::MAX_SOCKETS) +
+                            SocketRegistry::MAX_SOCKETS * JSON_OBJECT_SIZE(14));
+
+    JsonArray list = doc.createNestedArray("sockets");
+    for (int i = 0; i < count; i++)
+    {
+        if (!devices[i])
+            continue;
+        const HomeSocketDevice::CommandStats &stats = devices[i]->getCommandStats();
+        JsonObject socket = list.createNestedObject();
+        socket["name"] = socketRegistry.getName(i);
+        socket["state"] = snapshot.isOn(i);          // Requested while pending
+        socket["confirmed"] = devices[i]->getCurrentState();
+        socket["pending"] = snapshot.isPending(i);
+        socket["requests_coalesced"] = deviceLink.getCoalescedCommands(i);
+        socket["commands"] = stats.commands;
+        socket["commands_coalesced"] = stats.coalesced;
+        socket["writes"] = stats.writes;
+        socket["mismatches"] = stats.mismatches;
+        socket["abandoned"] = stats.abandoned;
+        socket["confirmed_count"] = stats.confirmed;
+        socket["latency_last_ms"] = stats.lastLatencyMs;
+        socket["latency_avg_ms"] = stats.confirmed > 0 ? stats.latencySumMs / stats.confirmed : 0;
+        socket["latency_max_ms"] = stats.maxLatencyMs;
+    }
+
+    String response;
+    serializeJson(doc, response);
+    server.sendHeader("Access-Control-Allow-Origin", "*");
+    server.send(200, "application/json", response);
+}
+
+void WebInterface::handleMetrics()
+{
+    // Chunked, one metric family at a time, so the text is never whole in RAM
+    server.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    server.send(200, "text/plain; version=0.0.4", "");
+    metrics.write(server);
+    server.sendContent(""); // Last chunk
+}
+
 void WebInterface::handleSwitch(int switchNumber)
 {
     if (!server.hasArg("plain"))
@@ -304,7 +795,10 @@ void WebInterface::handleSwitch(int switchNumber)
     }
 
     bool state = doc["state"];
+    bool ok = deviceLink.requestSocketState(switchNumber - 1, state);
+    if (ok)
+        socketRegistry.markChanged(switchNumber - 1, monoNow());
     server.sendHeader("Content-Type", "application/json");
     server.sendHeader("Access-Control-Allow-Origin", "*");
-    server.send(200, "application/json", "{\"success\":true}");
+    server.send(ok ? 200 : 503, "application/json", ok ? "{\"success\":true}" : "{\"success\":false}");
 }
\ No newline at end of file
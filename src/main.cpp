@@ -1,20 +1,44 @@
 #include "main.h"
 
 // Global variable definitions
-TimingControl timing;
+TaskScheduler scheduler;
+DeviceLink deviceLink;
+PowerHistory powerHistory;
+HistoryLog historyLog;
+TraceLog traceLog;
+HttpConnectionPool httpPool;
+HttpBufferPool httpBuffers;
+FileCache fileCache;
+Metrics metrics;
+PollController pollController;
+SimpleRuleEngine rules;
 Config config;
 DisplayManager display;
 EnvironmentSensors sensors;
 HomeP1Device *p1Meter = nullptr;
-HomeSocketDevice *socket1 = nullptr;
-HomeSocketDevice *socket2 = nullptr;
-HomeSocketDevice *socket3 = nullptr;
+SocketRegistry socketRegistry;
 TimeSync timeSync;
 WebInterface webServer;
 NetworkCheck *phoneCheck = nullptr;
-unsigned long lastStateChangeTime[3] = {0, 0, 0};
-bool switchForceOff[3] = {false, false, false};
-unsigned long lastTimeDisplay = 0;
+MonoTime lastTimeDisplay = 0;
+MonoTime lastWiFiCheck = 0;
+
+// Task periods (ms)
+const unsigned long SENSOR_INTERVAL = 30000;      // BME280 + BH1750
+const unsigned long DISPLAY_INTERVAL = 1000;
+const unsigned long DEVICE_INTERVAL = 20;         // Drain the core 0 measurement queue
+const unsigned long MAX_ON_CHECK_INTERVAL = 1000;
+const unsigned long WEB_INTERVAL = 5;
+const unsigned long PHONE_CHECK_INTERVAL = 60000;
+const unsigned long REPORT_INTERVAL = 300000;     // Scheduler statistics
+const unsigned long WIFI_CHECK_INTERVAL = 30000;
+const unsigned long RULES_INTERVAL = 1000;
+const unsigned long TIME_SYNC_INTERVAL = 1000;    // SNTP state machine, never blocks
+const unsigned long HISTORY_LOG_INTERVAL = 10000; // One P1 record per 10 s
+const unsigned long HISTORY_FLUSH_INTERVAL = 60000; // At most this much is lost on a power cut
+const unsigned long TRACE_DRAIN_INTERVAL = 50;     // Trace ring to Serial, a few lines at a time
+const unsigned long POLL_PLAN_INTERVAL = 1000;     // Device poll rates, see PollController
+const uint8_t TRACE_DRAIN_RECORDS = 4;
 
 bool loadConfiguration()
 {
@@ -31,13 +55,14 @@ bool loadConfiguration()
     return false;
   }
 
-  StaticJsonDocument<1024> doc;
+  // Room for a full socket list, only needed while booting
+  DynamicJsonDocument doc(1024 + SocketRegistry::JSON_SIZE);
   DeserializationError error = deserializeJson(doc, configFile);
   configFile.close();
 
   if (error)
   {
-    Serial.println("Failed to parse config file");
+    Serial.printf("Failed to parse config file: %s\n", error.c_str());
     return false;
   }
 
@@ -45,14 +70,13 @@ bool loadConfiguration()
   config.wifi_ssid = doc["wifi_ssid"].as<String>();
   config.wifi_password = doc["wifi_password"].as<String>();
   config.p1_ip = doc["p1_ip"].as<String>();
-  config.socket_1 = doc["socket_1"].as<String>();
-  config.socket_2 = doc["socket_2"].as<String>();
-  config.socket_3 = doc["socket_3"].as<String>();
+  socketRegistry.load(doc.as<JsonObjectConst>());
   config.power_on_threshold = doc["power_on_threshold"] | 1000.0f;
   config.power_off_threshold = doc["power_off_threshold"] | 990.0f;
   config.min_on_time = doc["min_on_time"] | 300UL;
   config.min_off_time = doc["min_off_time"] | 300UL;
   config.max_on_time = doc["max_on_time"] | 1800UL;
+  config.poll_budget_per_min = doc["poll_budget_per_min"] | (int)PollController::DEFAULT_BUDGET;
   // config.phone_ip = doc["phone_ip"].as<String>();
 
   return true;
@@ -84,161 +108,107 @@ void connectWiFi()
 
 bool canChangeState(int switchIndex, bool newState)
 {
-  unsigned long currentTime = millis();
-  unsigned long timeSinceChange = currentTime - lastStateChangeTime[switchIndex];
-
-  if (newState)
-  { // Turning ON
-    if (switchForceOff[switchIndex] && timeSinceChange < config.min_off_time)
-    {
-      return false;
-    }
-    switchForceOff[switchIndex] = false;
-  }
-  else
-  { // Turning OFF
-    if (timeSinceChange < config.min_on_time)
-    {
-      return false;
-    }
-  }
-
-  return true;
+  // The config times are in seconds
+  return socketRegistry.canChange(switchIndex, newState, monoNow(),
+                                  monoSeconds(config.min_on_time), monoSeconds(config.min_off_time));
 }
 
 void checkMaxOnTime()
 {
-  unsigned long currentTime = millis();
-
-  for (int i = 0; i < 3; i++)
+  const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+  uint32_t expired = socketRegistry.expireMaxOnTime(devices.socketOn & devices.socketPresent, monoNow(),
+                                                    monoSeconds(config.max_on_time));
+  for (; expired; expired &= expired - 1)
   {
-    bool currentState = false;
-    if (i == 0 && socket1)
-      currentState = socket1->getCurrentState();
-    if (i == 1 && socket2)
-      currentState = socket2->getCurrentState();
-    if (i == 2 && socket3)
-      currentState = socket3->getCurrentState();
-
-    if (currentState && (currentTime - lastStateChangeTime[i]) > config.max_on_time)
-    {
-      if (i == 0 && socket1)
-        socket1->setState(false);
-      if (i == 1 && socket2)
-        socket2->setState(false);
-      if (i == 2 && socket3)
-        socket3->setState(false);
-      switchForceOff[i] = true;
-      lastStateChangeTime[i] = currentTime;
-    }
+    deviceLink.requestSocketState(__builtin_ctz(expired), false);
   }
 }
 
-void updateSwitch1Logic()
+// Built-in logic of one socket, see SocketRegistry::Logic. It stands down
+// for any socket a rule controls.
+void updateSocketLogic(int index)
 {
-  if (!socket1 || !p1Meter)
+  const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+  if (!deviceLink.hasSocket(index) || rules.controlsSocket(index + 1))
     return;
 
-  float exportPower = p1Meter->getCurrentExport();
-  bool currentState = socket1->getCurrentState();
+  bool currentState = devices.isOn(index);
   bool newState = currentState;
 
-  if (exportPower > config.power_on_threshold && !currentState)
-  {
-    newState = true;
-  }
-  else if (exportPower < config.power_off_threshold && currentState)
+  switch (socketRegistry.getLogic(index))
   {
-    newState = false;
-  }
+  case SocketRegistry::LOGIC_SURPLUS:
+    if (!devices.p1Connected)
+      return;
+    if (devices.exportPower > config.power_on_threshold && !currentState)
+    {
+      newState = true;
+    }
+    else if (devices.exportPower < config.power_off_threshold && currentState)
+    {
+      newState = false;
+    }
+    break;
 
-  if (newState != currentState && canChangeState(0, newState))
+  case SocketRegistry::LOGIC_EVENING:
   {
-    socket1->setState(newState);
-    lastStateChangeTime[0] = millis();
+    // After the configured time and darker than its lux level
+    float light = sensors.getLightLevel();
+    uint16_t darkLux = socketRegistry.getDarkLux(index);
+    if (timeSync.now().minuteOfDay >= socketRegistry.getAfterMinute(index) && light < darkLux)
+    {
+      newState = true;
+    }
+    else if (light >= darkLux)
+    {
+      newState = false;
+    }
+    break;
   }
-}
 
-void updateSwitch2Logic()
-{
-  if (!socket2)
+  default:
     return;
-
-  int hour, minute;
-  timeSync.getCurrentHourMinute(hour, minute);
-  float light = sensors.getLightLevel();
-  bool currentState = socket2->getCurrentState();
-  bool newState = currentState;
-
-  // After 17:45 and light < 75 lux
-  if (hour >= 17 && minute >= 45 && light < 75)
-  {
-    newState = true;
-  }
-  else if (light >= 75)
-  {
-    newState = false;
   }
 
-  if (newState != currentState && canChangeState(1, newState))
+  if (newState != currentState && canChangeState(index, newState))
   {
-    socket2->setState(newState);
-    lastStateChangeTime[1] = millis();
+    deviceLink.requestSocketState(index, newState);
+    socketRegistry.markChanged(index, monoNow());
   }
 }
 
-void updateSwitch3Logic()
+void updateDisplay()
 {
-  if (!socket3)
+  if (!p1Meter)
     return;
-
-  int hour, minute;
-  timeSync.getCurrentHourMinute(hour, minute);
-  float light = sensors.getLightLevel();
-  bool currentState = socket3->getCurrentState();
-  bool newState = currentState;
-
-  // After 17:30 and light < 50 lux
-  if (hour >= 17 && minute >= 30 && light < 50)
-  {
-    newState = true;
-  }
-  else if (light >= 50)
+  MonoTime now = monoNow();
+  if (now - lastTimeDisplay >= 60 * MONO_SECOND)
   {
-    newState = false;
+    const TimeContext &time = timeSync.now();
+    Serial.printf("Current time: %02u:%02u%s\n", time.hour, time.minute, time.valid ? "" : " (not synchronised)");
+    lastTimeDisplay = now;
   }
+  const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+  PowerHistory::Aggregate lastTenMinutes = powerHistory.aggregate(monoUptimeSeconds(), 600);
 
-  if (newState != currentState && canChangeState(2, newState))
+  DisplayManager::SwitchStatus switches[SocketRegistry::MAX_SOCKETS];
+  uint8_t count = socketRegistry.getCount();
+  for (uint8_t i = 0; i < count; i++)
   {
-    socket3->setState(newState);
-    lastStateChangeTime[2] = millis();
+    switches[i].name = socketRegistry.getName(i);
+    switches[i].on = devices.isOn(i);
+    switches[i].seconds = (unsigned long)((now - socketRegistry.getLastChange(i)) / MONO_SECOND);
   }
-}
 
-void updateDisplay()
-{
-  if (!p1Meter)
-    return;
-  unsigned long currentMillis = millis();
-  if (currentMillis - lastTimeDisplay >= 60000)
-  { // 60 seconds
-    int hour, minute;
-    timeSync.getCurrentHourMinute(hour, minute);
-    Serial.printf("Current time: %02d:%02d\n", hour, minute);
-    lastTimeDisplay = currentMillis;
-  }
   display.updateDisplay(
-      p1Meter->getCurrentImport(),
-      p1Meter->getCurrentExport(),
+      devices.importPower,
+      devices.exportPower,
+      lastTenMinutes.buckets > 0 ? lastTenMinutes.avgW : NAN,
       sensors.getTemperature(),
       sensors.getHumidity(),
       sensors.getLightLevel(),
-      socket1 ? socket1->getCurrentState() : false,
-      socket2 ? socket2->getCurrentState() : false,
-      socket3 ? socket3->getCurrentState() : false,
-      String(millis() - lastStateChangeTime[0]),
-      String(millis() - lastStateChangeTime[1]),
-      String(millis() - lastStateChangeTime[2]));
+      switches,
+      count);
 }
 
 void setup()
@@ -286,6 +256,15 @@ void setup()
     Serial.println("Using default configuration");
   }
 
+  pollController.setBudget(config.poll_budget_per_min);
+
+  if (historyLog.begin())
+  {
+    historyLog.logBoot(esp_reset_reason());
+  }
+
+  rules.loadRules(RULES_FILE);
+
   Wire.begin();
 
   if (display.begin())
@@ -312,9 +291,7 @@ void setup()
   {
     Serial.println("Config values:");
     Serial.println("P1 IP: " + config.p1_ip);
-    Serial.println("Socket 1: " + config.socket_1);
-    Serial.println("Socket 2: " + config.socket_2);
-    Serial.println("Socket 3: " + config.socket_3);
+    Serial.printf("Sockets: %u\n", socketRegistry.getCount());
     Serial.println("Phone IP:" + config.phone_ip);
 
     if (config.p1_ip != "" && config.p1_ip != "0" && config.p1_ip != "null")
@@ -323,54 +300,194 @@ void setup()
       Serial.println("P1 Meter initialized at: " + config.p1_ip);
     }
 
-    if (config.socket_1 != "" && config.socket_1 != "0" && config.socket_1 != "null")
-    {
-      socket1 = new HomeSocketDevice(config.socket_1.c_str());
-      Serial.println("Socket 1 initialized at: " + config.socket_1);
-    }
+    socketRegistry.createDevices();
 
-    if (config.socket_2 != "" && config.socket_2 != "0" && config.socket_2 != "null")
-    {
-      socket2 = new HomeSocketDevice(config.socket_2.c_str());
-      Serial.println("Socket 2 initialized at: " + config.socket_2);
-    }
+    deviceLink.begin(p1Meter, socketRegistry.getDevices(), socketRegistry.getCount());
+    timeSync.begin();
+    webServer.begin();
+  }
 
-    if (config.socket_3 != "" && config.socket_3 != "0" && config.socket_3 != "null")
+  // Initialize timing and state
+  socketRegistry.resetTimes(monoNow());
+
+  setupTasks();
+}
+
+void taskSensors()
+{
+  sensors.update();
+  rules.inputChanged(RULE_INPUT_LIGHT);
+  historyLog.logSensors(sensors.getTemperature(), sensors.getHumidity(), sensors.getLightLevel());
+}
+
+// Confirmed socket states only; the optimistic ones set by a command are
+// logged once the socket reports them back.
+void logSocketChanges(uint32_t updated)
+{
+  static uint32_t logged = 0;
+  static uint32_t loggedState = 0;
+  const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+
+  // Reported and connected, and either never logged or changed since
+  uint32_t changed = updated & devices.socketConnected & (~logged | (loggedState ^ devices.socketOn));
+  for (; changed; changed &= changed - 1)
+  {
+    int i = __builtin_ctz(changed);
+    historyLog.logSocket(i, devices.isOn(i));
+  }
+  uint32_t reported = updated & devices.socketConnected;
+  logged |= reported;
+  loggedState = (loggedState & ~reported) | (devices.socketOn & reported);
+}
+
+void taskTimeSync()
+{
+  timeSync.update();
+}
+
+void taskRules()
+{
+  rules.evaluate();
+}
+
+void taskHistoryLog()
+{
+  PowerHistory::Aggregate recent = powerHistory.aggregate(monoUptimeSeconds(), HISTORY_LOG_INTERVAL / 1000);
+  if (recent.buckets > 0)
+    historyLog.logP1(recent.avgW, recent.minW, recent.maxW);
+}
+
+void taskHistoryFlush()
+{
+  historyLog.flush();
+}
+
+// Device polling runs on core 0; here we only pick up what it reported.
+// Surplus sockets follow every new P1 sample, evening sockets are checked
+// whenever they report themselves.
+void taskDevices()
+{
+  DeviceLink::Updates updated = deviceLink.process();
+  if (updated.powerChanged)
+    rules.inputChanged(RULE_INPUT_POWER);
+  if (updated.socketsChanged)
+    rules.inputChanged(RULE_INPUT_SOCKETS);
+
+  uint8_t count = socketRegistry.getCount();
+  if (updated.p1)
+  {
+    const DeviceLink::Snapshot &devices = deviceLink.getSnapshot();
+    if (devices.p1Connected)
+      powerHistory.add(devices.p1UpdateTime / MONO_SECOND, devices.importPower - devices.exportPower);
+    for (uint8_t i = 0; i < count; i++)
     {
-      socket3 = new HomeSocketDevice(config.socket_3.c_str());
-      Serial.println("Socket 3 initialized at: " + config.socket_3);
+      if (socketRegistry.getLogic(i) == SocketRegistry::LOGIC_SURPLUS)
+        updateSocketLogic(i);
     }
+  }
+  logSocketChanges(updated.sockets);
+  for (uint32_t bits = updated.sockets; bits; bits &= bits - 1)
+  {
+    int i = __builtin_ctz(bits);
+    if (socketRegistry.getLogic(i) == SocketRegistry::LOGIC_EVENING)
+      updateSocketLogic(i);
+  }
+}
 
-    timeSync.begin();
-    webServer.begin();
+void taskWeb()
+{
+  webServer.update();
+}
+
+void taskPhoneCheck()
+{
+  static bool wasPresent = false;
+  bool present = phoneCheck->isDevicePresent();
+  if (present != wasPresent)
+    rules.inputChanged(RULE_INPUT_PRESENCE);
+  wasPresent = present;
+
+  if (present)
+  {
+    Serial.println("Phone is detected");
+    // Add your logic for when phone is present
+  }
+  else
+  {
+    Serial.println("Phone is not detected");
+    // Add your logic for when phone is absent
   }
+}
 
-  // Initialize timing and state
-  unsigned long startTime = millis();
-  for (int i = 0; i < 3; i++)
+void taskTraceDrain()
+{
+  traceLog.drainToSerial(TRACE_DRAIN_RECORDS);
+}
+
+void taskPollPlan()
+{
+  pollController.update();
+}
+
+void taskReport()
+{
+  scheduler.printReport();
+  Serial.printf("Rules > %lu runs, %lu skipped (inputs unchanged)\n", rules.getRulesRun(), rules.getRulesSkipped());
+  httpPool.printReport();
+  httpBuffers.printReport();
+
+  HomeSocketDevice *const *devices = socketRegistry.getDevices();
+  for (uint8_t i = 0; i < socketRegistry.getCount(); i++)
   {
-    lastStateChangeTime[i] = startTime;
-    switchForceOff[i] = false;
+    if (!devices[i])
+      continue;
+    const HomeSocketDevice::CommandStats &stats = devices[i]->getCommandStats();
+    Serial.printf("Sockets > %s > %lu requests already in that state, %lu commands (%lu coalesced), %lu writes, "
+                  "%lu confirmed, avg %lu ms, max %lu ms, %lu abandoned\n",
+                  socketRegistry.getName(i), (unsigned long)deviceLink.getCoalescedCommands(i),
+                  (unsigned long)stats.commands, (unsigned long)stats.coalesced,
+                  (unsigned long)stats.writes, (unsigned long)stats.confirmed,
+                  (unsigned long)(stats.confirmed > 0 ? stats.latencySumMs / stats.confirmed : 0),
+                  (unsigned long)stats.maxLatencyMs, (unsigned long)stats.abandoned);
   }
 }
 
+void setupTasks()
+{
+  // name, callback, period, priority (0 = most urgent), budget, first delay
+  scheduler.addTask("devices", taskDevices, DEVICE_INTERVAL, 0, 20);
+  scheduler.addTask("maxon", checkMaxOnTime, MAX_ON_CHECK_INTERVAL, 1, 5);
+  scheduler.addTask("web", taskWeb, WEB_INTERVAL, 2, 100);
+  scheduler.addTask("rules", taskRules, RULES_INTERVAL, 2, 20, RULES_INTERVAL);
+  scheduler.addTask("display", updateDisplay, DISPLAY_INTERVAL, 3, 50);
+  scheduler.addTask("polling", taskPollPlan, POLL_PLAN_INTERVAL, 3, 5);
+  scheduler.addTask("sensors", taskSensors, SENSOR_INTERVAL, 4, 50);
+  scheduler.addTask("time", taskTimeSync, TIME_SYNC_INTERVAL, 4, 5);
+  if (phoneCheck)
+    scheduler.addTask("phone", taskPhoneCheck, PHONE_CHECK_INTERVAL, 5, 1500);
+  scheduler.addTask("history", taskHistoryLog, HISTORY_LOG_INTERVAL, 5, 5, HISTORY_LOG_INTERVAL);
+  scheduler.addTask("flush", taskHistoryFlush, HISTORY_FLUSH_INTERVAL, 6, 100, HISTORY_FLUSH_INTERVAL);
+  scheduler.addTask("report", taskReport, REPORT_INTERVAL, 6, 50, REPORT_INTERVAL);
+  scheduler.addTask("trace", taskTraceDrain, TRACE_DRAIN_INTERVAL, 7, 5);
+}
+
 void reconnectWiFi()
 {
-  unsigned long currentMillis = millis();
+  MonoTime now = monoNow();
 
   if (WiFi.status() != WL_CONNECTED &&
-      (currentMillis - timing.lastWiFiCheck >= timing.WIFI_CHECK_INTERVAL || timing.lastWiFiCheck == 0))
+      (now - lastWiFiCheck >= monoMs(WIFI_CHECK_INTERVAL) || lastWiFiCheck == 0))
   {
     Serial.println("Reconnecting to WiFi...");
     WiFi.disconnect();
     WiFi.begin(config.wifi_ssid.c_str(), config.wifi_password.c_str());
-    timing.lastWiFiCheck = currentMillis;
+    lastWiFiCheck = now;
   }
 }
 
 void loop()
 {
-  unsigned long currentMillis = millis();
+  MonoTime passStart = monoNow();
 
   // WiFi check first
   reconnectWiFi();
@@ -380,145 +497,15 @@ void loop()
     return;
   }
 
-  // Use static counter to sequence ALL operations
-  static uint8_t operationOrder = 0;
+  // One time snapshot per pass, shared by whichever task runs
+  timeSync.tick();
 
-  switch (operationOrder)
+  // Run whichever task is due soonest; nothing due means a cheap pass
+  if (!scheduler.runNext())
   {
-  case 0: // Environmental sensor (I2C) - Temperature/Humidity
-    if (currentMillis - timing.lastEnvSensorUpdate >= timing.ENV_SENSOR_INTERVAL)
-    {
-      sensors.update(); // Assuming this method exists, if not we use sensors.update()
-      timing.lastEnvSensorUpdate = currentMillis;
-      operationOrder = 1;
-      yield();
-      delay(1);
-    }
-    break;
-
-  case 1: // Light sensor (I2C)
-    if (currentMillis - timing.lastLightSensorUpdate >= timing.LIGHT_SENSOR_INTERVAL)
-    {
-      sensors.update(); // Assuming this method exists, if not we use sensors.update()
-      timing.lastLightSensorUpdate = currentMillis;
-      operationOrder = 2;
-      yield();
-      delay(1);
-    }
-    break;
-
-  case 2: // Display update (I2C)
-    if (currentMillis - timing.lastDisplayUpdate >= timing.DISPLAY_INTERVAL)
-    {
-      updateDisplay();
-      timing.lastDisplayUpdate = currentMillis;
-      operationOrder = 3;
-      yield();
-      delay(1);
-    }
-    break;
-
-  case 3: // P1 meter (Network)
-    if (p1Meter && (currentMillis - timing.lastP1Update >= timing.P1_INTERVAL))
-    {
-      p1Meter->update();
-      timing.lastP1Update = currentMillis;
-      operationOrder = 4;
-      yield();
-      delay(50);
-    }
-    else
-    {
-      operationOrder = 4;
-    }
-    break;
-
-  case 4: // Socket 1 (Network)
-    if (socket1 && (currentMillis - timing.lastSocket1Update >= timing.SOCKET_INTERVAL))
-    {
-      socket1->update();
-      timing.lastSocket1Update = currentMillis;
-      if (p1Meter)
-      {
-        updateSwitch1Logic();
-      }
-      operationOrder = 5;
-      yield();
-      delay(50);
-    }
-    else
-    {
-      operationOrder = 5;
-    }
-    break;
-
-  case 5: // Socket 2 (Network)
-    if (socket2 && (currentMillis - timing.lastSocket2Update >= timing.SOCKET_INTERVAL))
-    {
-      socket2->update();
-      timing.lastSocket2Update = currentMillis;
-      updateSwitch2Logic();
-      operationOrder = 6;
-      yield();
-      delay(50);
-    }
-    else
-    {
-      operationOrder = 6;
-    }
-    break;
-
-  case 6: // Socket 3 (Network)
-    if (socket3 && (currentMillis - timing.lastSocket3Update >= timing.SOCKET_INTERVAL))
-    {
-      socket3->update();
-      timing.lastSocket3Update = currentMillis;
-      updateSwitch3Logic();
-      operationOrder = 7;
-      yield();
-      delay(50);
-    }
-    else
-    {
-      operationOrder = 7;
-    }
-    break;
-
-  case 7: // Max on time check (no I2C or network)
-    checkMaxOnTime();
-    operationOrder = 8;
-    break;
-
-  case 8: // Web server (Network)
-    webServer.update();
-    operationOrder = 9; // Back to start
     yield();
-    break;
-
-  case 9: // Phone presence check
-    if (phoneCheck && (currentMillis - timing.lastPhoneCheck >= timing.PHONE_CHECK_INTERVAL))
-    {
-      if (phoneCheck->isDevicePresent())
-      {
-        Serial.println("Phone is detected");
-        // Add your logic for when phone is present
-      }
-      else
-      {
-        Serial.println("Phone is not detected");
-        // Add your logic for when phone is absent
-      }
-      timing.lastPhoneCheck = currentMillis;
-      operationOrder = 0; // Go back to start
-      yield();
-      delay(50); // Give some time between network operations
-    }
-    else
-    {
-      operationOrder = 0;
-    }
-    break;
   }
+  metrics.recordLoopPass(monoNow() - passStart);
 }
 
 //  TimeSync::TimeData time = timeSync.getTime();
@@ -0,0 +1,67 @@
+// history_bench.cpp
+// Runs HistoryLog against the native SPIFFS stand-in (a host directory) and
+// reports write throughput, plus the flash bytes per day the firmware's log
+// rates add up to. Throughput is the host's, the bytes per day carry over.
+//
+//   g++ -std=gnu++17 -O2 -DARDUINO=10805 -Iinclude -Ilib/NativeSim/src
+//       tools/history/history_bench.cpp src/HistoryLog.cpp
+//       lib/NativeSim/src/Arduino.cpp lib/NativeSim/src/FS.cpp
+//       lib/NativeSim/src/SimHeap.cpp -o history_bench
+//   ./history_bench [records] [directory]
+#include "HistoryLog.h"
+
+#include <chrono>
+
+// Keep in step with main.cpp
+static const double P1_RECORDS_PER_DAY = 86400.0 / 10;     // HISTORY_LOG_INTERVAL
+static const double SENSOR_RECORDS_PER_DAY = 86400.0 / 30; // SENSOR_INTERVAL
+static const double SOCKET_RECORDS_PER_DAY = 3 * 48;       // Generous: 3 sockets switching every 30 min
+static const double FLUSHES_PER_DAY = 86400.0 / 60;        // HISTORY_FLUSH_INTERVAL
+
+void setup() {}
+void loop() {}
+
+int main(int argc, char **argv)
+{
+    unsigned long count = argc > 1 ? strtoul(argv[1], nullptr, 10) : 200000;
+    SPIFFS.addRoot(argc > 2 ? argv[2] : "/tmp/history_bench");
+    SPIFFS.begin(true);
+
+    HistoryLog log;
+    if (!log.begin())
+        return 1;
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < count; i++)
+    {
+        switch (i % 4)
+        {
+        case 0:
+        case 1:
+            log.logP1(-1500.0f + (float)(i % 300), -1800, -1200);
+            break;
+        case 2:
+            log.logSensors(21.3f, 48.2f, 1200);
+            break;
+        default:
+            log.logSocket(i % 3, i & 4);
+        }
+    }
+    log.flush();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    const HistoryLog::Stats &stats = log.getStats();
+    printf("Written:     %u records, %u bytes, %u flushes, %u rotations, %u errors\n",
+           stats.recordsWritten, stats.bytesWritten, stats.flushes, stats.rotations, stats.writeErrors);
+    printf("Throughput:  %.0f records/s (%.2f us per record), slowest flush %u ms\n",
+           count / seconds, seconds * 1e6 / count, stats.maxFlushTime);
+
+    double recordsPerDay = P1_RECORDS_PER_DAY + SENSOR_RECORDS_PER_DAY + SOCKET_RECORDS_PER_DAY;
+    double bytesPerDay = recordsPerDay * sizeof(HistoryRecord) +
+                         recordsPerDay / HistoryLog::RECORDS_PER_SEGMENT * sizeof(HistorySegmentHeader);
+    double capacity = (double)HistoryLog::SEGMENT_COUNT * HistoryLog::RECORDS_PER_SEGMENT;
+    printf("Firmware:    %.0f records/day, %.0f flash bytes/day in ~%.0f page writes, %.1f days kept\n",
+           recordsPerDay, bytesPerDay,
+           recordsPerDay / HistoryLog::RECORDS_PER_PAGE + FLUSHES_PER_DAY, capacity / recordsPerDay);
+    return 0;
+}
@@ -0,0 +1,130 @@
+// history_decode.cpp
+// Decodes history log segments (/log/<slot>.bin, downloaded from the web
+// server or read from a SPIFFS image) into CSV on stdout, oldest first.
+//
+//   g++ -std=c++17 -O2 -Iinclude tools/history/history_decode.cpp -o history_decode
+//   ./history_decode 0.bin 1.bin ... > history.csv
+#include "HistoryRecord.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <string>
+#include <time.h>
+#include <vector>
+
+struct Segment
+{
+    std::string path;
+    HistorySegmentHeader header;
+};
+
+static const char *typeName(uint8_t type)
+{
+    switch (type & ~HISTORY_TIME_UPTIME)
+    {
+    case HISTORY_P1:
+        return "p1";
+    case HISTORY_SOCKET:
+        return "socket";
+    case HISTORY_SENSORS:
+        return "sensors";
+    case HISTORY_BOOT:
+        return "boot";
+    default:
+        return "unknown";
+    }
+}
+
+static void printRecord(uint32_t segment, const HistoryRecord &r)
+{
+    char when[32];
+    if (r.type & HISTORY_TIME_UPTIME)
+    {
+        snprintf(when, sizeof(when), "+%us", r.time);
+    }
+    else
+    {
+        time_t t = r.time;
+        strftime(when, sizeof(when), "%Y-%m-%dT%H:%M:%SZ", gmtime(&t));
+    }
+
+    printf("%u,%u,%s,%s,%u,", segment, r.sequence, when, typeName(r.type), r.index);
+    switch (r.type & ~HISTORY_TIME_UPTIME)
+    {
+    case HISTORY_P1:
+        printf("avg_w=%d;min_w=%d;max_w=%d\n", r.value[0], r.value[1], r.value[2]);
+        break;
+    case HISTORY_SOCKET:
+        printf("state=%s\n", r.value[0] ? "on" : "off");
+        break;
+    case HISTORY_SENSORS:
+        printf("temperature_c=%.1f;humidity_pct=%.1f;light_lux=%u\n",
+               r.value[0] / 10.0, r.value[1] / 10.0, (unsigned)(uint16_t)r.value[2]);
+        break;
+    case HISTORY_BOOT:
+        printf("reset_reason=%d\n", r.value[0]);
+        break;
+    default:
+        printf("%d;%d;%d\n", r.value[0], r.value[1], r.value[2]);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        fprintf(stderr, "usage: %s segment.bin...\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<Segment> segments;
+    for (int i = 1; i < argc; i++)
+    {
+        FILE *file = fopen(argv[i], "rb");
+        Segment segment = {argv[i], {}};
+        if (!file || fread(&segment.header, sizeof(segment.header), 1, file) != 1 ||
+            !historyValid(segment.header))
+        {
+            fprintf(stderr, "%s: not a history segment, skipped\n", argv[i]);
+        }
+        else
+        {
+            segments.push_back(segment);
+        }
+        if (file)
+            fclose(file);
+    }
+    std::sort(segments.begin(), segments.end(), [](const Segment &a, const Segment &b)
+              { return a.header.sequence < b.header.sequence; });
+
+    unsigned long records = 0, corrupt = 0, gaps = 0;
+    bool havePrevious = false;
+    uint16_t expected = 0;
+
+    printf("segment,sequence,time,type,index,values\n");
+    for (const Segment &segment : segments)
+    {
+        FILE *file = fopen(segment.path.c_str(), "rb");
+        fseek(file, sizeof(HistorySegmentHeader), SEEK_SET);
+        HistoryRecord record;
+        while (fread(&record, sizeof(record), 1, file) == 1)
+        {
+            if (!historyValid(record))
+            {
+                corrupt++;
+                continue;
+            }
+            if (havePrevious && record.sequence != expected)
+                gaps++;
+            expected = record.sequence + 1;
+            havePrevious = true;
+            records++;
+            printRecord(segment.header.sequence, record);
+        }
+        fclose(file);
+    }
+
+    fprintf(stderr, "%zu segments, %lu records, %lu corrupt, %lu sequence gaps\n",
+            segments.size(), records, corrupt, gaps);
+    return 0;
+}
@@ -0,0 +1,181 @@
+// spsc_stress.cpp
+// Pushes sequence numbers through the two DeviceLink queue types, one
+// std::thread producing and one consuming, and checks that every item
+// arrives once, in order and intact, and that getDropped() counts exactly
+// the pushes that found the queue full. Each queue runs twice: retrying a
+// full push (nothing may be lost) and dropping it, as the firmware does.
+//
+//   g++ -std=gnu++17 -O2 -pthread -DARDUINO=10805 -DARDUINOJSON_ENABLE_PROGMEM=0
+//       -Iinclude -Ilib/NativeSim/src tools/spsc/spsc_stress.cpp -o spsc_stress
+// (plus -I to ArduinoJson, which DeviceLink.h pulls in)
+//   ./spsc_stress [items]
+#include "DeviceLink.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+// The firmware's own queue types
+typedef DeviceLink::MeasurementQueue MeasurementQueue;
+typedef DeviceLink::CommandQueue CommandQueue;
+
+// In the dropping run the producer waits for room after this many full
+// pushes in a row, so a stalled consumer cannot make the 9 bits a Command
+// carries wrap around
+static const unsigned MAX_DROPS_IN_A_ROW = 100;
+
+// Every field is filled from the sequence number, so a torn copy shows
+static DeviceLink::Measurement encode(uint64_t seq, const DeviceLink::Measurement *)
+{
+    DeviceLink::Measurement item = {};
+    item.source = seq & 1;
+    item.index = (seq >> 1) & 0x1f;
+    item.ok = (seq >> 2) & 1;
+    item.state = (seq >> 3) & 1;
+    item.pending = (seq >> 4) & 1;
+    item.accepted = (uint16_t)(seq >> 5);
+    item.importPower = (float)(seq & 0xffff);
+    item.exportPower = (float)((seq >> 16) & 0xffff);
+    item.timestamp = seq;
+    return item;
+}
+
+static bool matches(const DeviceLink::Measurement &item, uint64_t seq)
+{
+    DeviceLink::Measurement expected = encode(seq, &item);
+    return item.source == expected.source && item.index == expected.index && item.ok == expected.ok &&
+           item.state == expected.state && item.pending == expected.pending &&
+           item.accepted == expected.accepted && item.importPower == expected.importPower &&
+           item.exportPower == expected.exportPower && item.timestamp == expected.timestamp;
+}
+
+static DeviceLink::Command encode(uint64_t seq, const DeviceLink::Command *)
+{
+    DeviceLink::Command item;
+    item.socketIndex = seq & 0xff;
+    item.state = (seq >> 8) & 1;
+    return item;
+}
+
+static bool matches(const DeviceLink::Command &item, uint64_t seq)
+{
+    return item.socketIndex == (seq & 0xff) && item.state == (bool)((seq >> 8) & 1);
+}
+
+// Busy work with a varying length, so the queue runs full now and then
+static void stall(uint32_t &random)
+{
+    random ^= random << 13;
+    random ^= random >> 17;
+    random ^= random << 5;
+    for (volatile uint32_t i = random % 2048; i > 0; i--)
+    {
+    }
+}
+
+template <typename Queue, typename T>
+static bool run(const char *name, uint64_t count, bool retry)
+{
+    Queue *queue = new Queue();
+    std::atomic<bool> done{false};
+    std::atomic<bool> failed{false}; // Consumer gave up, the producer stops too
+    uint64_t fullPushes = 0;
+    std::vector<uint64_t> dropped;  // Producer's
+    std::vector<uint64_t> skipped;  // Consumer's, must equal dropped
+    uint64_t received = 0;
+    uint64_t badItem = UINT64_MAX;
+
+    std::thread producer([&]()
+                         {
+        unsigned inARow = 0;
+        for (uint64_t seq = 0; seq < count && !failed.load(std::memory_order_relaxed); seq++)
+        {
+            T item = encode(seq, (const T *)nullptr);
+            while (!queue->push(item))
+            {
+                fullPushes++;
+                if (retry)
+                {
+                    if (failed.load(std::memory_order_relaxed))
+                        break;
+                    std::this_thread::yield(); // Matters on a single core
+                }
+                else
+                {
+                    dropped.push_back(seq);
+                    if (++inARow >= MAX_DROPS_IN_A_ROW)
+                    {
+                        while (queue->size() > 0 && !failed.load(std::memory_order_relaxed))
+                            std::this_thread::yield();
+                        inARow = 0;
+                    }
+                    break;
+                }
+            }
+        }
+        done.store(true, std::memory_order_release); });
+
+    std::thread consumer([&]()
+                         {
+        uint32_t random = 2463534242u;
+        uint64_t expected = 0;
+        T item;
+        while (true)
+        {
+            if (!queue->pop(item))
+            {
+                if (done.load(std::memory_order_acquire) && queue->empty())
+                    break;
+                std::this_thread::yield();
+                continue;
+            }
+            // Items the producer dropped are missing, nothing else
+            while (expected < count && !matches(item, expected))
+            {
+                skipped.push_back(expected++);
+            }
+            if (expected >= count)
+            {
+                badItem = received;
+                failed.store(true, std::memory_order_relaxed);
+                break;
+            }
+            expected++;
+            received++;
+            if ((received & 0xfff) == 0)
+                stall(random);
+        }
+        while (!failed.load(std::memory_order_relaxed) && expected < count)
+            skipped.push_back(expected++); });
+
+    producer.join();
+    consumer.join();
+
+    bool ok = badItem == UINT64_MAX && received + dropped.size() == count && skipped == dropped &&
+              queue->getDropped() == fullPushes && queue->empty();
+    printf("%-12s %-8s %9llu items, %9llu received, %8llu full pushes, %8llu dropped, getDropped %8lu: %s\n",
+           name, retry ? "retry" : "drop", (unsigned long long)count, (unsigned long long)received,
+           (unsigned long long)fullPushes, (unsigned long long)dropped.size(), queue->getDropped(),
+           ok ? "ok" : "FAILED");
+    if (badItem != UINT64_MAX)
+        printf("  item %llu matches no sequence number\n", (unsigned long long)badItem);
+    else if (skipped != dropped)
+        printf("  %zu items missing, %zu were dropped\n", skipped.size(), dropped.size());
+    delete queue;
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    uint64_t count = argc > 1 ? strtoull(argv[1], nullptr, 10) : 4000000;
+
+    bool ok = true;
+    ok &= run<MeasurementQueue, DeviceLink::Measurement>("Measurement", count, true);
+    ok &= run<MeasurementQueue, DeviceLink::Measurement>("Measurement", count, false);
+    ok &= run<CommandQueue, DeviceLink::Command>("Command", count, true);
+    ok &= run<CommandQueue, DeviceLink::Command>("Command", count, false);
+    return ok ? 0 : 1;
+}
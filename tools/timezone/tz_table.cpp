@@ -0,0 +1,139 @@
+// tz_table.cpp
+// Generates include/TimeZoneTable.h from the host's libc, using the POSIX
+// rule in TimeZone.h, and checks the firmware's table lookup against libc
+// around every transition.
+//
+//   g++ -std=gnu++17 -O2 -Iinclude tools/timezone/tz_table.cpp -o tz_table
+//   ./tz_table generate [firstYear] [lastYear] > include/TimeZoneTable.h
+//   ./tz_table check
+#include "TimeZone.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static const int DEFAULT_FIRST_YEAR = 2024;
+static const int DEFAULT_LAST_YEAR = 2045;
+
+static bool isDst(time_t utc)
+{
+    struct tm local;
+    localtime_r(&utc, &local);
+    return local.tm_isdst > 0;
+}
+
+// First second at which isDst() differs from its value at 'from'
+static time_t nextTransition(time_t from, time_t limit)
+{
+    bool state = isDst(from);
+    time_t step = 3600;
+    time_t t = from;
+    while (t < limit && isDst(t + step) == state)
+        t += step;
+    if (t >= limit)
+        return 0;
+
+    time_t low = t, high = t + step; // state at low, changed at high
+    while (high - low > 1)
+    {
+        time_t middle = low + (high - low) / 2;
+        if (isDst(middle) == state)
+            low = middle;
+        else
+            high = middle;
+    }
+    return high;
+}
+
+static time_t yearStart(int year)
+{
+    struct tm start = {};
+    start.tm_year = year - 1900;
+    start.tm_mday = 1;
+    return timegm(&start);
+}
+
+static int generate(int firstYear, int lastYear)
+{
+    time_t t = yearStart(firstYear);
+    time_t end = yearStart(lastYear + 1);
+    if (isDst(t))
+    {
+        fprintf(stderr, "%d does not start in winter time\n", firstYear);
+        return 1;
+    }
+
+    printf("// TimeZoneTable.h\n");
+    printf("// Generated by tools/timezone/tz_table.cpp from \"%s\", do not edit.\n", TIME_ZONE_POSIX);
+    printf("// UTC instants where the offset changes, %d-%d, starting with summer time.\n", firstYear, lastYear);
+    printf("#ifndef TIME_ZONE_TABLE_H\n#define TIME_ZONE_TABLE_H\n\n");
+    printf("static const uint32_t TIME_ZONE_TRANSITIONS[] = {\n");
+    int count = 0;
+    while ((t = nextTransition(t, end)) != 0)
+    {
+        struct tm utc;
+        gmtime_r(&t, &utc);
+        printf("    %lu, // %04d-%02d-%02d %02d:%02d UTC, %s\n", (unsigned long)t, utc.tm_year + 1900,
+               utc.tm_mon + 1, utc.tm_mday, utc.tm_hour, utc.tm_min, count % 2 == 0 ? "CEST" : "CET");
+        count++;
+    }
+    printf("};\n");
+    printf("static const size_t TIME_ZONE_TRANSITION_COUNT = %d;\n\n#endif\n", count);
+    return 0;
+}
+
+// Every second within two hours of each transition, plus every hour of the
+// table's range, must match libc
+static int check()
+{
+    unsigned long checked = 0, failures = 0;
+    auto compare = [&](time_t t)
+    {
+        struct tm local;
+        localtime_r(&t, &local);
+        bool libcDst = local.tm_isdst > 0;
+        time_t asUtc = timegm(&local); // Normalises local, read tm_isdst first
+        bool dst;
+        int32_t offset = timeZoneOffset(t, dst);
+        checked++;
+        if (offset != asUtc - t || dst != libcDst)
+        {
+            if (failures++ < 10)
+                printf("Mismatch at %ld: table %+d%s, libc %+ld%s\n", (long)t, (int)offset, dst ? " DST" : "",
+                       (long)(asUtc - t), libcDst ? " DST" : "");
+        }
+    };
+
+    for (size_t i = 0; i < TIME_ZONE_TRANSITION_COUNT; i++)
+    {
+        time_t transition = TIME_ZONE_TRANSITIONS[i];
+        for (time_t t = transition - 7200; t <= transition + 7200; t++)
+            compare(t);
+    }
+    time_t first = TIME_ZONE_TRANSITIONS[0];
+    time_t last = TIME_ZONE_TRANSITIONS[TIME_ZONE_TRANSITION_COUNT - 1];
+    for (time_t t = first - 86400 * 90; t <= last + 86400 * 30; t += 3600)
+        compare(t);
+
+    printf("%lu instants checked, %lu mismatches\n", checked, failures);
+    return failures == 0 ? 0 : 1;
+}
+
+int main(int argc, char **argv)
+{
+    setenv("TZ", TIME_ZONE_POSIX, 1);
+    tzset();
+
+    if (argc > 1 && strcmp(argv[1], "generate") == 0)
+    {
+        int firstYear = argc > 2 ? atoi(argv[2]) : DEFAULT_FIRST_YEAR;
+        int lastYear = argc > 3 ? atoi(argv[3]) : DEFAULT_LAST_YEAR;
+        return generate(firstYear, lastYear);
+    }
+    if (argc > 1 && strcmp(argv[1], "check") == 0)
+        return check();
+
+    fprintf(stderr, "Usage: %s generate [firstYear] [lastYear] | check\n", argv[0]);
+    return 2;
+}
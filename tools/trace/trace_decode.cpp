@@ -0,0 +1,56 @@
+// trace_decode.cpp
+// Turns a trace dump (GET /trace on the web server) back into log lines on
+// stdout, oldest first, with the same format table the firmware uses.
+//
+//   g++ -std=c++17 -O2 -Iinclude tools/trace/trace_decode.cpp -o trace_decode
+//   curl -s http://<esp32>/trace > trace.bin && ./trace_decode trace.bin
+//
+// Reads stdin when no file is given. Lines look like the Serial output:
+// seconds since boot, level letter (E/W/I/D), text. Gaps in the record
+// sequence are reported, they are records overwritten in the ring.
+#include "TraceRecord.h"
+
+#include <stdio.h>
+
+int main(int argc, char **argv)
+{
+    FILE *file = argc > 1 ? fopen(argv[1], "rb") : stdin;
+    if (!file)
+    {
+        fprintf(stderr, "Cannot open %s\n", argv[1]);
+        return 1;
+    }
+
+    TraceDumpHeader header;
+    if (fread(&header, sizeof(header), 1, file) != 1 || header.magic != TRACE_MAGIC)
+    {
+        fprintf(stderr, "Not a trace dump\n");
+        return 1;
+    }
+    if (header.version != TRACE_VERSION || header.recordSize != sizeof(TraceRecord))
+    {
+        fprintf(stderr, "Trace version %u with %u byte records, this decoder reads version %u\n",
+                header.version, header.recordSize, TRACE_VERSION);
+        return 1;
+    }
+
+    TraceRecord record;
+    char text[160];
+    uint32_t decoded = 0;
+    uint32_t expected = 0;
+    while (decoded < header.count && fread(&record, sizeof(record), 1, file) == 1)
+    {
+        if (decoded > 0 && record.sequence != expected)
+            printf("... %u records missing\n", record.sequence - expected);
+        expected = record.sequence + 1;
+        decoded++;
+
+        traceFormat(record, text, sizeof(text));
+        printf("%u.%03u %c %s\n", record.time / 1000, record.time % 1000, traceLevelLetter(record.level), text);
+    }
+
+    fprintf(stderr, "%u of %u records, %u lost before the Serial drain\n", decoded, header.count, header.lost);
+    if (file != stdin)
+        fclose(file);
+    return decoded == header.count ? 0 : 1;
+}
@@ -0,0 +1,134 @@
+# web_assets.py
+# Generates include/WebAssets.h: the dashboard files from data/ gzipped
+# into const arrays, which the ESP32 keeps in flash, each with a strong
+# ETag (FNV-1a 64 of the gzipped bytes).
+#
+# Runs before every PlatformIO build (extra_scripts = pre:... in
+# platformio.ini) and only rewrites the header when data/ changed it, so
+# the page in flash can not fall behind the one on SPIFFS. By hand:
+#
+#   python3 tools/webassets/web_assets.py generate
+#   python3 tools/webassets/web_assets.py check    (fails when out of date)
+#
+# config.json and rules.txt stay out: they are settings the device
+# rewrites on SPIFFS, not part of the page.
+import os
+import sys
+import zlib
+
+ASSETS = ["data/index.html", "data/favicon.ico"]
+HEADER = "include/WebAssets.h"
+
+# Same table as WebInterface::getContentType()
+CONTENT_TYPES = [
+    (".html", "text/html"),
+    (".css", "text/css"),
+    (".js", "application/javascript"),
+    (".json", "application/json"),
+    (".ico", "image/x-icon"),
+]
+
+
+def content_type(path):
+    for extension, kind in CONTENT_TYPES:
+        if path.endswith(extension):
+            return kind
+    return "text/plain"
+
+
+# Level 9, and a gzip header without name or time and with the OS byte
+# "unknown", so the output only changes when the file does
+def gzip(data):
+    compressor = zlib.compressobj(9, zlib.DEFLATED, 15 + 16, 9, zlib.Z_DEFAULT_STRATEGY)
+    out = bytearray(compressor.compress(data) + compressor.flush())
+    out[9] = 255
+    return bytes(out)
+
+
+def fnv1a64(data):
+    value = 0xCBF29CE484222325
+    for byte in data:
+        value ^= byte
+        value = (value * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+    return value
+
+
+def generate(project_dir):
+    out = [
+        "// WebAssets.h\n"
+        "// Generated by tools/webassets/web_assets.py from data/ before every build, do not edit.\n"
+        "// Gzipped dashboard files, served from flash by WebInterface::serveAsset().\n"
+        "#ifndef WEB_ASSETS_H\n"
+        "#define WEB_ASSETS_H\n"
+        "\n"
+        "#include <stddef.h>\n"
+        "#include <stdint.h>\n"
+        "\n"
+        "struct WebAsset\n"
+        "{\n"
+        "    const char *path;\n"
+        "    const char *contentType;\n"
+        "    const char *etag;\n"
+        "    const uint8_t *data; // gzip\n"
+        "    uint32_t size;\n"
+        "};\n"
+    ]
+    table = []
+    for i, name in enumerate(ASSETS):
+        with open(os.path.join(project_dir, name), "rb") as file:
+            content = file.read()
+        gzipped = gzip(content)
+        path = "/" + os.path.basename(name)
+        out.append("\n// %s, %d bytes, %d gzipped\nstatic const uint8_t WEB_ASSET_%d[] = {"
+                   % (path, len(content), len(gzipped), i))
+        for b, byte in enumerate(gzipped):
+            out.append("%s0x%02x," % ("\n    " if b % 16 == 0 else " ", byte))
+        out.append("\n};\n")
+        table.append("    {\"%s\", \"%s\", \"\\\"%016x\\\"\", WEB_ASSET_%d, sizeof(WEB_ASSET_%d)},\n"
+                     % (path, content_type(path), fnv1a64(gzipped), i, i))
+
+    out.append("\nstatic const WebAsset WEB_ASSETS[] = {\n")
+    out.extend(table)
+    out.append("};\n"
+               "static const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);\n"
+               "\n"
+               "#endif\n")
+    return "".join(out).encode()
+
+
+def current(project_dir):
+    try:
+        with open(os.path.join(project_dir, HEADER), "rb") as file:
+            return file.read()
+    except OSError:
+        return None
+
+
+# Rewrites the header when it differs, true when it did
+def update(project_dir):
+    header = generate(project_dir)
+    if current(project_dir) == header:
+        return False
+    with open(os.path.join(project_dir, HEADER), "wb") as file:
+        file.write(header)
+    return True
+
+
+try:
+    Import("env")  # noqa: F821, only defined when PlatformIO runs this
+    if update(env["PROJECT_DIR"]):  # noqa: F821
+        print("Web assets > %s regenerated from data/" % HEADER)
+except NameError:
+    if __name__ == "__main__":
+        root = os.path.normpath(os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", ".."))
+        mode = sys.argv[1] if len(sys.argv) > 1 else ""
+        if mode == "generate":
+            print("%s %s" % (HEADER, "regenerated" if update(root) else "is up to date"))
+        elif mode == "check":
+            if current(root) != generate(root):
+                print("%s is out of date, run generate" % HEADER)
+                sys.exit(1)
+            print("%s is up to date" % HEADER)
+        else:
+            print("usage: %s generate|check" % sys.argv[0])
+            sys.exit(2)